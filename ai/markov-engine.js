@@ -14,6 +14,8 @@
  * - Go-to-Jail card ends turn immediately (no more doubles rolls)
  * - Handles Go-to-Jail square
  * - Supports both jail strategies (leave early vs stay)
+ * - Other dice configurations (number of white dice, sides, the Mega
+ *   Edition speed die) generate their turn transitions automatically
  *
  * @author AI Implementation based on established Monopoly mathematics
  */
@@ -86,6 +88,12 @@ const MonopolyMarkov = (function() {
     // Utility positions
     const UTILITY_SQUARES = [12, 28];
 
+    // Squares that can be owned (streets, railroads, utilities)
+    const PURCHASABLE_SQUARES = [
+        1, 3, 5, 6, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19,
+        21, 23, 24, 25, 26, 27, 28, 29, 31, 32, 34, 35, 37, 39
+    ];
+
     // ==========================================================================
     // CONSTANTS: Dice Probabilities
     // ==========================================================================
@@ -135,6 +143,38 @@ const MonopolyMarkov = (function() {
         1/36    // 12: only 6+6
     ];
 
+    // ==========================================================================
+    // CONSTANTS: Dice Configurations
+    // ==========================================================================
+
+    /**
+     * Speed die faces (Mega Edition): 1-3 add to the move, Mr. Monopoly
+     * sends you on to the next property after you land, the bus lets you
+     * move one white die or both.
+     */
+    const MR_MONOPOLY = 'monopoly';
+    const BUS = 'bus';
+    const SPEED_DIE = [1, 2, 3, MR_MONOPOLY, MR_MONOPOLY, BUS];
+
+    /**
+     * Named dice configurations. A configuration may also be passed as an
+     * object with the same fields:
+     *   dice          number of white dice (doubles = all white dice equal)
+     *   sides         faces per white die
+     *   speedDie      faces of an extra speed die, or null
+     *   maxDoubles    the roll that sends you to jail if it is doubles too
+     *   triplesTarget where speed-die triples go (the player's choice; GO
+     *                 is where the simulation engine goes on a full board)
+     *
+     * The chain has no ownership, so Mr. Monopoly is modelled on a fully
+     * owned board (the next property, railroad or utility ahead) and the
+     * bus always moves the full white total.
+     */
+    const DICE_CONFIGS = {
+        classic: { dice: 2, sides: 6, speedDie: null, maxDoubles: 3 },
+        speed: { dice: 2, sides: 6, speedDie: SPEED_DIE, maxDoubles: 3, triplesTarget: 0 }
+    };
+
     // ==========================================================================
     // CONSTANTS: Card Probabilities
     // ==========================================================================
@@ -565,6 +605,206 @@ const MonopolyMarkov = (function() {
         return buildDiceTransitions();
     }
 
+    // ==========================================================================
+    // CONFIGURABLE DICE
+    // ==========================================================================
+
+    const resolvedDice = {};
+
+    /**
+     * Resolve a dice configuration (name or object) and tabulate its white
+     * dice: sumProb[s] = P(white total s), doublesProb[s] = P(total s and
+     * all white dice equal). The classic configuration uses the exact
+     * constants above.
+     */
+    function resolveDice(dice = 'classic') {
+        if (typeof dice === 'string') {
+            if (!DICE_CONFIGS[dice]) throw new Error(`Unknown dice configuration '${dice}'`);
+            if (!resolvedDice[dice]) resolvedDice[dice] = resolveDice({ name: dice, ...DICE_CONFIGS[dice] });
+            return resolvedDice[dice];
+        }
+
+        const config = { name: 'custom', speedDie: null, maxDoubles: 3, triplesTarget: 0, ...dice };
+        if (config.name === 'classic') {
+            return { ...config, sumProb: DICE_PROB, doublesProb: DICE_DOUBLES_PROB, doublesTotal: DOUBLES_PROB };
+        }
+
+        const { dice: n, sides } = config;
+        const sumProb = createVector(n * sides + 1);
+        const doublesProb = createVector(n * sides + 1);
+        const p = Math.pow(sides, -n);
+        const faces = new Array(n).fill(1);
+        for (let k = 0; k < Math.pow(sides, n); k++) {
+            const sum = faces.reduce((a, b) => a + b, 0);
+            sumProb[sum] += p;
+            if (n > 1 && faces.every(f => f === faces[0])) doublesProb[sum] += p;
+            for (let d = 0; d < n && ++faces[d] > sides; d++) faces[d] = 1;
+        }
+        return { ...config, sumProb, doublesProb, doublesTotal: doublesProb.reduce((a, b) => a + b, 0) };
+    }
+
+    /**
+     * One throw of all the dice as a short list of distinct outcomes:
+     * { move, prob, doubles, monopoly, triples }.
+     */
+    function diceOutcomes(config) {
+        const byKey = new Map();
+        function add(move, prob, doubles, monopoly, triples) {
+            const key = `${move}:${doubles}:${monopoly}:${triples}`;
+            const o = byKey.get(key);
+            if (o) o.prob += prob;
+            else byKey.set(key, { move, prob, doubles, monopoly, triples });
+        }
+
+        const { sumProb, doublesProb, speedDie } = config;
+        for (let sum = 0; sum < sumProb.length; sum++) {
+            for (const doubles of [false, true]) {
+                const prob = doubles ? doublesProb[sum] : sumProb[sum] - doublesProb[sum];
+                if (prob <= 0) continue;
+                if (!speedDie) {
+                    add(sum, prob, doubles, false, false);
+                    continue;
+                }
+                const each = prob / speedDie.length;
+                for (const face of speedDie) {
+                    if (face === MR_MONOPOLY) add(sum, each, doubles, true, false);
+                    else if (face === BUS) add(sum, each, doubles, false, false);
+                    // Triples: every die shows the speed die's number
+                    else if (doubles && face * config.dice === sum) add(0, each, true, false, true);
+                    else add(sum + face, each, doubles, false, false);
+                }
+            }
+        }
+        return [...byKey.values()];
+    }
+
+    /** Next ownable square strictly ahead of `from` */
+    function nextPurchasable(from) {
+        for (const sq of PURCHASABLE_SQUARES) {
+            if (sq > from) return sq;
+        }
+        return PURCHASABLE_SQUARES[0];
+    }
+
+    /**
+     * buildDiceTransitions() for any dice configuration. The turn is
+     * unrolled the same way - doubles roll again, the maxDoubles-th
+     * doubles goes to jail without moving, card and Go-to-Jail effects at
+     * every landing - but over the configuration's own throw outcomes.
+     * Speed-die triples count as doubles, go to triplesTarget and end the
+     * turn.
+     *
+     * @param {string|Object} dice - Dice configuration (see DICE_CONFIGS)
+     * @returns {number[][]} 40x51 transition matrix (column 50 = IN_JAIL marker)
+     */
+    function buildConfiguredTransitions(dice) {
+        const config = resolveDice(dice);
+        const outcomes = diceOutcomes(config);
+        const T = createMatrix(BOARD_SIZE, SQUARES.IN_JAIL + 1);
+        const effects = [];
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            effects[sq] = Object.entries(applySquareEffect(sq)).map(([dest, prob]) => ({ dest: parseInt(dest), prob }));
+        }
+
+        for (let from = 0; from < BOARD_SIZE; from++) {
+            let frontier = new Map([[from, 1]]);
+
+            for (let roll = 1; roll <= config.maxDoubles && frontier.size > 0; roll++) {
+                const next = new Map();
+                for (const [pos, pathProb] of frontier) {
+                    for (const o of outcomes) {
+                        const prob = pathProb * o.prob;
+                        if (o.doubles && roll === config.maxDoubles) {
+                            T[from][SQUARES.IN_JAIL] += prob;
+                            continue;
+                        }
+                        const landed = o.triples ? config.triplesTarget : wrapPosition(pos + o.move);
+                        for (const e of effects[landed]) {
+                            const p = prob * e.prob;
+                            if (e.dest === SQUARES.IN_JAIL) {
+                                T[from][SQUARES.IN_JAIL] += p;
+                                continue;
+                            }
+                            // Ownable squares have no effect of their own
+                            const dest = o.monopoly ? nextPurchasable(e.dest) : e.dest;
+                            if (o.doubles && !o.triples) next.set(dest, (next.get(dest) || 0) + p);
+                            else T[from][dest] += p;
+                        }
+                    }
+                }
+                frontier = next;
+            }
+        }
+
+        return T;
+    }
+
+    // ==========================================================================
+    // SPARSE MATRICES
+    // ==========================================================================
+
+    /**
+     * Compressed sparse rows of a dense matrix: row i's entries are
+     * values[rowStart[i] .. rowStart[i+1]) in columns cols[...].
+     */
+    function toSparse(T) {
+        const n = T.length;
+        const rowStart = new Int32Array(n + 1);
+        const cols = [];
+        const values = [];
+        for (let i = 0; i < n; i++) {
+            for (let j = 0; j < T[i].length; j++) {
+                if (T[i][j] !== 0) {
+                    cols.push(j);
+                    values.push(T[i][j]);
+                }
+            }
+            rowStart[i + 1] = cols.length;
+        }
+        return { n, rowStart, cols: Int32Array.from(cols), values: Float64Array.from(values) };
+    }
+
+    /**
+     * computeSteadyState() on a sparse matrix: each iteration touches only
+     * the non-zero transitions. Contributions are added in the same order
+     * as the dense loop, so the result is identical.
+     *
+     * @param {Object} S - Sparse square matrix from toSparse()
+     * @param {Function} log - Progress output (console.log by default)
+     * @returns {number[]} Steady-state probability vector
+     */
+    function computeSteadyStateSparse(S, maxIterations = 1000, tolerance = 1e-10, log = console.log) {
+        const { n, rowStart, cols, values } = S;
+
+        let pi = new Float64Array(n).fill(1 / n);
+        let piNew = new Float64Array(n);
+
+        for (let iter = 0; iter < maxIterations; iter++) {
+            piNew.fill(0);
+            for (let i = 0; i < n; i++) {
+                const p = pi[i];
+                for (let k = rowStart[i]; k < rowStart[i + 1]; k++) {
+                    piNew[cols[k]] += p * values[k];
+                }
+            }
+
+            let maxDiff = 0;
+            for (let i = 0; i < n; i++) {
+                maxDiff = Math.max(maxDiff, Math.abs(piNew[i] - pi[i]));
+            }
+
+            [pi, piNew] = [piNew, pi];
+
+            if (maxDiff < tolerance) {
+                log(`Converged after ${iter + 1} iterations`);
+                break;
+            }
+        }
+
+        const sum = pi.reduce((a, b) => a + b, 0);
+        return Array.from(pi, p => p / sum);
+    }
+
     // ==========================================================================
     // STEADY STATE CALCULATION
     // ==========================================================================
@@ -643,14 +883,20 @@ const MonopolyMarkov = (function() {
      *
      * For "leave early" strategy: from state 40, you pay $50 and roll normally
      * For "stay" strategy: must roll doubles or wait 3 turns
+     *
+     * With another dice configuration the board rows come from
+     * buildConfiguredTransitions() and jail rolls use its white dice (the
+     * speed die isn't rolled in jail).
      */
-    function buildExtendedTransitionMatrix(jailStrategy = 'stay') {
+    function buildExtendedTransitionMatrix(jailStrategy = 'stay', dice = 'classic') {
         const EXTENDED_SIZE = 43; // 40 board + 3 jail states
         const T = createMatrix(EXTENDED_SIZE, EXTENDED_SIZE);
+        const config = resolveDice(dice);
+        const { sumProb, doublesProb } = config;
 
         // Build basic board transitions
         // Note: basicT is 40x51 (or sparse), column 50 = IN_JAIL marker
-        const basicT = buildTransitionMatrix();
+        const basicT = config.name === 'classic' ? buildTransitionMatrix() : buildConfiguredTransitions(config);
 
         // Copy basic transitions, remapping IN_JAIL (50) to jail state (40)
         for (let from = 0; from < BOARD_SIZE; from++) {
@@ -709,11 +955,12 @@ const MonopolyMarkov = (function() {
             // This is different from paying to leave (where doubles = roll again).
 
             // From jail state 40 (turn 1 in jail)
-            T[40][41] = NON_DOUBLES_PROB; // Don't roll doubles → advance to turn 2
+            const nonDoubles = config.name === 'classic' ? NON_DOUBLES_PROB : 1 - config.doublesTotal;
+            T[40][41] = nonDoubles; // Don't roll doubles → advance to turn 2
 
             // Roll doubles → get out and move (NO second roll after escaping via doubles)
-            for (let roll = 2; roll <= 12; roll += 2) {  // Only even sums can be doubles
-                const probDoubles = DICE_DOUBLES_PROB[roll];
+            for (let roll = 0; roll < doublesProb.length; roll++) {  // Zero for sums that can't be doubles
+                const probDoubles = doublesProb[roll];
                 if (probDoubles === 0) continue;
 
                 const landed = wrapPosition(SQUARES.JUST_VISITING + roll);
@@ -730,9 +977,9 @@ const MonopolyMarkov = (function() {
             }
 
             // From jail state 41 (turn 2)
-            T[41][42] = NON_DOUBLES_PROB; // Don't roll doubles, advance to turn 3
-            for (let roll = 2; roll <= 12; roll += 2) {
-                const probDoubles = DICE_DOUBLES_PROB[roll];
+            T[41][42] = nonDoubles; // Don't roll doubles, advance to turn 3
+            for (let roll = 0; roll < doublesProb.length; roll++) {
+                const probDoubles = doublesProb[roll];
                 if (probDoubles === 0) continue;
 
                 const landed = wrapPosition(SQUARES.JUST_VISITING + roll);
@@ -752,16 +999,17 @@ const MonopolyMarkov = (function() {
             // - Roll doubles → move free, turn ends (no extra roll)
             // - No doubles → pay $50, move, turn ends (no extra roll)
             // Either way, it's a single move with no doubles bonus
-            for (let roll = 2; roll <= 12; roll++) {
+            for (let roll = 0; roll < sumProb.length; roll++) {
+                if (sumProb[roll] === 0) continue;
                 const landed = wrapPosition(SQUARES.JUST_VISITING + roll);
                 const effects = applySquareEffect(landed);
 
                 for (const [dest, prob] of Object.entries(effects)) {
                     const destInt = parseInt(dest);
                     if (destInt === SQUARES.IN_JAIL) {
-                        T[42][40] += DICE_PROB[roll] * prob;
+                        T[42][40] += sumProb[roll] * prob;
                     } else {
-                        T[42][destInt] += DICE_PROB[roll] * prob;
+                        T[42][destInt] += sumProb[roll] * prob;
                     }
                 }
             }
@@ -788,11 +1036,12 @@ const MonopolyMarkov = (function() {
      * and stay in jail (for "stay" strategy only).
      *
      * @param {string} jailStrategy - 'stay' or 'leave'
+     * @param {string|Object} dice - Dice configuration (see DICE_CONFIGS)
      * @returns {number[]} 40-element LANDING probability vector
      */
-    function computeSteadyStateExtended(jailStrategy = 'stay') {
-        const T = buildExtendedTransitionMatrix(jailStrategy);
-        const pi = computeSteadyState(T);
+    function computeSteadyStateExtended(jailStrategy = 'stay', dice = 'classic', log = console.log) {
+        const T = buildExtendedTransitionMatrix(jailStrategy, dice);
+        const pi = computeSteadyStateSparse(toSparse(T), undefined, undefined, log);
 
         // The extended steady state tells us the probability of being in each
         // extended state at the START of a turn.
@@ -837,9 +1086,14 @@ const MonopolyMarkov = (function() {
 
     /**
      * Main class for Monopoly probability calculations.
+     * options.dice selects a dice configuration ('classic' or 'speed', or
+     * a DICE_CONFIGS-style object); options.log receives the progress
+     * messages (console.log by default).
      */
     class MarkovEngine {
-        constructor() {
+        constructor(options = {}) {
+            this.dice = options.dice || 'classic';
+            this.log = options.log || ((...args) => console.log(...args));
             this._basicMatrix = null;
             this._steadyState = {};
             this._initialized = false;
@@ -849,19 +1103,20 @@ const MonopolyMarkov = (function() {
          * Initialize the engine and pre-compute probabilities.
          */
         initialize() {
-            console.log('MarkovEngine: Computing transition matrices...');
+            this.log('MarkovEngine: Computing transition matrices...');
 
-            this._basicMatrix = buildTransitionMatrix();
+            const config = resolveDice(this.dice);
+            this._basicMatrix = config.name === 'classic' ? buildTransitionMatrix() : buildConfiguredTransitions(config);
 
             // Compute steady states for both strategies
-            console.log('MarkovEngine: Computing steady state (stay in jail)...');
-            this._steadyState['stay'] = computeSteadyStateExtended('stay');
+            this.log('MarkovEngine: Computing steady state (stay in jail)...');
+            this._steadyState['stay'] = computeSteadyStateExtended('stay', config, this.log);
 
-            console.log('MarkovEngine: Computing steady state (leave jail early)...');
-            this._steadyState['leave'] = computeSteadyStateExtended('leave');
+            this.log('MarkovEngine: Computing steady state (leave jail early)...');
+            this._steadyState['leave'] = computeSteadyStateExtended('leave', config, this.log);
 
             this._initialized = true;
-            console.log('MarkovEngine: Initialization complete.');
+            this.log('MarkovEngine: Initialization complete.');
         }
 
         /**
@@ -984,12 +1239,20 @@ const MonopolyMarkov = (function() {
 
         // Expose constants for testing
         DICE_PROB,
+        DICE_CONFIGS,
+        SPEED_DIE,
         CHANCE_SQUARES,
         COMMUNITY_CHEST_SQUARES,
 
         // Expose internals for advanced use
         buildTransitionMatrix,
-        computeSteadyState
+        buildConfiguredTransitions,
+        buildExtendedTransitionMatrix,
+        resolveDice,
+        diceOutcomes,
+        toSparse,
+        computeSteadyState,
+        computeSteadyStateSparse
     };
 
 })();
@@ -304,6 +304,7 @@ const MonteCarloSim = (function() {
 
     return {
         runSimulation,
+        simulateTurn,
         SQUARE_NAMES,
         SQUARES
     };
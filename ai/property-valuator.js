@@ -611,7 +611,9 @@ const PropertyValuator = (function() {
                 throw new Error('MarkovEngine is required');
             }
 
-            console.log('PropertyValuator: Generating EPT tables...');
+            // Progress goes wherever the Markov engine's does
+            const log = this.markovEngine.log || console.log;
+            log('PropertyValuator: Generating EPT tables...');
 
             // Generate tables for both jail strategies
             const probStay = this.markovEngine.getAllProbabilities('stay');
@@ -621,7 +623,7 @@ const PropertyValuator = (function() {
             this._tables['leave'] = generateEPTTables(probLeave);
 
             this._initialized = true;
-            console.log('PropertyValuator: Initialization complete.');
+            log('PropertyValuator: Initialization complete.');
         }
 
         /**
@@ -185,9 +185,13 @@ class PropertyInfo:
 class BoardMapper:
     """Maps richup.io board state to our internal model."""
 
-    def __init__(self):
+    def __init__(self, ept_tables=None):
         self.properties = {pos: PropertyInfo(pos) for pos in PROPERTY_PRICES}
 
+        # Imported here: ept_tables builds on this module's constants
+        from ept_tables import EPTTables
+        self.ept_tables = ept_tables or EPTTables()
+
     def get_group_quality(self, group):
         """Get quality multiplier for a color group."""
         return GROUP_QUALITY.get(group, 1.0)
@@ -223,26 +227,11 @@ class BoardMapper:
         """
         Calculate Expected Property earnings per Turn.
         EPT = sum(landing_prob * rent * num_opponents)
-        """
-        total_ept = 0
-
-        for pos in owned_positions:
-            prop = self.properties.get(pos)
-            if not prop:
-                continue
-
-            group = prop.group
-            has_monopoly = self.has_monopoly(owned_positions, group)
 
-            # Determine development level (simplified - assume base or monopoly)
-            level = 1 if has_monopoly else 0
-
-            rent = prop.get_rent(level)
-            prob = prop.get_landing_probability()
-
-            total_ept += prob * rent * num_opponents
-
-        return total_ept
+        Development is assumed to be base or monopoly rent. The per-holding
+        sum is cached in the packed EPT tables (see ept_tables.py).
+        """
+        return self.ept_tables.ownership_ept(owned_positions, num_opponents)
 
 
 # Richup.io specific mappings (TO BE FILLED IN after manual inspection)
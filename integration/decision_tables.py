@@ -0,0 +1,309 @@
+"""
+Precomputed Decision Tables for the Live Bot
+
+Tabulates StrategicAI's hot decisions offline so the live bot can answer
+them with a table lookup:
+
+- should_buy_property: by square, ownership pattern in the square's group
+  (our count, best opponent count) and cash bucket
+- get_auction_bid: the ownership-dependent bid cap by square and pattern
+  (the cash/debt limit on top of it stays a closed-form calculation)
+
+These are exactly the features the decisions depend on. should_pay_jail_fee
+is not tabulated: its only inputs (a monopoly check and the board's house
+count) are the whole heuristic, so a lookup keyed on them saves nothing.
+
+Cash is bucketed. The buy decision is monotone in cash, so a lookup
+between two grid points is answered from the table only when both
+neighbours agree; otherwise (and for anything off-table) the lookup
+returns None and the caller falls back to full evaluation.
+
+The file is a flat little-endian struct layout, read through mmap:
+
+    header  magic 'SDT1', version, cash step, cash buckets, square count,
+            AI parameters the table was built with
+    buy     uint8  [square][our count 0-3][opp count 0-3][cash bucket]
+    bidcap  uint16 [square][our count 0-3][opp count 0-3]
+
+Entries are 0/1 (decisions), a bid cap, or 0xFF / 0xFFFF for impossible
+ownership patterns.
+
+The table is not checked in. DecisionTable.open() builds it on first use
+(well under a second) and rebuilds it when the layout or the AI parameters
+change.
+
+Usage:
+    table = DecisionTable.open(ai)          # load, building if missing or stale
+    python decision_tables.py               # build decision_tables.bin
+    python decision_tables.py --verify      # compare table vs full evaluation
+"""
+
+import mmap
+import os
+import struct
+import sys
+
+from board_mapping import PROPERTY_PRICES, POSITION_TO_GROUP, GROUP_PROPERTIES
+
+MAGIC = b'SDT1'
+VERSION = 2
+
+HEADER_FORMAT = '<4sHHHH8xdddd?7x'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+CASH_STEP = 25
+CASH_BUCKETS = 161          # $0 .. $4000
+MAX_GROUP_COUNT = 4         # counts 0-3 of the *other* squares in a group
+
+OFF_TABLE_U8 = 0xFF
+OFF_TABLE_U16 = 0xFFFF
+
+DEFAULT_TABLE_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'decision_tables.bin')
+
+# Purchasable squares, in table order
+SQUARES = tuple(sorted(PROPERTY_PRICES))
+SQUARE_INDEX = {pos: i for i, pos in enumerate(SQUARES)}
+
+
+def _ai_parameters(ai):
+    """The StrategicAI parameters a table depends on."""
+    return (
+        float(ai.base_bid_premium),
+        float(ai.max_debt_ratio),
+        float(ai.max_absolute_debt),
+        float(ai.absolute_min_cash),
+        bool(ai.smart_blocking),
+    )
+
+
+def _section_sizes():
+    patterns = len(SQUARES) * MAX_GROUP_COUNT * MAX_GROUP_COUNT
+    buy_size = patterns * CASH_BUCKETS
+    buy_padded = buy_size + (buy_size & 1)      # keep bidcap 2-byte aligned
+    bid_size = patterns * 2
+    return buy_size, buy_padded, bid_size
+
+
+def group_pattern(state, position):
+    """
+    Ownership features for a square: (our count, best opponent count) among
+    the other squares of its group. None if the square is already owned.
+    """
+    if position in state.my_state.properties:
+        return None
+    if any(position in opp.properties for opp in state.opponents):
+        return None
+
+    others = [p for p in GROUP_PROPERTIES[POSITION_TO_GROUP[position]] if p != position]
+    mine = sum(1 for p in others if p in state.my_state.properties)
+    theirs = max((sum(1 for p in others if p in opp.properties) for opp in state.opponents), default=0)
+    return mine, theirs
+
+
+# =============================================================================
+# LOOKUP
+# =============================================================================
+
+class DecisionTable:
+    """Read-only, mmap-backed view of a decision table file."""
+
+    def __init__(self, path=DEFAULT_TABLE_FILE):
+        with open(path, 'rb') as f:
+            self._mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+        header = struct.unpack_from(HEADER_FORMAT, self._mmap, 0)
+        magic, version, step, buckets, squares = header[:5]
+        if magic != MAGIC or version != VERSION:
+            self._mmap.close()
+            raise ValueError(f"{path}: not a version {VERSION} decision table")
+        if (step, buckets, squares) != (CASH_STEP, CASH_BUCKETS, len(SQUARES)):
+            self._mmap.close()
+            raise ValueError(f"{path}: table layout does not match this build")
+        self.parameters = tuple(header[5:])
+
+        buy_size, buy_padded, bid_size = _section_sizes()
+        view = memoryview(self._mmap)
+        offset = HEADER_SIZE
+        self._buy = view[offset:offset + buy_size]
+        offset += buy_padded
+        self._bid_cap = view[offset:offset + bid_size].cast('H')
+
+    @classmethod
+    def open(cls, ai=None, path=DEFAULT_TABLE_FILE):
+        """Load the table for this AI, building it first if missing or stale."""
+        from strategic_ai import StrategicAI
+
+        ai = ai or StrategicAI()
+        try:
+            table = cls(path)
+            if table.matches(ai):
+                return table
+            table.close()
+        except (FileNotFoundError, ValueError):
+            pass
+        build_table(ai, path)
+        return cls(path)
+
+    def matches(self, ai) -> bool:
+        """True if the table was built with this AI's parameters."""
+        return self.parameters == _ai_parameters(ai)
+
+    def _pattern_index(self, position, mine, theirs):
+        return (SQUARE_INDEX[position] * MAX_GROUP_COUNT + mine) * MAX_GROUP_COUNT + theirs
+
+    def should_buy(self, state, position, price):
+        """Tabulated buy decision, or None if off-table."""
+        if position not in SQUARE_INDEX or price != PROPERTY_PRICES[position]:
+            return None
+        cash = state.my_state.cash
+        if cash < 0:
+            return None
+        pattern = group_pattern(state, position)
+        if pattern is None:
+            return None
+
+        base = self._pattern_index(position, *pattern) * CASH_BUCKETS
+        lo = cash // CASH_STEP
+        if lo >= CASH_BUCKETS - 1:
+            # Monotone in cash: above the grid only a "buy" at the top is certain
+            value = self._buy[base + CASH_BUCKETS - 1]
+            return True if value == 1 else None
+
+        a = self._buy[base + lo]
+        if a == OFF_TABLE_U8:
+            return None
+        if cash % CASH_STEP == 0:
+            return a == 1
+        b = self._buy[base + lo + 1]
+        return a == 1 if a == b else None
+
+    def auction_bid_cap(self, state, position):
+        """Tabulated bid cap before the cash/debt limit, or None if off-table."""
+        if position not in SQUARE_INDEX:
+            return None
+        pattern = group_pattern(state, position)
+        if pattern is None:
+            return None
+        cap = self._bid_cap[self._pattern_index(position, *pattern)]
+        return None if cap == OFF_TABLE_U16 else cap
+
+    def close(self):
+        self._buy.release()
+        self._bid_cap.release()
+        self._mmap.close()
+
+
+# =============================================================================
+# GENERATOR
+# =============================================================================
+
+def _canonical_state(position, mine, theirs, cash):
+    """Smallest state with the given ownership pattern for a square's group."""
+    from strategic_ai import PlayerState, GameState
+
+    others = [p for p in GROUP_PROPERTIES[POSITION_TO_GROUP[position]] if p != position]
+    if mine + theirs > len(others):
+        return None
+
+    me = PlayerState(player_id="me", cash=cash, properties=set(others[:mine]))
+    opp = PlayerState(player_id="opp", cash=1500, properties=set(others[mine:mine + theirs]))
+    return GameState(my_state=me, opponents=[opp], current_turn="me")
+
+
+def build_table(ai=None, path=DEFAULT_TABLE_FILE):
+    """Evaluate the AI over every tabulated state and write the table file."""
+    from strategic_ai import StrategicAI
+
+    ai = ai or StrategicAI()
+    if ai.decision_table is not None:
+        raise ValueError("build_table needs an AI that evaluates decisions in full")
+
+    buy_size, buy_padded, bid_size = _section_sizes()
+    buy = bytearray(buy_padded)
+    bid_cap = [OFF_TABLE_U16] * (bid_size // 2)
+
+    for position in SQUARES:
+        price = PROPERTY_PRICES[position]
+        for mine in range(MAX_GROUP_COUNT):
+            for theirs in range(MAX_GROUP_COUNT):
+                pattern = (SQUARE_INDEX[position] * MAX_GROUP_COUNT + mine) * MAX_GROUP_COUNT + theirs
+                base = pattern * CASH_BUCKETS
+
+                if _canonical_state(position, mine, theirs, 0) is None:
+                    buy[base:base + CASH_BUCKETS] = bytes([OFF_TABLE_U8]) * CASH_BUCKETS
+                    continue
+
+                for bucket in range(CASH_BUCKETS):
+                    state = _canonical_state(position, mine, theirs, bucket * CASH_STEP)
+                    buy[base + bucket] = 1 if ai.should_buy_property(state, position, price) else 0
+
+                bid_cap[pattern] = ai.auction_bid_cap(_canonical_state(position, mine, theirs, 0), position)
+
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, CASH_STEP, CASH_BUCKETS,
+                         len(SQUARES), *_ai_parameters(ai))
+
+    # Write aside and rename, so a bot mapping the old file never sees a partial table
+    tmp_path = f"{path}.{os.getpid()}.tmp"
+    with open(tmp_path, 'wb') as f:
+        f.write(header)
+        f.write(buy)
+        f.write(struct.pack(f'<{len(bid_cap)}H', *bid_cap))
+    os.replace(tmp_path, path)
+
+    return path
+
+
+def verify_table(path=DEFAULT_TABLE_FILE, samples=20000, seed=7):
+    """
+    Compare table-backed decisions against full evaluation on random states.
+    Returns (checked, off_table, mismatches).
+    """
+    import random
+    from strategic_ai import StrategicAI, PlayerState, GameState
+
+    full = StrategicAI()
+    fast = StrategicAI(decision_table=DecisionTable(path))
+    rng = random.Random(seed)
+
+    checked = off_table = mismatches = 0
+    for _ in range(samples):
+        owners = {}
+        for pos in SQUARES:
+            roll = rng.random()
+            if roll < 0.25:
+                owners[pos] = 0
+            elif roll < 0.6:
+                owners[pos] = rng.randint(1, 3)
+
+        players = []
+        for pid in range(4):
+            props = {p for p, o in owners.items() if o == pid}
+            houses = {p: rng.randint(0, 5) for p in props if rng.random() < 0.2}
+            players.append(PlayerState(player_id=f"p{pid}", cash=rng.randint(0, 4500),
+                                       properties=props, houses=houses))
+        state = GameState(my_state=players[0], opponents=players[1:], current_turn="p0")
+
+        position = rng.choice(SQUARES)
+        price = PROPERTY_PRICES[position]
+        current_bid = rng.randint(0, 500)
+
+        if fast.decision_table.should_buy(state, position, price) is None:
+            off_table += 1
+        checked += 2
+        if fast.should_buy_property(state, position, price) != full.should_buy_property(state, position, price):
+            mismatches += 1
+        if fast.get_auction_bid(state, position, current_bid) != full.get_auction_bid(state, position, current_bid):
+            mismatches += 1
+
+    return checked, off_table, mismatches
+
+
+if __name__ == "__main__":
+    if '--verify' in sys.argv:
+        checked, off_table, mismatches = verify_table()
+        print(f"Checked {checked} decisions: {mismatches} mismatches, "
+              f"{off_table} buy lookups fell back to full evaluation")
+        sys.exit(1 if mismatches else 0)
+    else:
+        path = build_table()
+        print(f"Wrote {path} ({os.path.getsize(path)} bytes)")
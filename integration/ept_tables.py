@@ -0,0 +1,121 @@
+"""
+Packed EPT Tables
+
+Landing probabilities, rents and per-square EPT packed into flat
+array('d') buffers, indexed by board position (and development level
+for rent/EPT: index = position * 7 + level, levels as in RENT_TABLE).
+
+The buffers support the buffer protocol, so research code can wrap them
+without copying:
+
+    import numpy as np
+    tables = EPTTables.from_markov_cache()
+    probs = np.frombuffer(tables.probabilities, dtype=np.float64)
+    ept = np.frombuffer(tables.ept, dtype=np.float64).reshape(40, 7)
+
+Ownership EPT (what BoardMapper.calculate_ept returns) depends only on
+the set of owned squares, so it is computed once per ownership bitmask
+and cached.
+"""
+
+import json
+import os
+from array import array
+from functools import lru_cache
+
+from board_mapping import (
+    LANDING_PROBABILITIES, RENT_TABLE, PROPERTY_PRICES,
+    POSITION_TO_GROUP, GROUP_PROPERTIES
+)
+
+BOARD_SIZE = 40
+RENT_LEVELS = 7  # base, monopoly, 1-4 houses, hotel
+DEFAULT_PROBABILITY = 0.025
+
+# Markov/EPT cache written by research/simulation/cached-engines.js
+MARKOV_CACHE_FILE = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    '..', 'research', 'simulation', '.markov-cache.json'
+)
+
+
+def ownership_mask(positions) -> int:
+    """Pack a set of owned board positions into a 40-bit integer."""
+    mask = 0
+    for pos in positions:
+        if 0 <= pos < BOARD_SIZE:
+            mask |= 1 << pos
+    return mask
+
+
+class EPTTables:
+    """Flat per-square probability, rent and EPT tables."""
+
+    def __init__(self, probabilities=None):
+        """
+        Args:
+            probabilities: dict or 40-length sequence of landing probabilities.
+                Defaults to board_mapping.LANDING_PROBABILITIES (~2.5% for
+                squares it doesn't list), matching BoardMapper.
+        """
+        if probabilities is None:
+            probabilities = LANDING_PROBABILITIES
+        if isinstance(probabilities, dict):
+            values = [probabilities.get(pos, DEFAULT_PROBABILITY) for pos in range(BOARD_SIZE)]
+        else:
+            values = list(probabilities)
+            if len(values) != BOARD_SIZE:
+                raise ValueError(f"Expected {BOARD_SIZE} probabilities, got {len(values)}")
+
+        self.probabilities = array('d', values)
+        self.rent = array('d', [0.0]) * (BOARD_SIZE * RENT_LEVELS)
+        self.ept = array('d', [0.0]) * (BOARD_SIZE * RENT_LEVELS)
+
+        for pos, rents in RENT_TABLE.items():
+            for level, rent in enumerate(rents):
+                idx = pos * RENT_LEVELS + level
+                self.rent[idx] = rent
+                self.ept[idx] = self.probabilities[pos] * rent
+
+        # Squares BoardMapper knows about, and each group's bitmask
+        self._priced_squares = tuple(sorted(PROPERTY_PRICES))
+        self._group_masks = {
+            group: ownership_mask(squares) for group, squares in GROUP_PROPERTIES.items()
+        }
+        self._square_group_mask = {
+            pos: self._group_masks[POSITION_TO_GROUP[pos]] for pos in self._priced_squares
+        }
+
+        self._ownership_ept = lru_cache(maxsize=8192)(self._compute_ownership_ept)
+
+    @classmethod
+    def from_markov_cache(cls, path=MARKOV_CACHE_FILE, jail_strategy='stay'):
+        """Build tables from the exact Markov steady state used by the JS engine."""
+        with open(path, 'r') as f:
+            data = json.load(f)
+        return cls(data['steadyState'][jail_strategy])
+
+    def property_ept(self, position: int, level: int) -> float:
+        """EPT of one square at a development level, per opponent."""
+        return self.ept[position * RENT_LEVELS + level]
+
+    def _compute_ownership_ept(self, mask: int) -> float:
+        total = 0.0
+        for pos in self._priced_squares:
+            if not (mask >> pos) & 1:
+                continue
+            group_mask = self._square_group_mask[pos]
+            level = 1 if (mask & group_mask) == group_mask else 0
+            total += self.ept[pos * RENT_LEVELS + level]
+        return total
+
+    def ownership_ept(self, owned_positions, num_opponents: int = 3) -> float:
+        """
+        EPT of an undeveloped holding: base rent, doubled on monopolies.
+        Same result as the loop BoardMapper.calculate_ept used to run.
+        """
+        return self._ownership_ept(ownership_mask(owned_positions)) * num_opponents
+
+    def cache_info(self):
+        """Hit/miss statistics for the ownership EPT cache."""
+        return self._ownership_ept.cache_info()
@@ -19,6 +19,7 @@ from selenium.webdriver.support import expected_conditions as EC
 from selenium.common.exceptions import TimeoutException, NoSuchElementException
 
 from strategic_ai import PlayerState, GameState, TradeOffer
+from state_sync import StateSynchronizer
 
 logger = logging.getLogger(__name__)
 
@@ -81,17 +82,69 @@ class GameStateExtractor:
     clean GameState objects to the AI.
     """
 
-    def __init__(self, driver: webdriver.Firefox, my_player_id: str = "me"):
+    # Text/classes of everything the full scrape reads; if none of it
+    # changed since the last poll, the full scrape is skipped
+    FINGERPRINT_SCRIPT = """
+        return Array.from(document.querySelectorAll(
+            "[class*='player'], [class*='cash'], [class*='money'], [class*='owned'], " +
+            "[class*='jail'], [class*='turn'], [class*='current']"
+        )).map(e => e.className + ':' + e.textContent).join('|');
+    """
+
+    def __init__(self, driver: webdriver.Firefox, my_player_id: str = "me",
+                 full_scrape_interval: int = 20):
         self.driver = driver
         self.my_player_id = my_player_id
         self.wait = WebDriverWait(driver, 5)
 
+        # Canonical state, updated in place from each scrape
+        self.sync = StateSynchronizer()
+        self.last_deltas = []
+        self._last_fingerprint = None
+        self._polls_since_full = 0
+        self.full_scrape_interval = full_scrape_interval
+
     def extract_state(self) -> Optional[GameState]:
         """
-        Extract complete game state from current page.
+        Return the canonical game state, refreshed from the page.
+
+        A cheap page fingerprint is checked first; the per-field scrape only
+        runs when it changed (or every full_scrape_interval polls as a safety
+        net). Changes are applied as deltas, see state_sync.py. The returned
+        object is the same GameState on every call.
 
         Returns None if unable to extract state (e.g., game not loaded).
         """
+        fingerprint = self._page_fingerprint()
+        self._polls_since_full += 1
+        if (self.sync.state is not None and fingerprint is not None
+                and fingerprint == self._last_fingerprint
+                and self._polls_since_full < self.full_scrape_interval):
+            self.last_deltas = []
+            self.sync.changed = False
+            return self.sync.state
+
+        snapshot = self._scrape_state()
+        if snapshot is None:
+            return None
+
+        self.last_deltas = self.sync.update(snapshot)
+        self._last_fingerprint = fingerprint
+        self._polls_since_full = 0
+        if self.last_deltas:
+            logger.debug(f"State deltas: {self.last_deltas}")
+        return self.sync.state
+
+    def _page_fingerprint(self) -> Optional[str]:
+        """Single round-trip summary of the page regions we scrape."""
+        try:
+            return self.driver.execute_script(self.FINGERPRINT_SCRIPT)
+        except Exception as e:
+            logger.debug(f"Fingerprint failed, doing full scrape: {e}")
+            return None
+
+    def _scrape_state(self) -> Optional[GameState]:
+        """Scrape a complete snapshot of the game state from the page."""
         try:
             my_state = self._extract_my_state()
             opponents = self._extract_opponents()
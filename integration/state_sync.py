@@ -0,0 +1,258 @@
+"""
+Incremental Game-State Synchronization
+
+Keeps one canonical GameState for the live bot and updates it in place
+from each poll, instead of handing the AI a freshly rebuilt state every
+tick. Each update is reduced to a list of deltas (cash changes, ownership
+transfers, house counts, mortgages, moves, jail), and derived features
+(property EPT, monopolies, net worth) are recomputed only for the players
+a delta touched.
+
+Usage:
+    sync = StateSynchronizer()
+    deltas = sync.update(scraped_state)     # full snapshot from the extractor
+    sync.apply([Delta('cash', 'opp_1', -200)])   # or event-style updates
+    if sync.changed:
+        ai.should_buy_property(sync.state, ...)
+"""
+
+from dataclasses import dataclass, field
+from typing import Any, Dict, List, Optional
+
+from board_mapping import BoardMapper, GROUP_PROPERTIES
+from strategic_ai import PlayerState, GameState, StrategicAI
+
+
+@dataclass
+class Delta:
+    """
+    One change to the canonical state.
+
+    kind: 'cash'      value = signed change
+          'acquire'   value = position (gained; source = previous owner or None)
+          'release'   value = position (lost to the bank)
+          'houses'    value = (position, new count)
+          'mortgage'  value = (position, mortgaged?)
+          'move'      value = new position
+          'jail'      value = in jail?
+          'player'    value = 'joined' / 'left'
+    """
+    kind: str
+    player_id: str
+    value: Any
+    source: Optional[str] = None
+
+
+@dataclass
+class DerivedFeatures:
+    """Cached per-player features, valid until the player is marked dirty."""
+    ept: float = 0.0
+    monopolies: List[str] = field(default_factory=list)
+    net_worth: int = 0
+
+
+class StateSynchronizer:
+    """Canonical state plus dirty-tracked derived features."""
+
+    def __init__(self, ai: Optional[StrategicAI] = None):
+        self.ai = ai or StrategicAI()
+        self.board: BoardMapper = self.ai.board
+        self.state: Optional[GameState] = None
+        self.changed = False
+
+        self._derived: Dict[str, DerivedFeatures] = {}
+        self._dirty = set()
+        self._num_opponents = None
+
+        # For tests/diagnostics: how many per-player recomputes happened
+        self.recomputes = 0
+
+    # ============== SNAPSHOT DIFFING ==============
+
+    def update(self, snapshot: GameState) -> List[Delta]:
+        """
+        Bring the canonical state in line with a full snapshot.
+        Returns the deltas that were applied (empty if nothing changed).
+        """
+        if self.state is None:
+            self.state = self._copy_state(snapshot)
+            self._dirty = {p.player_id for p in self._players()}
+            self.changed = True
+            return [Delta('player', p.player_id, 'joined') for p in self._players()]
+
+        deltas = self.diff(snapshot)
+
+        # Turn bookkeeping doesn't feed derived features
+        self.state.current_turn = snapshot.current_turn
+        self.state.turn_number = snapshot.turn_number
+        self.state.available_houses = snapshot.available_houses
+        self.state.available_hotels = snapshot.available_hotels
+
+        self.apply(deltas)
+        return deltas
+
+    def diff(self, snapshot: GameState) -> List[Delta]:
+        """Deltas that turn the canonical state into the snapshot."""
+        deltas = []
+        old = {p.player_id: p for p in self._players()}
+        new = {p.player_id: p for p in [snapshot.my_state] + list(snapshot.opponents)}
+
+        for pid in old.keys() - new.keys():
+            deltas.append(Delta('player', pid, 'left'))
+        for pid in new.keys() - old.keys():
+            deltas.append(Delta('player', pid, 'joined', source=new[pid]))
+
+        # Ownership: pair each gain with whoever lost that square
+        lost_by = {}
+        for pid, before in old.items():
+            after = new.get(pid)
+            if after is None:
+                continue
+            for pos in before.properties - after.properties:
+                lost_by[pos] = pid
+
+        for pid, after in new.items():
+            before = old.get(pid)
+            if before is None:
+                continue
+
+            if after.cash != before.cash:
+                deltas.append(Delta('cash', pid, after.cash - before.cash))
+
+            for pos in sorted(after.properties - before.properties):
+                deltas.append(Delta('acquire', pid, pos, source=lost_by.pop(pos, None)))
+
+            for pos in sorted(set(before.houses) | set(after.houses)):
+                if before.houses.get(pos, 0) != after.houses.get(pos, 0):
+                    deltas.append(Delta('houses', pid, (pos, after.houses.get(pos, 0))))
+
+            for pos in sorted(before.mortgaged ^ after.mortgaged):
+                deltas.append(Delta('mortgage', pid, (pos, pos in after.mortgaged)))
+
+            if after.position != before.position:
+                deltas.append(Delta('move', pid, after.position))
+            if after.in_jail != before.in_jail:
+                deltas.append(Delta('jail', pid, after.in_jail))
+
+        # Squares that went back to the bank
+        for pos, pid in sorted(lost_by.items()):
+            deltas.append(Delta('release', pid, pos))
+
+        return deltas
+
+    # ============== DELTA APPLICATION ==============
+
+    def apply(self, deltas: List[Delta]):
+        """Apply deltas to the canonical state and mark affected players dirty."""
+        self.changed = bool(deltas)
+        if not deltas:
+            return
+
+        players = {p.player_id: p for p in self._players()}
+
+        for d in deltas:
+            if d.kind == 'player':
+                if d.value == 'joined':
+                    joined = d.source or PlayerState(player_id=d.player_id, cash=1500)
+                    self.state.opponents.append(self._copy_player(joined))
+                    players[d.player_id] = self.state.opponents[-1]
+                else:
+                    self.state.opponents = [o for o in self.state.opponents if o.player_id != d.player_id]
+                    players.pop(d.player_id, None)
+                    self._derived.pop(d.player_id, None)
+                continue
+
+            player = players[d.player_id]
+            self._dirty.add(d.player_id)
+
+            if d.kind == 'cash':
+                player.cash += d.value
+            elif d.kind == 'acquire':
+                # Houses and mortgages arrive as their own deltas for both sides
+                if d.source in players:
+                    players[d.source].properties.discard(d.value)
+                    self._dirty.add(d.source)
+                player.properties.add(d.value)
+            elif d.kind == 'release':
+                player.properties.discard(d.value)
+                player.houses.pop(d.value, None)
+                player.mortgaged.discard(d.value)
+            elif d.kind == 'houses':
+                pos, count = d.value
+                if count:
+                    player.houses[pos] = count
+                else:
+                    player.houses.pop(pos, None)
+            elif d.kind == 'mortgage':
+                pos, mortgaged = d.value
+                if mortgaged:
+                    player.mortgaged.add(pos)
+                else:
+                    player.mortgaged.discard(pos)
+            elif d.kind == 'move':
+                player.position = d.value
+            elif d.kind == 'jail':
+                player.in_jail = d.value
+            else:
+                raise ValueError(f"Unknown delta kind: {d.kind}")
+
+    # ============== DERIVED FEATURES ==============
+
+    def features(self, player_id: str) -> DerivedFeatures:
+        """Derived features for a player, recomputed only if dirty."""
+        self._refresh()
+        return self._derived[player_id]
+
+    def relative_ept(self) -> float:
+        """Same value as StrategicAI.calculate_relative_ept, from cached EPTs."""
+        self._refresh()
+        players = self._players()
+        total = sum(self._derived[p.player_id].ept for p in players)
+        return self._derived[self.state.my_state.player_id].ept - total / len(players)
+
+    def _refresh(self):
+        num_opponents = len(self.state.opponents)
+        if num_opponents != self._num_opponents:
+            # EPT scales with opponent count: everything is stale
+            self._num_opponents = num_opponents
+            self._dirty = {p.player_id for p in self._players()}
+
+        for player in self._players():
+            pid = player.player_id
+            if pid not in self._dirty and pid in self._derived:
+                continue
+            self._derived[pid] = DerivedFeatures(
+                ept=self.board.calculate_ept(player.properties, num_opponents),
+                monopolies=[g for g in GROUP_PROPERTIES if self.board.has_monopoly(player.properties, g)],
+                net_worth=self.ai.calculate_net_worth(player)
+            )
+            self.recomputes += 1
+
+        self._dirty.clear()
+
+    # ============== HELPERS ==============
+
+    def _players(self) -> List[PlayerState]:
+        return [self.state.my_state] + list(self.state.opponents)
+
+    @staticmethod
+    def _copy_player(p: PlayerState) -> PlayerState:
+        return PlayerState(
+            player_id=p.player_id,
+            cash=p.cash,
+            properties=set(p.properties),
+            position=p.position,
+            in_jail=p.in_jail,
+            mortgaged=set(p.mortgaged),
+            houses=dict(p.houses)
+        )
+
+    def _copy_state(self, s: GameState) -> GameState:
+        return GameState(
+            my_state=self._copy_player(s.my_state),
+            opponents=[self._copy_player(o) for o in s.opponents],
+            current_turn=s.current_turn,
+            turn_number=s.turn_number,
+            available_houses=s.available_houses,
+            available_hotels=s.available_hotels
+        )
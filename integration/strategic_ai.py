@@ -64,7 +64,7 @@ class StrategicAI:
     Trade quality filter based on empirical win rates.
     """
 
-    def __init__(self):
+    def __init__(self, decision_table=None):
         self.board = BoardMapper()
 
         # Parameters from EnhancedRelativeAI
@@ -78,6 +78,18 @@ class StrategicAI:
         self.min_quality_ratio = 0.85  # Accept if our quality >= 85% of theirs
         self.max_quality_ratio = 1.40  # Reject if they get >40% better
 
+        # Optional precomputed table for the hot live decisions (decision_tables.py).
+        # Lookups that fall off-table are evaluated in full below.
+        self.decision_table = None
+        if decision_table is not None:
+            self.use_decision_table(decision_table)
+
+    def use_decision_table(self, table):
+        """Attach a DecisionTable; it must have been built with these parameters."""
+        if not table.matches(self):
+            raise ValueError("Decision table was built with different AI parameters")
+        self.decision_table = table
+
     def calculate_net_worth(self, player: PlayerState) -> int:
         """Calculate player's total net worth."""
         worth = player.cash
@@ -148,6 +160,11 @@ class StrategicAI:
         - Does it block an opponent's monopoly?
         - What's the EPT value?
         """
+        if self.decision_table is not None:
+            decision = self.decision_table.should_buy(state, position, price)
+            if decision is not None:
+                return decision
+
         player = state.my_state
 
         # Must have minimum cash after purchase
@@ -192,6 +209,37 @@ class StrategicAI:
         Paying 5% premium dominates, but 20% overextends.
         """
         player = state.my_state
+
+        max_bid = None
+        if self.decision_table is not None:
+            max_bid = self.decision_table.auction_bid_cap(state, position)
+        if max_bid is None:
+            max_bid = self.auction_bid_cap(state, position)
+
+        # Debt constraint
+        net_worth = self.calculate_net_worth(player)
+        max_debt = min(self.max_absolute_debt, int(net_worth * self.max_debt_ratio))
+        current_debt = sum(PROPERTY_PRICES.get(p, 0) // 2 for p in player.mortgaged)
+        available_debt = max_debt - current_debt
+
+        # Can't bid more than cash + available debt room
+        affordable = player.cash + available_debt - self.absolute_min_cash
+        max_bid = min(max_bid, affordable)
+
+        # Only bid if we can beat current bid
+        if max_bid <= current_bid:
+            return 0  # Pass
+
+        # Bid incrementally above current
+        bid = current_bid + 10
+        return min(bid, max_bid)
+
+    def auction_bid_cap(self, state: GameState, position: int) -> int:
+        """
+        Most we'd pay for a property before cash and debt limits:
+        face value + premium, raised for monopoly completion and blocking.
+        """
+        player = state.my_state
         price = PROPERTY_PRICES.get(position, 100)
         group = POSITION_TO_GROUP.get(position)
 
@@ -219,23 +267,7 @@ class StrategicAI:
                     max_bid = int(max_bid * 1.3)
                 break
 
-        # Debt constraint
-        net_worth = self.calculate_net_worth(player)
-        max_debt = min(self.max_absolute_debt, int(net_worth * self.max_debt_ratio))
-        current_debt = sum(PROPERTY_PRICES.get(p, 0) // 2 for p in player.mortgaged)
-        available_debt = max_debt - current_debt
-
-        # Can't bid more than cash + available debt room
-        affordable = player.cash + available_debt - self.absolute_min_cash
-        max_bid = min(max_bid, affordable)
-
-        # Only bid if we can beat current bid
-        if max_bid <= current_bid:
-            return 0  # Pass
-
-        # Bid incrementally above current
-        bid = current_bid + 10
-        return min(bid, max_bid)
+        return max_bid
 
     # ============== TRADE DECISIONS ==============
 
@@ -25,6 +25,7 @@ from selenium.common.exceptions import (
 
 from strategic_ai import StrategicAI, GameState, TradeOffer
 from game_state_extractor import GameStateExtractor, GameLocators
+from decision_tables import DecisionTable
 
 logger = logging.getLogger(__name__)
 
@@ -58,12 +59,21 @@ class StrategicBot:
         self.driver = driver
         self.player_id = player_id
         self.ai = StrategicAI()
+        self._load_decision_table()
         self.extractor = GameStateExtractor(driver, player_id)
         self.config = BotConfig()
 
         self.game_start_time = None
         self.turn_count = 0
 
+    def _load_decision_table(self):
+        """Use precomputed decisions, building decision_tables.bin on first use."""
+        try:
+            self.ai.use_decision_table(DecisionTable.open(self.ai))
+            logger.info("Loaded precomputed decision table")
+        except OSError as e:
+            logger.warning(f"No decision table ({e}), evaluating decisions in full")
+
     def _human_delay(self, min_delay: float = None, max_delay: float = None):
         """Add human-like random delay between actions."""
         min_d = min_delay or self.config.MIN_ACTION_DELAY
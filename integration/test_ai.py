@@ -5,7 +5,8 @@ Verifies that the Python AI makes the same decisions as the JavaScript version.
 """
 
 from strategic_ai import StrategicAI, PlayerState, GameState, TradeOffer
-from board_mapping import GROUP_QUALITY, POSITION_TO_GROUP, GROUP_PROPERTIES
+from board_mapping import GROUP_QUALITY, POSITION_TO_GROUP, GROUP_PROPERTIES, BoardMapper
+from ept_tables import EPTTables
 
 
 def test_monopoly_quality():
@@ -258,6 +259,162 @@ def test_building_priority():
     print("[PASS] Building priority tests passed")
 
 
+def test_ept_tables():
+    """Test packed EPT tables against the direct per-property calculation."""
+    import random
+
+    board = BoardMapper()
+
+    def reference_ept(owned, num_opponents):
+        total = 0
+        for pos in owned:
+            prop = board.properties.get(pos)
+            if not prop:
+                continue
+            level = 1 if board.has_monopoly(owned, prop.group) else 0
+            total += prop.get_landing_probability() * prop.get_rent(level) * num_opponents
+        return total
+
+    rng = random.Random(42)
+    squares = sorted(board.properties)
+    for _ in range(500):
+        owned = set(rng.sample(squares, rng.randint(0, 12)))
+        n = rng.randint(1, 5)
+        expected = reference_ept(owned, n)
+        got = board.calculate_ept(owned, n)
+        assert abs(got - expected) < 1e-9, f"EPT mismatch for {sorted(owned)}: {got} vs {expected}"
+
+    # Repeated holdings are served from the cache
+    board.calculate_ept({16, 18, 19}, 3)
+    board.calculate_ept({16, 18, 19}, 2)
+    assert board.ept_tables.cache_info().hits > 0
+
+    # Exact Markov tables expose flat float64 buffers
+    tables = EPTTables.from_markov_cache()
+    view = memoryview(tables.probabilities)
+    assert view.format == 'd' and view.nbytes == 40 * 8
+    assert abs(sum(tables.probabilities) - 1.0) < 1e-6
+    assert tables.property_ept(24, 0) == tables.probabilities[24] * 20
+
+    print("[PASS] EPT table tests passed")
+
+
+def test_decision_tables():
+    """Test precomputed decision tables agree with full evaluation."""
+    import os
+    import tempfile
+    from decision_tables import DecisionTable, verify_table
+
+    # Built on first use
+    path = os.path.join(tempfile.mkdtemp(), 'decision_tables.bin')
+    DecisionTable.open(path=path).close()
+    assert os.path.exists(path)
+
+    checked, off_table, mismatches = verify_table(path, samples=2000)
+    assert mismatches == 0, f"{mismatches} table decisions differ from full evaluation"
+    assert off_table < checked // 3, "Too many lookups fell off-table"
+
+    # Tables built for other parameters are refused
+    ai = StrategicAI()
+    ai.base_bid_premium = 0.20
+    try:
+        ai.use_decision_table(DecisionTable(path))
+        assert False, "Mismatched table should be rejected"
+    except ValueError:
+        pass
+
+    # ...and rebuilt when opened for an AI with other parameters
+    table = DecisionTable.open(ai, path)
+    assert table.matches(ai)
+    ai.use_decision_table(table)
+    table.close()
+
+    print(f"[PASS] Decision table tests passed ({checked} decisions checked)")
+
+
+def test_state_sync():
+    """Test incremental state sync: deltas, in-place updates, dirty recompute."""
+    import copy
+    from state_sync import StateSynchronizer
+
+    ai = StrategicAI()
+    sync = StateSynchronizer(ai)
+
+    me = PlayerState("me", 1200, properties={16, 18}, mortgaged=set())
+    opp_a = PlayerState("a", 900, properties={19, 21, 23, 24})
+    opp_b = PlayerState("b", 1100, properties={1, 3, 5})
+    snapshot = GameState(my_state=me, opponents=[opp_a, opp_b], current_turn="me")
+
+    sync.update(snapshot)
+    canonical = sync.state
+    assert abs(sync.relative_ept() - ai.calculate_relative_ept(snapshot)) < 1e-9
+    assert sync.recomputes == 3
+
+    # Nothing changed: no deltas, no recompute
+    assert sync.update(copy.deepcopy(snapshot)) == []
+    assert not sync.changed
+    sync.relative_ept()
+    assert sync.recomputes == 3
+
+    # 'a' trades New York to 'me' for $300; 'b' builds a house
+    nxt = copy.deepcopy(snapshot)
+    nxt.my_state.properties.add(19)
+    nxt.my_state.cash -= 300
+    nxt.opponents[0].properties.discard(19)
+    nxt.opponents[0].cash += 300
+    nxt.opponents[1].houses[1] = 1
+    nxt.opponents[1].cash -= 50
+
+    deltas = sync.update(nxt)
+    kinds = sorted(d.kind for d in deltas)
+    assert kinds == ['acquire', 'cash', 'cash', 'cash', 'houses'], kinds
+    acquire = next(d for d in deltas if d.kind == 'acquire')
+    assert acquire.player_id == "me" and acquire.value == 19 and acquire.source == "a"
+
+    # Same object, updated in place to match the snapshot
+    assert sync.state is canonical
+    assert sync.state.my_state == nxt.my_state and sync.state.opponents == nxt.opponents
+
+    # Only 'me' and 'a' (ownership) and 'b' (houses/cash) were dirty
+    before = sync.recomputes
+    assert abs(sync.relative_ept() - ai.calculate_relative_ept(nxt)) < 1e-9
+    assert sync.recomputes == before + 3
+    assert 'orange' in sync.features("me").monopolies
+
+    # Cash-only change recomputes just that player
+    nxt2 = copy.deepcopy(nxt)
+    nxt2.opponents[1].cash += 200
+    sync.update(nxt2)
+    before = sync.recomputes
+    sync.relative_ept()
+    assert sync.recomputes == before + 1
+
+    # Traded mortgaged square: 'b' gives mortgaged Reading RR, 'me' unmortgages it on transfer
+    nxt3 = copy.deepcopy(nxt2)
+    nxt3.opponents[1].mortgaged.add(5)
+    sync.update(nxt3)
+    nxt4 = copy.deepcopy(nxt3)
+    nxt4.opponents[1].properties.discard(5)
+    nxt4.opponents[1].mortgaged.discard(5)
+    nxt4.my_state.properties.add(5)
+    nxt4.my_state.cash -= 110
+    sync.update(nxt4)
+    assert sync.state.my_state == nxt4.my_state and sync.state.opponents == nxt4.opponents
+    assert sync.state.my_state.mortgaged == set()
+
+    # ... and kept mortgaged when the receiver doesn't pay it off
+    nxt5 = copy.deepcopy(nxt3)
+    nxt5.opponents[1].properties.discard(5)
+    nxt5.opponents[1].mortgaged.discard(5)
+    nxt5.my_state.properties.add(5)
+    nxt5.my_state.mortgaged.add(5)
+    sync.update(nxt3)
+    sync.update(nxt5)
+    assert sync.state.my_state == nxt5.my_state and sync.state.opponents == nxt5.opponents
+
+    print("[PASS] State sync tests passed")
+
+
 def run_all_tests():
     """Run all AI tests."""
     print("=" * 50)
@@ -272,6 +429,9 @@ def run_all_tests():
     test_auction_bidding()
     test_relative_ept()
     test_building_priority()
+    test_ept_tables()
+    test_decision_tables()
+    test_state_sync()
 
     print()
     print("=" * 50)
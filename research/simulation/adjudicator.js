@@ -0,0 +1,237 @@
+/**
+ * Game Adjudication
+ *
+ * Stops games whose outcome is already settled. Tournament time goes
+ * mostly to long tails: one player holds developed monopolies while the
+ * rest bleed out, or a frozen board runs to maxTurns. At checkpoints the
+ * adjudicator estimates each player's win probability and ends the game
+ * once a player's estimate reaches the confidence threshold. It also
+ * declares a stalemate once the board hasn't changed for stallRounds
+ * rounds.
+ *
+ * ESTIMATORS
+ *   'table'   (default) the heads-up endgame tablebase (endgame-tablebase.js).
+ *             With more than two players left, each pair is probed as if
+ *             heads-up and a player's score is the product of its pairwise
+ *             win probabilities, normalized across players.
+ *   function  (engine) => array of P(win) by player id, e.g. a rollout
+ *             sampler or a learned model.
+ *
+ * Enabled through the engine:
+ *   new GameEngine({ adjudicate: { threshold: 0.95, every: 10 } })
+ *   runGame() then returns adjudicated: true and the verdict when it
+ *   stops early. With shadow: true the verdict is recorded but the game is
+ *   played out, which is how the error rate is measured.
+ *
+ * Usage:
+ *   node adjudicator.js --validate 200              # error rate vs full games
+ *   node adjudicator.js --validate 200 --threshold 0.9 --every 5
+ */
+
+'use strict';
+
+const DEFAULTS = {
+    estimator: 'table',
+    threshold: 0.95,     // adjudicate once a player's P(win) reaches this
+    every: 10,           // checkpoint interval, rounds
+    minTurn: 20,         // no verdicts before this round
+    stallRounds: 150,    // stalemate after this many rounds without a property change (0 = off)
+    shadow: false        // record the verdict but keep playing
+};
+
+let tablebase = null;
+
+function getTablebase() {
+    if (!tablebase) {
+        const { EndgameTablebase } = require('./endgame-tablebase.js');
+        tablebase = EndgameTablebase.open();
+    }
+    return tablebase;
+}
+
+class Adjudicator {
+    /**
+     * @param {GameEngine} engine
+     * @param {Object|boolean} options - overrides for DEFAULTS (true = defaults)
+     */
+    constructor(engine, options = {}) {
+        this.engine = engine;
+        this.params = { ...DEFAULTS, ...(options === true ? {} : options) };
+        this.verdict = null;
+
+        this.checkedTurn = -1;
+        this.boardVersion = engine.boardVersion;
+        this.lastChange = 0;
+
+        this.probs = null;
+        this.estimates = 0;
+    }
+
+    /**
+     * Call after every executeTurn(). Checks once per checkpoint round.
+     * @returns {Object|null} the verdict, once one has been reached
+     */
+    check() {
+        if (this.verdict) return this.verdict;
+
+        const state = this.engine.state;
+        if (this.engine.boardVersion !== this.boardVersion) {
+            this.boardVersion = this.engine.boardVersion;
+            this.lastChange = state.turn;
+        }
+
+        const turn = state.turn;
+        if (turn === this.checkedTurn || turn < this.params.minTurn || turn % this.params.every !== 0) {
+            return null;
+        }
+        this.checkedTurn = turn;
+        if (state.isGameOver()) return null;
+
+        const p = this.estimate();
+        let leader = -1;
+        for (let i = 0; i < p.length; i++) {
+            if (leader < 0 || p[i] > p[leader]) leader = i;
+        }
+
+        if (p[leader] >= this.params.threshold) {
+            this.verdict = { winner: leader, confidence: p[leader], turn, reason: 'confidence' };
+        } else if (this.params.stallRounds > 0 && turn - this.lastChange >= this.params.stallRounds) {
+            this.verdict = { winner: null, confidence: 1 - p[leader], turn, reason: 'stall' };
+        }
+        return this.verdict;
+    }
+
+    /** P(win) by player id; bankrupt players get 0 */
+    estimate() {
+        this.estimates++;
+        const estimator = this.params.estimator;
+        if (typeof estimator === 'function') return estimator(this.engine);
+        if (estimator === 'table') return this.tableEstimate();
+        throw new Error(`Unknown adjudication estimator: ${estimator}`);
+    }
+
+    tableEstimate() {
+        const { EndgameTablebase } = require('./endgame-tablebase.js');
+        const tb = getTablebase();
+        const state = this.engine.state;
+        const probs = this.landingProbs();
+        const active = state.getActivePlayers();
+
+        const side = active.map(player => {
+            const profile = EndgameTablebase.sideProfile(this.engine, player.id, probs);
+            return {
+                id: player.id,
+                profile: tb.profileIndex(profile.hit, profile.rent),
+                worth: EndgameTablebase.liquidWorth(state, player)
+            };
+        });
+
+        // Pairwise heads-up probes, averaged over who moves first
+        const score = side.map(() => 1);
+        for (let i = 0; i < side.length; i++) {
+            for (let j = i + 1; j < side.length; j++) {
+                const a = side[i], b = side[j];
+                const pij = 0.5 * (tb.value(a.profile, b.profile, a.worth, b.worth) +
+                    1 - tb.value(b.profile, a.profile, b.worth, a.worth));
+                score[i] *= pij;
+                score[j] *= 1 - pij;
+            }
+        }
+
+        const total = score.reduce((s, x) => s + x, 0);
+        const p = new Array(state.players.length).fill(0);
+        for (let i = 0; i < side.length; i++) {
+            p[side[i].id] = total > 0 ? score[i] / total : 1 / side.length;
+        }
+        return p;
+    }
+
+    /** Landing probabilities from any AI that has them (uniform otherwise) */
+    landingProbs() {
+        if (!this.probs) {
+            const ai = this.engine.state.players.map(p => p.ai).find(ai => ai && ai.probs);
+            this.probs = ai ? ai.probs : null;
+        }
+        return this.probs;
+    }
+}
+
+module.exports = { Adjudicator, DEFAULTS };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const { GameEngine } = require('./game-engine.js');
+    const { createRunner, quietly } = require('./harness.js');
+    const { withSeed } = require('./seeded-random.js');
+
+    const args = process.argv.slice(2);
+    const options = { validate: 100, seed: 1, threshold: DEFAULTS.threshold, every: DEFAULTS.every };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--validate': options.validate = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--threshold': options.threshold = parseFloat(args[++i]); break;
+            case '--every': options.every = parseInt(args[++i], 10); break;
+        }
+    }
+
+    const runner = createRunner({ maxTurns: 500 });
+    getTablebase();
+
+    const lineup = ['strategic', 'optimal', 'relative', 'growth'];
+    const tally = { games: 0, adjudicated: 0, wrong: 0, stalls: 0, wrongStalls: 0, fullTurns: 0, adjudicatedTurns: 0 };
+
+    console.log(`Validating adjudication (threshold ${options.threshold}, every ${options.every} rounds) ` +
+        `on ${options.validate} games...`);
+    const play = (seed, adjudicate) => withSeed(seed, () => {
+        const engine = new GameEngine({ maxTurns: 500, adjudicate });
+        engine.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+        return quietly(() => engine.runGame());
+    });
+    const adjudicate = { threshold: options.threshold, every: options.every };
+
+    // Shadow pass: verdicts vs the played-out results
+    const shadowStart = Date.now();
+    for (let g = 0; g < options.validate; g++) {
+        const result = play(options.seed + g, { ...adjudicate, shadow: true });
+
+        tally.games++;
+        tally.fullTurns += result.turns;
+        const verdict = result.adjudication;
+        if (verdict) {
+            tally.adjudicated++;
+            tally.adjudicatedTurns += verdict.turn;
+            if (verdict.winner !== result.winner) tally.wrong++;
+            if (verdict.reason === 'stall') {
+                tally.stalls++;
+                if (result.winner !== null) tally.wrongStalls++;
+            }
+        } else {
+            tally.adjudicatedTurns += result.turns;
+        }
+    }
+
+    const fullSeconds = (Date.now() - shadowStart) / 1000;
+
+    // Live pass: same games, stopped at the verdict
+    const liveStart = Date.now();
+    for (let g = 0; g < options.validate; g++) play(options.seed + g, adjudicate);
+    const liveSeconds = (Date.now() - liveStart) / 1000;
+
+    const pct = (x, n) => n > 0 ? (100 * x / n).toFixed(1) + '%' : '-';
+    console.log(`\n  Adjudicated:       ${tally.adjudicated}/${tally.games} (${pct(tally.adjudicated, tally.games)})`);
+    console.log(`    by confidence:   ${tally.adjudicated - tally.stalls}, ` +
+        `wrong ${tally.wrong - tally.wrongStalls} (${pct(tally.wrong - tally.wrongStalls, tally.adjudicated - tally.stalls)})`);
+    console.log(`    as stalemate:    ${tally.stalls}, ` +
+        `wrong ${tally.wrongStalls} (${pct(tally.wrongStalls, tally.stalls)})`);
+    console.log(`  Error rate:        ${pct(tally.wrong, tally.adjudicated)} of adjudicated, ` +
+        `${pct(tally.wrong, tally.games)} of all games`);
+    console.log(`  Turns simulated:   ${tally.adjudicatedTurns} vs ${tally.fullTurns} played out ` +
+        `(${(tally.fullTurns / tally.adjudicatedTurns).toFixed(2)}x fewer)`);
+    console.log(`  Throughput:        ${(tally.games / liveSeconds).toFixed(1)} games/sec adjudicated vs ` +
+        `${(tally.games / fullSeconds).toFixed(1)} played out ` +
+        `(${(fullSeconds / liveSeconds).toFixed(2)}x)`);
+}
@@ -0,0 +1,467 @@
+/**
+ * Async Game Engine
+ *
+ * GameEngine variant whose seats are awaitable decision sources, so one
+ * process can host many games at once: while a game waits on a remote bot
+ * or a human, the event loop runs the others.
+ *
+ * A decision source implements any of:
+ *   decideBuy(position, state)            -> boolean | Promise<boolean>
+ *   decideBid(position, highBid, state)   -> number  | Promise<number>
+ *   getReservationBid(position, state)    -> rule | null (see auction-resolver.js)
+ *   decideJail(state)                     -> boolean | Promise<boolean>
+ *   preTurn(state) / postTurn(state)      -> void    | Promise<void>
+ *
+ * Sources provided here:
+ *   LocalAISource - wraps an existing (synchronous) AI; never yields
+ *   RemoteSource  - forwards decisions over a transport (see scripted-server.js)
+ *   HumanSource   - asks a prompt function (e.g. readline) for each decision
+ *
+ * Game rules are the base engine's. Only the turn flow that reaches a
+ * decision point (turn, jail, doubles loop, purchase, auction) is async;
+ * landings and card effects still run through the synchronous handlers,
+ * with purchase decisions deferred until they return. With local AIs and
+ * the same seed, an async game plays out identically to GameEngine.runGame().
+ *
+ * Remote and human seats have no in-process AI object, so AI-initiated
+ * trades skip them (the AIs already guard on otherPlayer.ai).
+ */
+
+'use strict';
+
+const { GameEngine, BOARD } = require('./game-engine.js');
+const { resolveAuctionAsync } = require('./auction-resolver.js');
+
+// Resolve a decision that may or may not be a promise without forcing a tick
+function isThenable(value) {
+    return value !== null && typeof value === 'object' && typeof value.then === 'function';
+}
+
+// =============================================================================
+// DECISION SOURCES
+// =============================================================================
+
+/**
+ * Wraps a synchronous AI (anything createAIFactory returns)
+ */
+class LocalAISource {
+    constructor(ai) {
+        this.ai = ai;
+        this.kind = 'local';
+    }
+
+    decideBuy(position, state) {
+        return this.ai.decideBuy ? this.ai.decideBuy(position, state) : null;
+    }
+
+    decideBid(position, highBid, state) {
+        return this.ai.decideBid ? this.ai.decideBid(position, highBid, state) : null;
+    }
+
+    getReservationBid(position, state) {
+        return this.ai.getReservationBid ? this.ai.getReservationBid(position, state) : null;
+    }
+
+    decideJail(state) {
+        return this.ai.decideJail ? this.ai.decideJail(state) : false;
+    }
+
+    preTurn(state) {
+        if (this.ai.preTurn) this.ai.preTurn(state);
+    }
+
+    postTurn(state) {
+        if (this.ai.postTurn) this.ai.postTurn(state);
+    }
+}
+
+/**
+ * Compact, JSON-safe summary of the state sent with each remote decision
+ */
+function summarizeState(state) {
+    return {
+        turn: state.turn,
+        phase: state.phase,
+        players: state.players.map(p => ({
+            id: p.id,
+            money: p.money,
+            position: p.position,
+            inJail: p.inJail,
+            jailTurns: p.jailTurns,
+            bankrupt: p.bankrupt,
+            properties: [...p.properties]
+        })),
+        houses: Object.fromEntries(Object.entries(state.propertyStates)
+            .filter(([, ps]) => ps.houses > 0)
+            .map(([sq, ps]) => [sq, ps.houses]))
+    };
+}
+
+/**
+ * Sends each decision as a request over a transport and awaits the reply.
+ * A transport only needs request(message) -> Promise<reply>.
+ */
+class RemoteSource {
+    constructor(transport, gameId, seat) {
+        this.transport = transport;
+        this.gameId = gameId;
+        this.seat = seat;
+        this.kind = 'remote';
+    }
+
+    async ask(type, fields, state) {
+        const reply = await this.transport.request({
+            type,
+            game: this.gameId,
+            seat: this.seat,
+            ...fields,
+            state: summarizeState(state)
+        });
+        return reply.value;
+    }
+
+    decideBuy(position, state) {
+        return this.ask('decideBuy', { position }, state).then(Boolean);
+    }
+
+    decideBid(position, highBid, state) {
+        return this.ask('decideBid', { position, highBid }, state).then(v => Number(v) || 0);
+    }
+
+    decideJail(state) {
+        return this.ask('decideJail', {}, state).then(Boolean);
+    }
+}
+
+/**
+ * Human seat: prompt(question) -> Promise<string>
+ */
+class HumanSource {
+    constructor(prompt, name = 'Human') {
+        this.prompt = prompt;
+        this.name = name;
+        this.kind = 'human';
+    }
+
+    async decideBuy(position, state) {
+        const answer = await this.prompt(`${this.name}: buy ${BOARD[position].name} for $${BOARD[position].price}? [y/n] `);
+        return /^y/i.test(answer.trim());
+    }
+
+    async decideBid(position, highBid, state) {
+        const answer = await this.prompt(`${this.name}: bid on ${BOARD[position].name} (high bid $${highBid}, 0 to pass): `);
+        return parseInt(answer, 10) || 0;
+    }
+
+    async decideJail(state) {
+        const answer = await this.prompt(`${this.name}: pay $50 to leave jail? [y/n] `);
+        return /^y/i.test(answer.trim());
+    }
+}
+
+// =============================================================================
+// ASYNC GAME ENGINE
+// =============================================================================
+
+class AsyncGameEngine extends GameEngine {
+    constructor(options = {}) {
+        super({
+            // Yield to the event loop every N turns so local-only games
+            // don't starve the others (0 = never yield)
+            yieldEvery: 10,
+            ...options
+        });
+        this.sources = [];
+        this.pendingPurchase = null;
+    }
+
+    /**
+     * Initialize a new game.
+     *
+     * @param {number} playerCount
+     * @param {Array} seats - per seat: an AI factory (player, engine) => ai,
+     *                        or a decision source
+     */
+    newGame(playerCount = 4, seats = []) {
+        super.newGame(playerCount, []);
+        this.sources = [];
+        this.pendingPurchase = null;
+
+        for (let i = 0; i < playerCount; i++) {
+            const seat = seats[i];
+            const player = this.state.players[i];
+
+            if (typeof seat === 'function') {
+                player.ai = seat(player, this);
+                this.sources.push(new LocalAISource(player.ai));
+            } else {
+                this.sources.push(seat || null);
+            }
+        }
+    }
+
+    /**
+     * Ask a seat for a decision; falls back to the base engine's default
+     * when the source has no opinion
+     */
+    async decide(player, method, args, fallback) {
+        const source = this.sources[player.id];
+        if (!source || !source[method]) return fallback();
+
+        let value = source[method](...args, this.state);
+        if (isThenable(value)) value = await value;
+        return value === null || value === undefined ? fallback() : value;
+    }
+
+    /**
+     * Synchronous landing handlers reach purchases through here; defer the
+     * decision so the async turn flow can await it.
+     */
+    handlePropertyPurchase(player, position) {
+        this.pendingPurchase = { player, position };
+    }
+
+    /**
+     * Land on a square, then settle any purchase/auction it triggered
+     */
+    async landAsync(player, position, diceRoll) {
+        const result = this.handleLanding(player, position, diceRoll);
+        if (this.pendingPurchase) {
+            const pending = this.pendingPurchase;
+            this.pendingPurchase = null;
+            await this.handlePropertyPurchaseAsync(pending.player, pending.position);
+        }
+        return result;
+    }
+
+    async handlePropertyPurchaseAsync(player, position) {
+        const square = BOARD[position];
+
+        const wantsToBuy = await this.decide(player, 'decideBuy', [position],
+            () => player.money >= square.price);
+
+        if (wantsToBuy && player.money >= square.price) {
+            player.money -= square.price;
+            player.properties.add(position);
+            this.state.propertyStates[position].owner = player.id;
+            this.propertyChanged(position);
+            this.log(`${player.name} bought ${square.name} for $${square.price}`);
+            this.state.stats.propertiesBought[player.id]++;
+        } else {
+            await this.runAuctionAsync(position);
+        }
+    }
+
+    /**
+     * GameEngine.runAuction with awaitable seats: the same shuffle and the
+     * same resolver, so local AIs win the same auctions at the same prices
+     */
+    async runAuctionAsync(position) {
+        const square = BOARD[position];
+
+        const bidders = [...this.state.getActivePlayers()];
+        for (let i = bidders.length - 1; i > 0; i--) {
+            const j = Math.floor(Math.random() * (i + 1));
+            [bidders[i], bidders[j]] = [bidders[j], bidders[i]];
+        }
+
+        const { winner: highBidder, price: highBid } = await resolveAuctionAsync(bidders, position, this.state,
+            { source: player => this.sources[player.id], interactive: this.options.interactiveAuctions });
+
+        if (highBidder) {
+            highBidder.money -= highBid;
+            highBidder.properties.add(position);
+            this.state.propertyStates[position].owner = highBidder.id;
+            this.propertyChanged(position);
+            this.log(`${highBidder.name} won auction for ${square.name} at $${highBid}`);
+        }
+    }
+
+    /**
+     * Execute one player's turn
+     */
+    async executeTurnAsync() {
+        const player = this.state.getCurrentPlayer();
+
+        if (player.bankrupt) {
+            this.advanceToNextPlayer();
+            return;
+        }
+
+        this.log(`${player.name}'s turn (money: $${player.money})`);
+
+        const source = this.sources[player.id];
+        if (source && source.preTurn) {
+            const r = source.preTurn(this.state);
+            if (isThenable(r)) await r;
+        }
+
+        if (player.inJail) {
+            await this.handleJailTurnAsync(player);
+        } else {
+            await this.handleNormalTurnAsync(player);
+        }
+
+        if (source && source.postTurn) {
+            const r = source.postTurn(this.state);
+            if (isThenable(r)) await r;
+        }
+
+        this.advanceToNextPlayer();
+    }
+
+    async handleJailTurnAsync(player) {
+        const postBail = await this.decide(player, 'decideJail', [], () => false);
+
+        if (postBail && player.getOutOfJailCards > 0) {
+            player.getOutOfJailCards--;
+            player.inJail = false;
+            player.jailTurns = 0;
+            this.log(`${player.name} used a Get Out of Jail Free card`);
+            await this.handleNormalTurnAsync(player);
+            return;
+        }
+
+        if (postBail && player.money >= 50) {
+            this.payBank(player, 50);
+            player.inJail = false;
+            player.jailTurns = 0;
+            this.log(`${player.name} paid $50 to leave jail`);
+            await this.handleNormalTurnAsync(player);
+            return;
+        }
+
+        const roll = this.rollDice();
+        this.log(`${player.name} rolled ${roll.d1} + ${roll.d2} = ${roll.sum}`);
+
+        if (roll.isDoubles) {
+            player.inJail = false;
+            player.jailTurns = 0;
+            this.log(`${player.name} rolled doubles and escaped jail`);
+
+            this.movePlayer(player, roll.sum, false);
+            await this.landAsync(player, player.position, roll.sum);
+        } else {
+            player.jailTurns++;
+
+            if (player.jailTurns >= 3) {
+                this.payBank(player, 50);
+                player.inJail = false;
+                player.jailTurns = 0;
+                this.log(`${player.name} paid $50 after 3 turns in jail`);
+
+                this.movePlayer(player, roll.sum, false);
+                await this.landAsync(player, player.position, roll.sum);
+            } else {
+                this.log(`${player.name} stays in jail (turn ${player.jailTurns})`);
+            }
+        }
+    }
+
+    async handleNormalTurnAsync(player) {
+        let doublesCount = 0;
+
+        while (true) {
+            const roll = this.rollDice();
+            this.log(`${player.name} rolled ${roll.d1} + ${roll.d2} = ${roll.sum}`);
+
+            if (roll.isDoubles) {
+                doublesCount++;
+                if (doublesCount === 3) {
+                    this.sendToJail(player);
+                    return;
+                }
+            }
+
+            this.movePlayer(player, roll.sum);
+            const result = await this.landAsync(player, player.position, roll.sum);
+
+            if (player.bankrupt) return;
+            if (result.endTurn || !roll.isDoubles) return;
+        }
+    }
+
+    /**
+     * Run the game until completion or max turns
+     */
+    async runGameAsync() {
+        const yieldEvery = this.options.yieldEvery;
+        let turnsSinceYield = 0;
+
+        while (!this.state.isGameOver() && this.state.turn < this.options.maxTurns) {
+            await this.executeTurnAsync();
+
+            if (yieldEvery > 0 && ++turnsSinceYield >= yieldEvery) {
+                turnsSinceYield = 0;
+                await new Promise(resolve => setImmediate(resolve));
+            }
+        }
+
+        const winner = this.state.getWinner();
+        if (winner) {
+            this.log(`Game over! ${winner.name} wins!`);
+        } else {
+            this.log(`Game ended at turn limit (${this.options.maxTurns})`);
+        }
+
+        return {
+            winner: winner ? winner.id : null,
+            turns: this.state.turn,
+            stats: this.state.stats,
+            finalState: this.state
+        };
+    }
+
+    /**
+     * Synchronous entry points can't await remote seats
+     */
+    runGame() {
+        throw new Error('AsyncGameEngine: use runGameAsync()');
+    }
+
+    executeTurn() {
+        throw new Error('AsyncGameEngine: use executeTurnAsync()');
+    }
+}
+
+// =============================================================================
+// CONCURRENT GAME HOST
+// =============================================================================
+
+/**
+ * Run many games concurrently in this process.
+ *
+ * @param {number} numGames
+ * @param {function(number): AsyncGameEngine} createGame - returns a game ready to run
+ * @param {Object} options - { concurrency: max games in flight (default all) }
+ * @returns {Promise<Array>} results in game order
+ */
+async function runConcurrentGames(numGames, createGame, options = {}) {
+    const concurrency = options.concurrency || numGames;
+    const results = new Array(numGames);
+    let next = 0;
+
+    async function lane() {
+        while (next < numGames) {
+            const index = next++;
+            const engine = createGame(index);
+            results[index] = await engine.runGameAsync();
+        }
+    }
+
+    const lanes = [];
+    for (let i = 0; i < Math.min(concurrency, numGames); i++) {
+        lanes.push(lane());
+    }
+    await Promise.all(lanes);
+    return results;
+}
+
+module.exports = {
+    AsyncGameEngine,
+    LocalAISource,
+    RemoteSource,
+    HumanSource,
+    summarizeState,
+    runConcurrentGames
+};
@@ -0,0 +1,582 @@
+/**
+ * Auction Equilibrium Tables
+ *
+ * auction-bilateral-test.js and aggressive-bidder-ai.js tune bid premiums
+ * game by game. This module instead solves each auction as a game between
+ * its bidders, offline, and publishes the equilibrium drop-out prices as a
+ * lookup table the AIs can read in O(1).
+ *
+ * MODEL
+ *   An auction is keyed by the square and the ownership pattern: how many
+ *   squares of the group (or railroads/utilities) each bidder already
+ *   holds, e.g. Boardwalk with counts [1,0,0,0] is one completer and three
+ *   blockers. Bidders with the same count play the same role.
+ *
+ *   A bidder with count c values winning at
+ *     v = price/2 + theta * ((n-1) * dRent(c) * A - dCost(c))
+ *   where dRent is the marginal EPT (per opponent turn, landing
+ *   probabilities from the Markov engine), A the annuity factor over
+ *   HORIZON turns at DISCOUNT_RATE, and price/2 the mortgage floor. A
+ *   completing street adds DEV_PROBABILITY of a 3-house monopoly (less the
+ *   houses), and a non-completing one a TRADE_SHARE option on it. theta is
+ *   the bidder's private type (lognormal, TYPES equiprobable quantiles)
+ *   and stands in for horizon and cash-pressure differences.
+ *
+ *   Each losing bidder also pays an externality: if a bidder with count c
+ *   wins, every other bidder pays theta * dRent(c) * A in rent. This is
+ *   what makes blocking worth money - and what lets blockers free-ride
+ *   on each other.
+ *
+ *   Strategies are drop-out prices (the { limit } rules of
+ *   auction-resolver.js) on a price grid, per role and type. The winner
+ *   is the highest limit and pays the second highest (the engine's $10
+ *   ascending auction); ties split evenly.
+ *
+ * SOLVER
+ *   Fictitious play: every iteration each role/type best-responds to the
+ *   empirical mix of all past strategies of the other roles. Expected
+ *   payoffs are exact sums over the opponents' mixed drop-out
+ *   distributions - O(grid * bidders^3) per best response, no sampling.
+ *   Each square x pattern is independent, so build() spreads them over a
+ *   worker pool. exploitability is the most any role/type could still
+ *   gain by deviating (in $); it is 0 at an exact equilibrium.
+ *
+ * Usage:
+ *   node auction-equilibrium.js --build [--workers 4]   # solve and write the table
+ *   node auction-equilibrium.js --show 39               # print Boardwalk's entries
+ *
+ *   const table = AuctionEquilibrium.open();
+ *   table.bid(39, 1, [0, 0, 0])    // completer's limit vs three blockers
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const os = require('os');
+const { isMainThread, workerData } = require('worker_threads');
+const { BOARD, COLOR_GROUPS, SQUARE_TYPES } = require('./game-engine.js');
+const { runPool, serveJobs } = require('./worker-pool.js');
+const { quietly } = require('./harness.js');
+
+const DEFAULT_FILE = path.join(__dirname, '.auction-equilibrium.json');
+
+const DEFAULTS = {
+    players: 4,             // table covers 2..players bidders
+    discountRate: 0.03,     // per turn (npv-trade-valuator.js uses 1-15%)
+    horizon: 60,            // turns of rent counted
+    devProbability: 0.6,    // chance a completed monopoly reaches 3 houses
+    developHouses: 3,
+    tradeShare: 0.25,       // option value of a partial group
+    typeSpread: 0.35,       // sigma of log(theta)
+    types: 7,
+    gridPoints: 200,
+    iterations: 300,
+    workers: Math.max(1, os.cpus().length - 1)
+};
+
+const RAILROAD_RENT = [0, 25, 50, 100, 200];
+const UTILITY_MULTIPLIER = [0, 4, 10];
+
+// =============================================================================
+// VALUES
+// =============================================================================
+
+function annuity(opts) {
+    const r = opts.discountRate;
+    return (1 - Math.pow(1 + r, -opts.horizon)) / r;
+}
+
+/** Squares competing with `position` for ownership counts */
+function groupOf(position) {
+    const square = BOARD[position];
+    if (square.type === SQUARE_TYPES.RAILROAD) {
+        return { kind: 'railroad', squares: [5, 15, 25, 35] };
+    }
+    if (square.type === SQUARE_TYPES.UTILITY) {
+        return { kind: 'utility', squares: [12, 28] };
+    }
+    return { kind: 'street', squares: COLOR_GROUPS[square.group].squares };
+}
+
+function ownableSquares() {
+    return BOARD.map((sq, i) => i).filter(i => BOARD[i].price);
+}
+
+/**
+ * Marginal rent per opponent turn, and the investment it needs, when a
+ * bidder already holding `count` of the group wins `position`.
+ */
+function marginalRent(position, count, probs, opts) {
+    const { kind, squares } = groupOf(position);
+    const others = squares.filter(s => s !== position);
+    const pOther = others.reduce((s, q) => s + probs[q], 0) / others.length;
+
+    if (kind === 'railroad') {
+        return {
+            rent: probs[position] * RAILROAD_RENT[count + 1] +
+                pOther * count * (RAILROAD_RENT[count + 1] - RAILROAD_RENT[count]),
+            cost: 0
+        };
+    }
+    if (kind === 'utility') {
+        return {
+            rent: 7 * (probs[position] * UTILITY_MULTIPLIER[count + 1] +
+                pOther * count * (UTILITY_MULTIPLIER[count + 1] - UTILITY_MULTIPLIER[count])),
+            cost: 0
+        };
+    }
+
+    const n = squares.length;
+    const h = opts.developHouses;
+    const base = probs[position] * BOARD[position].rent[0];
+    const devRent = squares.reduce((s, q) => s + probs[q] * (BOARD[q].rent[h] - BOARD[q].rent[0]), 0);
+    const devCost = n * h * BOARD[position].housePrice;
+    const weight = count + 1 === n
+        ? opts.devProbability
+        : opts.tradeShare * (Math.pow((count + 1) / n, 2) - Math.pow(count / n, 2));
+    return { rent: base + weight * devRent, cost: weight * devCost };
+}
+
+/** Inverse standard normal CDF (bisection on the A&S 7.1.26 erf) */
+function normalQuantile(u) {
+    const cdf = (z) => {
+        const x = Math.abs(z) / Math.SQRT2;
+        const t = 1 / (1 + 0.3275911 * x);
+        const erf = 1 - t * (0.254829592 + t * (-0.284496736 + t * (1.421413741 +
+            t * (-1.453152027 + t * 1.061405429)))) * Math.exp(-x * x);
+        return z >= 0 ? (1 + erf) / 2 : (1 - erf) / 2;
+    };
+    let lo = -8, hi = 8;
+    for (let i = 0; i < 60; i++) {
+        const mid = (lo + hi) / 2;
+        if (cdf(mid) < u) lo = mid; else hi = mid;
+    }
+    return (lo + hi) / 2;
+}
+
+function typeMultipliers(opts) {
+    return Array.from({ length: opts.types }, (_, k) =>
+        Math.exp(opts.typeSpread * normalQuantile((k + 0.5) / opts.types)));
+}
+
+// =============================================================================
+// PATTERNS
+// =============================================================================
+
+/**
+ * Ownership patterns for a square: counts per bidder, sorted descending,
+ * for every bidder count 2..players. The counts never cover the square
+ * being auctioned.
+ */
+function enumeratePatterns(position, players) {
+    const { squares } = groupOf(position);
+    const maxTotal = squares.length - 1;
+    const patterns = [];
+    const extend = (counts, n, cap, left) => {
+        if (counts.length === n) {
+            patterns.push(counts.slice());
+            return;
+        }
+        for (let c = Math.min(cap, left); c >= 0; c--) {
+            counts.push(c);
+            extend(counts, n, c, left - c);
+            counts.pop();
+        }
+    };
+    for (let n = 2; n <= players; n++) extend([], n, maxTotal, maxTotal);
+    return patterns;
+}
+
+function patternKey(position, counts) {
+    return `${position}:${counts.join(',')}`;
+}
+
+// =============================================================================
+// SOLVER
+// =============================================================================
+
+/**
+ * Tie share: sum over m >= from of P(exactly m of the k opponents in
+ * `ks` at level g and the rest below) / (1 + extra + m).
+ */
+function tieShare(ks, k, below, pmfs, g, extra, from, dp) {
+    dp.fill(0, 0, k + 1);
+    dp[0] = 1;
+    for (let i = 0; i < k; i++) {
+        const a = below(ks[i], g);
+        const b = pmfs[ks[i]][g];
+        for (let m = i + 1; m >= 1; m--) dp[m] = dp[m] * a + dp[m - 1] * b;
+        dp[0] *= a;
+    }
+    let share = 0;
+    for (let m = from; m <= k; m++) share += dp[m] / (1 + extra + m);
+    return share;
+}
+
+/**
+ * Outcome probabilities of every drop-out index d for one bidder against
+ * opponents' drop-out pmfs:
+ *   win[d]       P(we win)
+ *   paid[d]      E[price paid; we win]
+ *   lose[j][d]   P(opponent j wins)
+ */
+function auctionOutcomes(pmfs, grid, step) {
+    const G = grid.length;
+    const n = pmfs.length;
+    const cdfs = pmfs.map(f => {
+        const F = new Float64Array(G);
+        let s = 0;
+        for (let g = 0; g < G; g++) { s += f[g]; F[g] = s; }
+        return F;
+    });
+    const below = (j, g) => (g > 0 ? cdfs[j][g - 1] : 0);
+    const rest = pmfs.map((_, j) => pmfs.map((f, k) => k).filter(k => k !== j));
+    const all = pmfs.map((f, k) => k);
+    const dp = new Float64Array(n + 1);
+
+    // Opponent j's chance of winning at level x with us below it
+    const suffix = pmfs.map((f, j) => {
+        const S = new Float64Array(G + 1);
+        for (let x = G - 1; x >= 1; x--) {
+            S[x] = S[x + 1] + (f[x] > 0 ? f[x] * tieShare(rest[j], n - 1, below, pmfs, x, 0, 0, dp) : 0);
+        }
+        return S;
+    });
+
+    const win = new Float64Array(G);
+    const paid = new Float64Array(G);
+    const lose = pmfs.map(() => new Float64Array(G));
+    let winProb = 0;     // P(max of others < d)
+    let winPaid = 0;     // E[price; max of others < d]
+    let allBelow = 1;    // P(max of others <= d - 1), carried from d - 1
+    for (let d = 0; d < G; d++) {
+        if (d > 0) {
+            let atOrBelow = 1;
+            for (let j = 0; j < n; j++) atOrBelow *= cdfs[j][d - 1];
+            const pMax = d === 1 ? atOrBelow : atOrBelow - allBelow;   // P(max of others = d - 1)
+            allBelow = atOrBelow;
+            winProb += pMax;
+            winPaid += pMax * Math.max(step, grid[d - 1]);
+            const tie = tieShare(all, n, below, pmfs, d, 0, 1, dp);
+            win[d] = winProb + tie;
+            paid[d] = winPaid + tie * grid[d];
+        }
+        for (let j = 0; j < n; j++) {
+            let p = suffix[j][d + 1];
+            if (d > 0 && pmfs[j][d] > 0) p += pmfs[j][d] * tieShare(rest[j], n - 1, below, pmfs, d, 1, 0, dp);
+            lose[j][d] = p;
+        }
+    }
+    return { win, paid, lose };
+}
+
+/**
+ * Expected payoff of every drop-out index for a bidder with value v and
+ * externality ext[j] per opponent.
+ */
+function payoffCurve(v, ext, outcomes) {
+    const { win, paid, lose } = outcomes;
+    const U = new Float64Array(win.length);
+    for (let d = 0; d < U.length; d++) {
+        let u = v * win[d] - paid[d];
+        for (let j = 0; j < lose.length; j++) u -= ext[j] * lose[j][d];
+        U[d] = u;
+    }
+    return U;
+}
+
+/**
+ * Solve one square x ownership pattern by fictitious play.
+ * @returns {Object} table entry
+ */
+function solvePattern(position, counts, probs, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const n = counts.length;
+    const A = annuity(opts);
+    const thetas = typeMultipliers(opts);
+    const weight = 1 / thetas.length;
+    const price = BOARD[position].price;
+
+    const roleCounts = [...new Set(counts)];
+    const roles = roleCounts.map(c => {
+        const { rent, cost } = marginalRent(position, c, probs, opts);
+        return {
+            count: c,
+            members: counts.filter(x => x === c).length,
+            gain: (n - 1) * rent * A - cost,
+            loss: rent * A                      // each other bidder's rent if this role wins
+        };
+    });
+    const values = roles.map(r => thetas.map(t => Math.max(0, price / 2 + t * r.gain)));
+
+    // Price grid: nobody gains from a limit above value + largest externality
+    const maxLoss = Math.max(...roles.map(r => r.loss));
+    const top = Math.max(...values.map(v => v[v.length - 1])) + thetas[thetas.length - 1] * maxLoss;
+    const step = Math.max(10, 10 * Math.ceil(top / (10 * (opts.gridPoints - 2))));
+    const G = Math.floor(top / step) + 2;
+    const grid = Array.from({ length: G }, (_, g) => g * step);
+    const toIndex = (x) => Math.max(0, Math.min(G - 1, Math.round(x / step)));
+
+    // Beliefs: running average of best responses, starting from truthful limits
+    const beliefs = roles.map((r, ri) => thetas.map((t, k) => {
+        const b = new Float64Array(G);
+        b[toIndex(values[ri][k])] = 1;
+        return b;
+    }));
+    const mixed = (ri) => {
+        const f = new Float64Array(G);
+        for (const b of beliefs[ri]) for (let g = 0; g < G; g++) f[g] += weight * b[g];
+        return f;
+    };
+    const opponents = (ri) => {
+        const list = [];
+        roles.forEach((r, rj) => {
+            for (let m = 0; m < r.members - (rj === ri ? 1 : 0); m++) list.push(rj);
+        });
+        return list;
+    };
+    const curves = (ri, pmfs) => {
+        const opp = opponents(ri);
+        const outcomes = auctionOutcomes(opp.map(rj => pmfs[rj]), grid, step);
+        return thetas.map((t, k) => payoffCurve(values[ri][k], opp.map(rj => t * roles[rj].loss), outcomes));
+    };
+    const bestResponse = (U, v) => {
+        let best = -Infinity;
+        for (let g = 0; g < G; g++) best = Math.max(best, U[g]);
+        const tol = 1e-9 * (1 + Math.abs(best));
+        // Among optimal limits prefer the one closest to value
+        let pick = -1;
+        for (let g = 0; g < G; g++) {
+            if (U[g] >= best - tol && (pick < 0 || Math.abs(grid[g] - v) < Math.abs(grid[pick] - v))) pick = g;
+        }
+        return pick;
+    };
+
+    for (let t = 1; t <= opts.iterations; t++) {
+        const pmfs = roles.map((r, ri) => mixed(ri));
+        const responses = roles.map((r, ri) => curves(ri, pmfs).map((U, k) => bestResponse(U, values[ri][k])));
+        const rate = 1 / (t + 1);
+        roles.forEach((r, ri) => thetas.forEach((th, k) => {
+            const b = beliefs[ri][k];
+            for (let g = 0; g < G; g++) b[g] *= 1 - rate;
+            b[responses[ri][k]] += rate;
+        }));
+    }
+
+    // Exploitability of the averaged strategies
+    const pmfs = roles.map((r, ri) => mixed(ri));
+    let exploitability = 0;
+    const solved = roles.map((r, ri) => {
+        const U = curves(ri, pmfs);
+        const bids = thetas.map((th, k) => {
+            const b = beliefs[ri][k];
+            let current = 0, mean = 0;
+            for (let g = 0; g < G; g++) { current += b[g] * U[k][g]; mean += b[g] * grid[g]; }
+            exploitability = Math.max(exploitability, Math.max(...U[k]) - current);
+            return Math.round(mean);
+        });
+        return {
+            count: r.count,
+            members: r.members,
+            values: values[ri].map(Math.round),
+            externality: Math.round(r.loss),
+            bids
+        };
+    });
+
+    return { position, counts, step, roles: solved, exploitability: Math.round(exploitability * 100) / 100 };
+}
+
+/** Solve every square x pattern on the calling thread */
+function solveAll(probs, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const entries = {};
+    for (const position of opts.squares || ownableSquares()) {
+        for (const counts of enumeratePatterns(position, opts.players)) {
+            entries[patternKey(position, counts)] = solvePattern(position, counts, probs, opts);
+        }
+    }
+    return entries;
+}
+
+/** Solve every square x pattern on a worker pool */
+async function solveParallel(probs, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const jobs = [];
+    for (const position of opts.squares || ownableSquares()) {
+        for (const counts of enumeratePatterns(position, opts.players)) jobs.push({ type: 'job', position, counts });
+    }
+    const { onProgress, ...solverOptions } = opts;
+
+    const results = await runPool(__filename, jobs, {
+        workers: opts.workers,
+        workerData: { auctionEquilibrium: true, probs, options: solverOptions },
+        onProgress
+    });
+    const entries = {};
+    for (const { entry } of results) entries[patternKey(entry.position, entry.counts)] = entry;
+    return entries;
+}
+
+function workerMain() {
+    const { probs, options } = workerData;
+    serveJobs('job', msg => ({ entry: solvePattern(msg.position, msg.counts, probs, options) }));
+}
+
+/** Steady-state landing probabilities (cached Markov engine) */
+function landingProbabilities() {
+    const { getCachedEngines } = require('./cached-engines.js');
+    return quietly(() => getCachedEngines().markovEngine.getAllProbabilities());
+}
+
+// =============================================================================
+// LOOKUP TABLE
+// =============================================================================
+
+class AuctionEquilibrium {
+    constructor(params, entries) {
+        this.params = params;
+        this.entries = entries;
+    }
+
+    static build(options = {}) {
+        const probs = options.probabilities || landingProbabilities();
+        const { probabilities, ...params } = { ...DEFAULTS, ...options };
+        return new AuctionEquilibrium(params, solveAll(probs, params));
+    }
+
+    static async buildParallel(options = {}) {
+        const probs = options.probabilities || landingProbabilities();
+        const { probabilities, onProgress, ...params } = { ...DEFAULTS, ...options };
+        return new AuctionEquilibrium(params, await solveParallel(probs, { ...params, onProgress }));
+    }
+
+    save(file = DEFAULT_FILE) {
+        const { workers, ...params } = this.params;
+        fs.writeFileSync(file, JSON.stringify({ params, entries: this.entries }));
+    }
+
+    static load(file = DEFAULT_FILE) {
+        const data = JSON.parse(fs.readFileSync(file, 'utf8'));
+        return new AuctionEquilibrium(data.params, data.entries);
+    }
+
+    /** Load the default table, solving and saving it on first use */
+    static open(file = DEFAULT_FILE, options = {}) {
+        if (fs.existsSync(file)) return AuctionEquilibrium.load(file);
+        const table = AuctionEquilibrium.build(options);
+        table.save(file);
+        return table;
+    }
+
+    /**
+     * Solved role for a bidder holding `myCount` of the group against
+     * opponents holding `otherCounts`, or null if the pattern isn't tabled.
+     */
+    lookup(position, myCount, otherCounts) {
+        const counts = [myCount, ...otherCounts].sort((a, b) => b - a);
+        const entry = this.entries[patternKey(position, counts)];
+        return entry ? entry.roles.find(r => r.count === myCount) : null;
+    }
+
+    /** Equilibrium limit for the median type, or null */
+    bid(position, myCount, otherCounts) {
+        const role = this.lookup(position, myCount, otherCounts);
+        return role ? role.bids[role.bids.length >> 1] : null;
+    }
+}
+
+/** Group ownership counts seen by `playerId` in a live game */
+function ownershipCounts(position, state, playerId) {
+    const { squares } = groupOf(position);
+    const counts = new Map();
+    for (const p of state.players) if (!p.bankrupt) counts.set(p.id, 0);
+    for (const sq of squares) {
+        const owner = state.propertyStates[sq].owner;
+        if (owner !== null && counts.has(owner)) counts.set(owner, counts.get(owner) + 1);
+    }
+    const mine = counts.get(playerId) || 0;
+    counts.delete(playerId);
+    return { mine, others: [...counts.values()] };
+}
+
+module.exports = {
+    AuctionEquilibrium,
+    solvePattern,
+    auctionOutcomes,
+    payoffCurve,
+    solveAll,
+    solveParallel,
+    enumeratePatterns,
+    marginalRent,
+    ownershipCounts,
+    landingProbabilities,
+    DEFAULTS,
+    DEFAULT_FILE
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+async function main() {
+    const args = process.argv.slice(2);
+    const options = {};
+    let file = DEFAULT_FILE;
+    let build = false;
+    let show = null;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--build': build = true; break;
+            case '--show': show = parseInt(args[++i], 10); break;
+            case '--workers': options.workers = parseInt(args[++i], 10); break;
+            case '--iterations': options.iterations = parseInt(args[++i], 10); break;
+            case '--file': file = args[++i]; break;
+        }
+    }
+    if (!build && show === null) {
+        console.log('Usage: node auction-equilibrium.js [--build] [--workers N] [--iterations N] [--show <square>] [--file f]');
+        return;
+    }
+
+    let table;
+    if (build) {
+        const start = Date.now();
+        table = await AuctionEquilibrium.buildParallel({
+            ...options,
+            onProgress: (done, total) => {
+                if (done % 50 === 0 || done === total) console.log(`  ${done}/${total} patterns solved`);
+            }
+        });
+        table.save(file);
+        const worst = Object.values(table.entries).reduce((m, e) => Math.max(m, e.exploitability), 0);
+        console.log(`${Object.keys(table.entries).length} patterns in ${((Date.now() - start) / 1000).toFixed(1)}s ` +
+            `(worst exploitability $${worst.toFixed(2)}), written to ${file}`);
+    } else {
+        table = AuctionEquilibrium.load(file);
+    }
+
+    if (show !== null) {
+        console.log(`\n${BOARD[show].name} (face $${BOARD[show].price}) - limits for the median type:`);
+        for (const entry of Object.values(table.entries)) {
+            if (entry.position !== show) continue;
+            const roles = entry.roles.map(r => {
+                const mid = r.bids.length >> 1;
+                return `holds ${r.count}${r.members > 1 ? ` (x${r.members})` : ''}: ` +
+                    `value $${r.values[mid]}, limit $${r.bids[mid]}`;
+            });
+            console.log(`  [${entry.counts.join(',')}]  ${roles.join(' | ')}  (eps $${entry.exploitability})`);
+        }
+    }
+}
+
+// Only our own pool's workers; the AI loads this module inside other pools too
+if (!isMainThread && workerData && workerData.auctionEquilibrium) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
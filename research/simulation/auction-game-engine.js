@@ -13,6 +13,9 @@ const {
     BOARD,
     SQUARE_TYPES
 } = require('./game-engine.js');
+const { resolveAuction } = require('./auction-resolver.js');
+const { SeatSchedule, SeatStats } = require('./seat-schedule.js');
+const { withSeed } = require('./seeded-random.js');
 
 // =============================================================================
 // AUCTION ANALYTICS
@@ -239,8 +242,6 @@ class AuctionGameEngine extends GameEngine {
      */
     runTrackedAuction(position) {
         const square = BOARD[position];
-        let highBid = 0;
-        let highBidder = null;
         const allBids = [];  // Track every bid
 
         // Get active players and randomize starting order
@@ -252,61 +253,29 @@ class AuctionGameEngine extends GameEngine {
             [bidders[i], bidders[j]] = [bidders[j], bidders[i]];
         }
 
-        // Track who is still in the auction
-        const stillBidding = new Set(bidders.map(p => p.id));
         let uniqueBidders = new Set();
 
-        // Round-robin bidding
-        let rounds = 0;
-        const maxRounds = 100;
+        const { winner: highBidder, price: highBid } = resolveAuction(bidders, position, this.state, {
+            interactive: this.options.interactiveAuctions,
+            onBid: (player, bid, round) => {
+                uniqueBidders.add(player.id);
 
-        while (stillBidding.size > 1 && rounds < maxRounds) {
-            rounds++;
-            let anyBidThisRound = false;
-
-            for (const player of bidders) {
-                if (!stillBidding.has(player.id)) continue;
-
-                let bid = 0;
-
-                if (player.ai && player.ai.decideBid) {
-                    bid = player.ai.decideBid(position, highBid, this.state);
-                } else {
-                    // Default: bid up to property price if can afford
-                    const maxBid = Math.min(player.money - 50, square.price);
-                    if (maxBid > highBid) {
-                        bid = highBid + 10;
-                    }
-                }
-
-                if (bid > highBid && bid <= player.money) {
-                    highBid = bid;
-                    highBidder = player;
-                    anyBidThisRound = true;
-                    uniqueBidders.add(player.id);
-
-                    // Record this bid
-                    allBids.push({
-                        playerId: player.id,
-                        playerName: player.name,
-                        bid: bid,
-                        round: rounds
-                    });
-                } else {
-                    stillBidding.delete(player.id);
-                }
-            }
-
-            if (!anyBidThisRound && highBidder) {
-                break;
+                // Record this bid
+                allBids.push({
+                    playerId: player.id,
+                    playerName: player.name,
+                    bid: bid,
+                    round: round
+                });
             }
-        }
+        });
 
         // Complete the auction
         if (highBidder) {
             highBidder.money -= highBid;
             highBidder.properties.add(position);
             this.state.propertyStates[position].owner = highBidder.id;
+            this.propertyChanged(position);
             this.log(`${highBidder.name} won auction for ${square.name} at $${highBid}`);
 
             // Record analytics
@@ -500,6 +469,8 @@ class AuctionSimulationRunner {
             games: options.games || 100,
             maxTurns: options.maxTurns || 500,
             verbose: options.verbose || false,
+            seating: options.seating || 'fixed',   // 'fixed', 'cyclic' or 'latin' (see seat-schedule.js)
+            seed: options.seed,
             ...options
         };
 
@@ -513,7 +484,9 @@ class AuctionSimulationRunner {
 
             if (MarkovEngine) {
                 console.log('Initializing Markov engine...');
-                this.markovEngine = new MarkovEngine();
+                // Speed-die variants value squares by their own landing probabilities
+                const dice = this.options.rules ? require('./rule-variants.js').variantDice(this.options.rules) : 'classic';
+                this.markovEngine = new MarkovEngine({ dice });
                 this.markovEngine.initialize();
 
                 if (PropertyValuator) {
@@ -581,6 +554,16 @@ class AuctionSimulationRunner {
             EnhancedRelative15 = enhancedModule.EnhancedRelative15;
         } catch (e) { }
 
+        let HouseStarverAI;
+        try {
+            HouseStarverAI = require('./house-starver-ai.js').HouseStarverAI;
+        } catch (e) { }
+
+        let EquilibriumBidderAI;
+        try {
+            EquilibriumBidderAI = require('./equilibrium-bidder-ai.js').EquilibriumBidderAI;
+        } catch (e) { }
+
         return (player, engine) => {
             switch (aiType) {
                 case 'simple':
@@ -652,6 +635,14 @@ class AuctionSimulationRunner {
                     return EnhancedRelative15 ?
                         new EnhancedRelative15(player, engine, self.markovEngine, self.valuator) :
                         new TradingAI(player, engine, self.markovEngine, self.valuator);
+                case 'starver':
+                    return HouseStarverAI ?
+                        new HouseStarverAI(player, engine, self.markovEngine, self.valuator) :
+                        new TradingAI(player, engine, self.markovEngine, self.valuator);
+                case 'equilibrium':
+                    return EquilibriumBidderAI ?
+                        new EquilibriumBidderAI(player, engine, self.markovEngine, self.valuator) :
+                        new TradingAI(player, engine, self.markovEngine, self.valuator);
                 default:
                     return new SimpleAI(player, engine);
             }
@@ -662,9 +653,12 @@ class AuctionSimulationRunner {
      * Run a single auction game
      */
     runSingleGame(aiTypes) {
-        const engine = new AuctionGameEngine({
+        const Engine = this.options.rules
+            ? require('./rule-variants.js').variantClass(this.options.rules, AuctionGameEngine) : AuctionGameEngine;
+        const engine = new Engine({
             maxTurns: this.options.maxTurns,
-            verbose: this.options.verbose
+            verbose: this.options.verbose,
+            houseAuctions: this.options.houseAuctions
         });
 
         const numPlayers = aiTypes.length;
@@ -686,6 +680,9 @@ class AuctionSimulationRunner {
         console.log(`Running ${numGames} games with AI types: ${aiTypes.join(', ')}`);
         console.log('Rule: No direct purchases - ALL properties go to auction\n');
 
+        const schedule = new SeatSchedule(aiTypes.length, { mode: this.options.seating, seed: this.options.seed });
+        const seatStats = new SeatStats(aiTypes.length, schedule.blockSize);
+
         const results = {
             games: numGames,
             aiTypes,
@@ -723,10 +720,14 @@ class AuctionSimulationRunner {
         const startTime = Date.now();
 
         for (let i = 0; i < numGames; i++) {
-            const gameResult = this.runSingleGame(aiTypes);
-
-            if (gameResult.winner !== null) {
-                results.wins[gameResult.winner]++;
+            const { order, block, seed } = schedule.game(i);
+            const play = () => this.runSingleGame(order.map(p => aiTypes[p]));
+            const gameResult = seed === undefined ? play() : withSeed(seed, play);
+            const winner = gameResult.winner !== null ? order[gameResult.winner] : null;
+            seatStats.record(order, gameResult.winner, block);
+
+            if (winner !== null) {
+                results.wins[winner]++;
             } else {
                 results.timeouts++;
             }
@@ -803,10 +804,10 @@ class AuctionSimulationRunner {
                 }
             }
 
-            // Collect debt tracking data
+            // Collect debt tracking data (tracked by seat, aggregated by player)
             if (gameResult.debtTracking) {
                 for (let p = 0; p < aiTypes.length; p++) {
-                    const dt = gameResult.debtTracking[p];
+                    const dt = gameResult.debtTracking[order.indexOf(p)];
                     const stats = results.debtStats[p];
 
                     stats.totalMortgages += dt.mortgageEvents.length;
@@ -824,7 +825,7 @@ class AuctionSimulationRunner {
                     }
 
                     // Track debt vs winning
-                    if (gameResult.winner === p) {
+                    if (winner === p) {
                         stats.winnerPeakDebts.push(dt.peakDebt);
                     } else {
                         stats.loserPeakDebts.push(dt.peakDebt);
@@ -841,8 +842,15 @@ class AuctionSimulationRunner {
         const totalTime = (Date.now() - startTime) / 1000;
         results.avgTurns = results.totalTurns / numGames;
         results.timeSeconds = totalTime;
+        results.seating = {
+            mode: schedule.mode,
+            blockSize: schedule.blockSize,
+            seatWins: seatStats.seatWins,
+            entries: seatStats.entrySummary()
+        };
 
         this.printResults(results);
+        if (schedule.mode !== 'fixed') seatStats.print(aiTypes, schedule.mode);
         this.printAuctionAnalysis(results);
         this.printMonopolyAnalysis(results);
         this.printDebtAnalysis(results);
@@ -0,0 +1,185 @@
+/**
+ * Auction Resolver
+ *
+ * Resolves the engine's ascending round-robin auction. The engine's rules
+ * are: bidders in a shuffled order, each live bidder asked in turn, and a
+ * bid must beat the high bid and be affordable or the bidder drops out
+ * (the high bidder included). Play stops when one bidder is left, when a
+ * round passes with no bid, or after maxRounds rounds.
+ *
+ * Most AIs bid by threshold: "raise by $10, up to my limit". Asking them
+ * through decideBid() every round costs a valuation call per bid, i.e.
+ * dozens per auction. An AI can instead publish its rule once per auction
+ * through getReservationBid(position, state):
+ *
+ *   { limit, step, clamp }   decideBid(h) = h < limit ? (clamp ? min(h + step, limit) : h + step) : 0
+ *   { bid: h => number }     any other pure bid function
+ *   null                     bid interactively through decideBid()
+ *
+ * When every live bidder has published a { limit, step } rule with a
+ * common step, whole rounds are resolved in closed form. The high bid
+ * jumps straight to the last full round before the lowest limit. The
+ * winner is therefore the highest limit, at about one step over the
+ * second highest (second-price style). The final few bids are then
+ * stepped exactly, so the winner and price match the round-by-round loop
+ * bit for bit. Bidders that publish nothing are still asked every round,
+ * in their usual turn.
+ *
+ * Usage:
+ *   const { winner, price } = resolveAuction(bidders, position, state);
+ *   resolveAuction(bidders, position, state, { onBid: (player, bid, round) => ... });
+ *   resolveAuction(bidders, position, state, { interactive: true });   // old loop
+ *   await resolveAuctionAsync(bidders, position, state, { source: p => sources[p.id] });
+ */
+
+'use strict';
+
+const { BOARD } = require('./game-engine.js');
+
+const MAX_ROUNDS = 100;
+
+/** Rule for a bidder with no AI: up to face value, keeping $50 */
+function defaultRule(player, position) {
+    return { limit: Math.min(player.money - 50, BOARD[position].price), step: 10, clamp: false };
+}
+
+function applyRule(rule, highBid) {
+    if (rule.bid) return rule.bid(highBid);
+    if (highBid >= rule.limit) return 0;
+    return rule.clamp ? Math.min(highBid + rule.step, rule.limit) : highBid + rule.step;
+}
+
+/**
+ * Number of whole rounds every live bidder is certain to raise by exactly
+ * `step` (no clamping, no dropping out, affordable), starting from highBid.
+ */
+function fullRounds(live, rules, highBid, step) {
+    const m = live.length;
+    let k = Infinity;
+    live.forEach((p, j) => {
+        const rule = rules[p.index];
+        const money = p.player.money;
+        // Bid in round r is b = highBid + (r*m + j + 1) * step
+        let rMax = Math.floor((money - highBid - (j + 1) * step) / (m * step));
+        if (rule.clamp) {
+            rMax = Math.min(rMax, Math.floor((rule.limit - highBid - (j + 1) * step) / (m * step)));
+        } else {
+            // Needs b - step < limit
+            rMax = Math.min(rMax, Math.ceil((rule.limit - highBid - j * step) / (m * step)) - 1);
+        }
+        k = Math.min(k, rMax + 1);
+    });
+    return Math.max(0, k);
+}
+
+/** A decision source's published rule; null means ask decideBid() every time */
+function publishedRule(source, player, position, state, interactive) {
+    if (!(source && source.decideBid)) return defaultRule(player, position);
+    if (interactive || !source.getReservationBid) return null;
+    return source.getReservationBid(position, state) || null;
+}
+
+/**
+ * The auction itself. Yields { player, index, highBid } whenever a bidder
+ * without a rule must be asked, and expects the bid back through next().
+ */
+function* auctionSteps(bidders, rules, options) {
+    const maxRounds = options.maxRounds || MAX_ROUNDS;
+    const onBid = options.onBid;
+
+    const stillBidding = bidders.map(() => true);
+    let liveCount = bidders.length;
+    let highBid = 0;
+    let highBidder = null;
+    let rounds = 0;
+
+    while (liveCount > 1 && rounds < maxRounds) {
+        // Closed form: skip whole rounds of plain step raises
+        const live = [];
+        bidders.forEach((player, index) => { if (stillBidding[index]) live.push({ player, index }); });
+        const step = rules[live[0].index] && rules[live[0].index].step;
+        if (step && Number.isInteger(step) && Number.isInteger(highBid) &&
+            live.every(p => rules[p.index] && !rules[p.index].bid && rules[p.index].step === step)) {
+            const k = Math.min(fullRounds(live, rules, highBid, step), maxRounds - rounds);
+            if (k > 0) {
+                if (onBid) {
+                    for (let r = 0; r < k; r++) {
+                        live.forEach((p, j) => onBid(p.player, highBid + (r * live.length + j + 1) * step, rounds + r + 1));
+                    }
+                }
+                highBid += k * live.length * step;
+                highBidder = live[live.length - 1].player;
+                rounds += k;
+                continue;
+            }
+        }
+
+        rounds++;
+        let anyBidThisRound = false;
+
+        for (let i = 0; i < bidders.length; i++) {
+            if (!stillBidding[i]) continue;
+            const player = bidders[i];
+            const bid = rules[i] ? applyRule(rules[i], highBid) : (yield { player, index: i, highBid });
+
+            if (bid > highBid && bid <= player.money) {
+                highBid = bid;
+                highBidder = player;
+                anyBidThisRound = true;
+                if (onBid) onBid(player, bid, rounds);
+            } else {
+                // Player passes - remove from auction
+                stillBidding[i] = false;
+                liveCount--;
+            }
+        }
+
+        // If no one bid this round and we have a high bidder, they win
+        if (!anyBidThisRound && highBidder) break;
+    }
+
+    return { winner: highBidder, price: highBid, rounds };
+}
+
+/**
+ * @param {Player[]} bidders - in bidding order (already shuffled)
+ * @param {number} position
+ * @param {GameState} state
+ * @param {Object} options - { interactive, onBid, maxRounds }
+ * @returns {{winner: Player|null, price: number, rounds: number}}
+ */
+function resolveAuction(bidders, position, state, options = {}) {
+    const rules = bidders.map(player => publishedRule(player.ai, player, position, state, options.interactive));
+    const steps = auctionSteps(bidders, rules, options);
+    let step = steps.next();
+    while (!step.done) {
+        step = steps.next(step.value.player.ai.decideBid(position, step.value.highBid, state));
+    }
+    return step.value;
+}
+
+/**
+ * resolveAuction() for seats that may answer with a promise
+ * (AsyncGameEngine's decision sources). Only bids that come back as
+ * promises are awaited; a source with no opinion (null) bids by the
+ * default rule.
+ *
+ * @param {Object} options - resolveAuction's, plus source(player) -> decision source
+ */
+async function resolveAuctionAsync(bidders, position, state, options = {}) {
+    const sources = bidders.map(options.source || (player => player.ai));
+    const rules = bidders.map((player, i) =>
+        publishedRule(sources[i], player, position, state, options.interactive));
+    const steps = auctionSteps(bidders, rules, options);
+    let step = steps.next();
+    while (!step.done) {
+        const { player, index, highBid } = step.value;
+        let bid = sources[index].decideBid(position, highBid, state);
+        if (bid !== null && typeof bid === 'object' && typeof bid.then === 'function') bid = await bid;
+        if (bid === null || bid === undefined) bid = applyRule(defaultRule(player, position), highBid);
+        step = steps.next(bid);
+    }
+    return step.value;
+}
+
+module.exports = { resolveAuction, resolveAuctionAsync, applyRule, MAX_ROUNDS };
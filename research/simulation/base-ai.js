@@ -44,6 +44,41 @@ class BaseAI {
         return 0;
     }
 
+    /**
+     * Optionally publish this auction's bidding rule once, so the engine can
+     * resolve it without calling decideBid() every round (see
+     * auction-resolver.js). Only valid if decideBid() would follow the rule
+     * for every high bid in this auction, with no side effects or
+     * randomness.
+     * @param {number} position - Property being auctioned
+     * @param {GameState} state - Current game state
+     * @returns {Object|null} { limit, step, clamp }, { bid: h => number }, or null to bid interactively
+     */
+    getReservationBid(position, state) {
+        return null;
+    }
+
+    /**
+     * Most this player will pay for a contended house or hotel when the bank
+     * runs short and the last units are auctioned (house-bank.js).
+     * @param {string} kind - 'house' or 'hotel'
+     * @param {GameState} state - Current game state
+     * @returns {number|null} limit, or null to pay list price only
+     */
+    getHouseBidLimit(kind, state) {
+        return null;
+    }
+
+    /**
+     * Where to place a house or hotel won at a last-houses auction.
+     * @param {string} kind - 'house' or 'hotel'
+     * @param {GameState} state - Current game state
+     * @returns {number|null} square, or null for the largest rent step
+     */
+    chooseBuildTarget(kind, state) {
+        return null;
+    }
+
     /**
      * Decide whether to post bail / use jail card
      * @param {GameState} state - Current game state
@@ -168,12 +203,15 @@ class SimpleAI extends BaseAI {
         return this.player.money - square.price >= reserve;
     }
 
-    decideBid(position, currentBid, state) {
-        const square = BOARD[position];
-        const maxBid = Math.min(
+    getBidLimit(position, state) {
+        return Math.min(
             this.player.money - this.getMinReserve(state),
-            square.price
+            BOARD[position].price
         );
+    }
+
+    decideBid(position, currentBid, state) {
+        const maxBid = this.getBidLimit(position, state);
 
         if (maxBid > currentBid) {
             return currentBid + 10;
@@ -181,6 +219,11 @@ class SimpleAI extends BaseAI {
         return 0;
     }
 
+    getReservationBid(position, state) {
+        if (this.decideBid !== SimpleAI.prototype.decideBid) return null;
+        return { limit: this.getBidLimit(position, state), step: 10, clamp: false };
+    }
+
     decideJail(state) {
         // Stay in jail late game if opponents have developed properties
         if (state.phase === 'late') {
@@ -289,12 +332,13 @@ class StrategicAI extends BaseAI {
         return payback < 50;
     }
 
-    decideBid(position, currentBid, state) {
+    /**
+     * Most we'll pay at auction: face value, with premiums for completing or
+     * blocking a monopoly, capped by cash above reserve
+     */
+    getBidLimit(position, state) {
         const square = BOARD[position];
-        const reserve = this.getMinReserve(state);
-        const maxAfford = this.player.money - reserve;
-
-        if (maxAfford <= currentBid) return 0;
+        const maxAfford = this.player.money - this.getMinReserve(state);
 
         // Calculate max we're willing to pay
         let maxWilling = square.price;
@@ -307,7 +351,11 @@ class StrategicAI extends BaseAI {
             maxWilling *= 1.3;
         }
 
-        maxWilling = Math.min(maxWilling, maxAfford);
+        return Math.min(maxWilling, maxAfford);
+    }
+
+    decideBid(position, currentBid, state) {
+        const maxWilling = this.getBidLimit(position, state);
 
         if (currentBid >= maxWilling) return 0;
 
@@ -315,6 +363,12 @@ class StrategicAI extends BaseAI {
         return Math.min(currentBid + 10, maxWilling);
     }
 
+    getReservationBid(position, state) {
+        // Subclasses with their own decideBid() must publish their own rule
+        if (this.decideBid !== StrategicAI.prototype.decideBid) return null;
+        return { limit: this.getBidLimit(position, state), step: 10, clamp: true };
+    }
+
     decideJail(state) {
         // Early game: leave to buy properties
         if (state.phase === 'early') {
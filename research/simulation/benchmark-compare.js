@@ -0,0 +1,118 @@
+/**
+ * Benchmark Comparison
+ *
+ * Compares a microbenchmark run against the stored baseline and flags
+ * regressions, in the spirit of Google Benchmark's compare.py.
+ * Median real time is compared per benchmark; a slowdown beyond the
+ * threshold is reported as a regression and the process exits non-zero.
+ *
+ * Usage:
+ *   node benchmark-compare.js current.json                 # vs stored baseline
+ *   node benchmark-compare.js baseline.json current.json   # explicit pair
+ *   node benchmark-compare.js current.json --threshold 0.05
+ */
+
+'use strict';
+
+const fs = require('fs');
+const { BASELINE_FILE, formatNs } = require('./microbenchmark.js');
+
+/**
+ * Pull median real/cpu time per benchmark out of a report.
+ * Falls back to the first iteration row if no aggregates were recorded.
+ */
+function medians(report) {
+    const result = {};
+    for (const row of report.benchmarks) {
+        const name = row.run_name || row.name;
+        if (row.run_type === 'aggregate' && row.aggregate_name === 'median') {
+            result[name] = row;
+        } else if (row.run_type !== 'aggregate' && !result[name]) {
+            result[name] = row;
+        }
+    }
+    return result;
+}
+
+/**
+ * Compare two reports.
+ *
+ * @param {Object} baseline - Baseline report
+ * @param {Object} current - Current report
+ * @param {number} threshold - Relative slowdown treated as a regression (0.10 = 10%)
+ * @returns {Array} Rows of { name, baseline, current, change, status }
+ */
+function compareReports(baseline, current, threshold = 0.10) {
+    const before = medians(baseline);
+    const after = medians(current);
+    const rows = [];
+
+    for (const name of Object.keys(after)) {
+        if (!before[name]) {
+            rows.push({ name, baseline: null, current: after[name].real_time, change: null, status: 'new' });
+            continue;
+        }
+        const change = (after[name].real_time - before[name].real_time) / before[name].real_time;
+        let status = 'ok';
+        if (change > threshold) status = 'REGRESSION';
+        else if (change < -threshold) status = 'improved';
+        rows.push({ name, baseline: before[name].real_time, current: after[name].real_time, change, status });
+    }
+
+    for (const name of Object.keys(before)) {
+        if (!after[name]) {
+            rows.push({ name, baseline: before[name].real_time, current: null, change: null, status: 'missing' });
+        }
+    }
+
+    return rows;
+}
+
+function main() {
+    const args = process.argv.slice(2);
+    let threshold = 0.10;
+    const files = [];
+
+    for (let i = 0; i < args.length; i++) {
+        if (args[i] === '--threshold') threshold = parseFloat(args[++i]);
+        else files.push(args[i]);
+    }
+
+    if (files.length === 0) {
+        console.log('Usage: node benchmark-compare.js [baseline.json] current.json [--threshold 0.10]');
+        process.exit(2);
+    }
+
+    const baselineFile = files.length > 1 ? files[0] : BASELINE_FILE;
+    const currentFile = files[files.length - 1];
+
+    const baseline = JSON.parse(fs.readFileSync(baselineFile, 'utf8'));
+    const current = JSON.parse(fs.readFileSync(currentFile, 'utf8'));
+    const rows = compareReports(baseline, current, threshold);
+
+    console.log(`Comparing ${currentFile} against ${baselineFile} (threshold ${(threshold * 100).toFixed(0)}%)`);
+    console.log('='.repeat(78));
+    console.log(`${'Benchmark'.padEnd(28)} ${'Baseline'.padStart(12)} ${'Current'.padStart(12)} ${'Change'.padStart(9)}  Status`);
+    console.log('-'.repeat(78));
+
+    for (const row of rows) {
+        const base = row.baseline === null ? '-' : formatNs(row.baseline);
+        const cur = row.current === null ? '-' : formatNs(row.current);
+        const change = row.change === null ? '-' : `${row.change >= 0 ? '+' : ''}${(row.change * 100).toFixed(1)}%`;
+        console.log(`${row.name.padEnd(28)} ${base.padStart(12)} ${cur.padStart(12)} ${change.padStart(9)}  ${row.status}`);
+    }
+
+    const regressions = rows.filter(r => r.status === 'REGRESSION');
+    console.log('-'.repeat(78));
+    if (regressions.length > 0) {
+        console.log(`${regressions.length} regression(s) above ${(threshold * 100).toFixed(0)}%`);
+        process.exit(1);
+    }
+    console.log('No regressions');
+}
+
+module.exports = { compareReports };
+
+if (require.main === module) {
+    main();
+}
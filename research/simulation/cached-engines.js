@@ -7,6 +7,9 @@
  *
  * First run: computes and saves to .markov-cache.json
  * Subsequent runs: loads from cache (~10-20x faster startup)
+ *
+ * options.log receives the progress messages (console.log by default);
+ * pass () => {} to load silently.
  */
 
 'use strict';
@@ -16,7 +19,8 @@ const path = require('path');
 
 const CACHE_FILE = path.join(__dirname, '.markov-cache.json');
 
-function getCachedEngines() {
+function getCachedEngines(options = {}) {
+    const log = options.log || console.log;
     const MarkovEngine = require('../../ai/markov-engine.js').MarkovEngine;
     const PropertyValuator = require('../../ai/property-valuator.js');
 
@@ -25,7 +29,7 @@ function getCachedEngines() {
         if (fs.existsSync(CACHE_FILE)) {
             const data = JSON.parse(fs.readFileSync(CACHE_FILE, 'utf8'));
 
-            const markov = new MarkovEngine();
+            const markov = new MarkovEngine({ log });
             markov._basicMatrix = data.basicMatrix;
             markov._steadyState = data.steadyState;
             markov._initialized = true;
@@ -34,16 +38,16 @@ function getCachedEngines() {
             valuator._tables = data.tables;
             valuator._initialized = true;
 
-            console.log('Loaded Markov/EPT from cache.');
+            log('Loaded Markov/EPT from cache.');
             return { markovEngine: markov, valuator };
         }
     } catch (e) {
-        console.log('Cache load failed, recomputing:', e.message);
+        log('Cache load failed, recomputing:', e.message);
     }
 
     // Compute from scratch
-    console.log('Computing Markov/EPT tables (first run)...');
-    const markov = new MarkovEngine();
+    log('Computing Markov/EPT tables (first run)...');
+    const markov = new MarkovEngine({ log });
     markov.initialize();
     const valuator = new PropertyValuator.Valuator(markov);
     valuator.initialize();
@@ -57,9 +61,9 @@ function getCachedEngines() {
         };
         fs.writeFileSync(CACHE_FILE, JSON.stringify(data));
         const sizeKB = (fs.statSync(CACHE_FILE).size / 1024).toFixed(0);
-        console.log('Saved cache (' + sizeKB + ' KB).');
+        log('Saved cache (' + sizeKB + ' KB).');
     } catch (e) {
-        console.log('Cache save failed:', e.message);
+        log('Cache save failed:', e.message);
     }
 
     return { markovEngine: markov, valuator };
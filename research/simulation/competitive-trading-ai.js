@@ -35,6 +35,11 @@ class CompetitiveTradingAI extends TradingAI {
      * Calculate a player's EPT from their current holdings
      */
     calculatePlayerEPT(player, state) {
+        // The live game state has running sums maintained by the engine
+        if (this.engine && this.engine.getEPTTracker && state === this.engine.state) {
+            return this.engine.getEPTTracker(this.probs).streetEPT(player.id);
+        }
+
         const activePlayers = state.players.filter(p => !p.bankrupt);
         const opponents = activePlayers.length - 1;
         if (opponents === 0) return 0;
@@ -0,0 +1,418 @@
+/**
+ * Counterfactual Branch-and-Compare
+ *
+ * Judges decisions by outcome rather than by EPT arithmetic. A recording
+ * pass plays a seeded tournament and snapshots the game at every decision
+ * point: a purchase the AI could afford, or a trade offer it was asked to
+ * accept. Each decision is then branched: the game is restored from the
+ * snapshot, one branch takes the action and the other doesn't, and both
+ * are played out K times. Rollout k of both branches runs under the same
+ * seed (common random numbers), with the dice on their own stream so an
+ * extra auction or AI coin-flip in one branch doesn't shift the other's
+ * rolls. The paired difference
+ *
+ *   delta = P(win | take) - P(win | don't take)
+ *
+ * for the deciding player has far lower variance than two independent
+ * estimates. A decision is flagged when delta's sign disagrees with what
+ * the AI did by more than two standard errors.
+ *
+ * Approximations (shared by both branches, so they cancel in delta):
+ *   - AIs are rebuilt from their type names at the snapshot; AI memory
+ *     such as recent trades starts empty.
+ *   - After a purchase decision the turn ends (no doubles re-roll); after
+ *     a trade decision the proposer's turn resumes from the roll.
+ *
+ * Branches run on a worker_threads pool (worker-pool.js), one decision
+ * per message. Pass { adjudicate: true } to stop settled rollouts early
+ * (see adjudicator.js).
+ *
+ * Usage:
+ *   node counterfactual.js                          # 10 games, declined/rejected only
+ *   node counterfactual.js --games 50 --rollouts 32 --workers 8
+ *   node counterfactual.js --all --adjudicate       # accepted decisions too
+ *   node counterfactual.js --json benchmark-results/counterfactual.json
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { isMainThread, workerData } = require('worker_threads');
+
+const { GameEngine, BOARD } = require('./game-engine.js');
+const { createRandom, deriveSeed, withSeed } = require('./seeded-random.js');
+const { runPool: runWorkerPool, serveJobs } = require('./worker-pool.js');
+const { quietly, createRunner } = require('./harness.js');
+
+const DEFAULTS = {
+    lineup: ['strategic', 'optimal', 'relative', 'growth'],
+    games: 10,
+    rollouts: 16,            // K paired rollouts per decision
+    maxTurns: 500,
+    seed: 20240601,
+    workers: os.cpus().length,
+    all: false,              // also audit purchases made and trades accepted
+    adjudicate: false        // stop settled rollouts early
+};
+
+const DICE_STREAM = 0x5EED;
+
+// =============================================================================
+// RECORDING
+// =============================================================================
+
+/**
+ * Engine that snapshots the game at each decision point. The AIs'
+ * decideBuy / evaluateTrade are wrapped per instance, so super calls inside
+ * an AI class are not counted - only the engine's and other AIs' calls.
+ */
+class RecordingEngine extends GameEngine {
+    constructor(options = {}) {
+        super(options);
+        this.decisions = [];
+        this.recordAll = options.all || false;
+    }
+
+    newGame(playerCount = 4, aiFactories = []) {
+        super.newGame(playerCount, aiFactories);
+        this.decisions = [];
+        for (const player of this.state.players) {
+            if (player.ai) this.wrap(player);
+        }
+    }
+
+    wrap(player) {
+        const ai = player.ai;
+        const engine = this;
+
+        if (ai.decideBuy) {
+            const decideBuy = ai.decideBuy.bind(ai);
+            ai.decideBuy = function (position, state) {
+                const affordable = player.money >= BOARD[position].price;
+                const snapshot = affordable ? engine.snapshot() : null;
+                const taken = decideBuy(position, state);
+                if (affordable && (!taken || engine.recordAll)) {
+                    engine.decisions.push({ kind: 'buy', player: player.id, position, taken: !!taken, snapshot });
+                }
+                return taken;
+            };
+        }
+
+        if (ai.evaluateTrade) {
+            const evaluateTrade = ai.evaluateTrade.bind(ai);
+            ai.evaluateTrade = function (offer, state) {
+                const snapshot = offer.to.id === player.id ? engine.snapshot() : null;
+                const response = evaluateTrade(offer, state);
+                if (snapshot && (response !== true || engine.recordAll)) {
+                    engine.decisions.push({
+                        kind: 'trade',
+                        player: player.id,
+                        proposer: offer.from.id,
+                        trade: {
+                            fromProperties: [...offer.fromProperties],
+                            toProperties: [...offer.toProperties],
+                            fromCash: offer.fromCash || 0
+                        },
+                        taken: response === true,
+                        snapshot
+                    });
+                }
+                return response;
+            };
+        }
+    }
+}
+
+/**
+ * Play `games` seeded games and collect their decision points.
+ * Each decision gets its own rollout seed, derived from its index.
+ */
+function recordDecisions(runner, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const decisions = [];
+    for (let g = 0; g < opts.games; g++) {
+        withSeed(deriveSeed(opts.seed, g), () => quietly(() => {
+            const engine = new RecordingEngine({ maxTurns: opts.maxTurns, all: opts.all });
+            engine.newGame(opts.lineup.length, opts.lineup.map(t => runner.createAIFactory(t)));
+            engine.runGame();
+            for (const d of engine.decisions) {
+                d.game = g;
+                d.index = decisions.length;
+                d.seed = deriveSeed(opts.seed ^ DICE_STREAM, d.index);
+                decisions.push(d);
+            }
+        }));
+    }
+    return decisions;
+}
+
+// =============================================================================
+// BRANCHING
+// =============================================================================
+
+/**
+ * Engine for one branch: restored from a snapshot, dice drawn from a
+ * dedicated generator so both branches of a pair roll the same sequence.
+ */
+class BranchEngine extends GameEngine {
+    constructor(options = {}) {
+        super(options);
+        this.dice = createRandom(options.diceSeed || 1);
+    }
+
+    rollDice() {
+        const d1 = Math.floor(this.dice() * 6) + 1;
+        const d2 = Math.floor(this.dice() * 6) + 1;
+        return { d1, d2, sum: d1 + d2, isDoubles: d1 === d2 };
+    }
+
+    /**
+     * Apply one side of the decision, then play the game out.
+     * @returns {Object} runGame() result
+     */
+    playBranch(decision, take) {
+        const player = this.state.players[decision.player];
+
+        if (decision.kind === 'buy') {
+            const square = BOARD[decision.position];
+            if (take && player.money >= square.price) {
+                player.money -= square.price;
+                player.properties.add(decision.position);
+                this.state.propertyStates[decision.position].owner = player.id;
+                this.propertyChanged(decision.position);
+                this.state.stats.propertiesBought[player.id]++;
+            } else {
+                this.runAuction(decision.position);
+            }
+            this.finishTurn(this.state.getCurrentPlayer());
+        } else {
+            if (take) {
+                this.executeTrade({
+                    from: this.state.players[decision.proposer],
+                    to: player,
+                    fromProperties: new Set(decision.trade.fromProperties),
+                    toProperties: new Set(decision.trade.toProperties),
+                    fromCash: decision.trade.fromCash
+                });
+            }
+            this.resumeTurn(this.state.getCurrentPlayer());
+        }
+
+        return this.runGame();
+    }
+
+    /** Rest of executeTurn() after preTurn */
+    resumeTurn(player) {
+        if (player.inJail) {
+            this.handleJailTurn(player);
+        } else {
+            this.handleNormalTurn(player);
+        }
+        this.finishTurn(player);
+    }
+
+    finishTurn(player) {
+        if (!player.bankrupt && player.ai && player.ai.postTurn) {
+            player.ai.postTurn(this.state);
+        }
+        this.advanceToNextPlayer();
+    }
+}
+
+/**
+ * Paired rollouts for one decision.
+ * @returns {{take: number, skip: number, delta: number, se: number, rollouts: number}}
+ */
+function branchAndCompare(decision, factories, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const diffs = new Array(opts.rollouts);
+    let takeWins = 0;
+    let skipWins = 0;
+
+    const rollout = (take, seed) => withSeed(seed, () => {
+        const engine = new BranchEngine({
+            maxTurns: opts.maxTurns,
+            adjudicate: opts.adjudicate,
+            diceSeed: deriveSeed(seed, DICE_STREAM)
+        });
+        engine.restore(decision.snapshot, factories);
+        return engine.playBranch(decision, take).winner === decision.player ? 1 : 0;
+    });
+
+    for (let k = 0; k < opts.rollouts; k++) {
+        const seed = deriveSeed(decision.seed, k);
+        const take = rollout(true, seed);
+        const skip = rollout(false, seed);
+        takeWins += take;
+        skipWins += skip;
+        diffs[k] = take - skip;
+    }
+
+    const n = opts.rollouts;
+    const delta = (takeWins - skipWins) / n;
+    let ss = 0;
+    for (const d of diffs) ss += (d - delta) * (d - delta);
+    const se = n > 1 ? Math.sqrt(ss / (n - 1) / n) : 0;
+
+    return { take: takeWins / n, skip: skipWins / n, delta, se, rollouts: n };
+}
+
+/** True when the outcome says the other choice was better (|z| > 2) */
+function isMistake(decision, result) {
+    if (result.delta === 0) return false;
+    const z = result.se > 0 ? result.delta / result.se : Math.sign(result.delta) * Infinity;
+    return decision.taken ? z < -2 : z > 2;
+}
+
+// =============================================================================
+// WORKER POOL
+// =============================================================================
+
+function workerMain() {
+    const runner = createRunner({ maxTurns: workerData.options.maxTurns });
+    const factories = workerData.options.lineup.map(t => runner.createAIFactory(t));
+
+    serveJobs('decision', msg => ({
+        result: quietly(() => branchAndCompare(msg.decision, factories, workerData.options))
+    }));
+}
+
+/**
+ * Branch every decision on a pool of worker threads. Decisions are handed
+ * out one at a time so long rollouts don't strand a worker.
+ * @returns {Promise<Object[]>} results in decision order
+ */
+async function runPool(decisions, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const workerOptions = { ...opts };
+    delete workerOptions.onProgress;
+
+    const results = await runWorkerPool(__filename, decisions.map(decision => ({ type: 'decision', decision })), {
+        workers: opts.workers,
+        workerData: { options: workerOptions },
+        onProgress: opts.onProgress
+    });
+    return results.map(msg => msg.result);
+}
+
+// =============================================================================
+// REPORT
+// =============================================================================
+
+function describe(decision) {
+    if (decision.kind === 'buy') {
+        return `P${decision.player} ${decision.taken ? 'bought' : 'declined'} ${BOARD[decision.position].name}`;
+    }
+    const names = (list) => list.map(p => BOARD[p].name).join(', ') || '-';
+    const t = decision.trade;
+    const cash = t.fromCash ? ` ${t.fromCash > 0 ? '+' : '-'}$${Math.abs(t.fromCash)}` : '';
+    return `P${decision.player} ${decision.taken ? 'accepted' : 'rejected'} ` +
+        `[${names(t.fromProperties)}${cash}] for [${names(t.toProperties)}] from P${decision.proposer}`;
+}
+
+function printReport(decisions, results, elapsed) {
+    const groups = {};
+    decisions.forEach((d, i) => {
+        const key = `${d.kind}/${d.taken ? 'taken' : 'declined'}`;
+        const g = groups[key] || (groups[key] = { count: 0, delta: 0, mistakes: 0 });
+        g.count++;
+        g.delta += results[i].delta;
+        if (isMistake(d, results[i])) g.mistakes++;
+    });
+
+    console.log(`\n  ${'Decision'.padEnd(16)} ${'Count'.padStart(7)} ${'Mean delta'.padStart(11)} ${'Mistakes'.padStart(9)}`);
+    console.log('  ' + '-'.repeat(46));
+    for (const [key, g] of Object.entries(groups)) {
+        console.log(`  ${key.padEnd(16)} ${String(g.count).padStart(7)} ` +
+            `${((g.delta / g.count) * 100).toFixed(1).padStart(10)}% ${String(g.mistakes).padStart(9)}`);
+    }
+
+    const flagged = decisions.map((d, i) => ({ d, r: results[i] }))
+        .filter(x => isMistake(x.d, x.r))
+        .sort((a, b) => Math.abs(b.r.delta) - Math.abs(a.r.delta))
+        .slice(0, 10);
+    if (flagged.length > 0) {
+        console.log('\n  Largest flagged decisions (delta = P(win|take) - P(win|skip)):');
+        for (const { d, r } of flagged) {
+            console.log(`    game ${String(d.game).padStart(3)} turn ${String(d.snapshot.turn).padStart(3)}  ` +
+                `${(r.delta * 100).toFixed(0).padStart(4)}% +/- ${(r.se * 100).toFixed(0)}%  ${describe(d)}`);
+        }
+    }
+
+    const rollouts = results.reduce((s, r) => s + 2 * r.rollouts, 0);
+    console.log(`\n  ${decisions.length} decisions, ${rollouts} rollouts in ${elapsed.toFixed(1)}s ` +
+        `(${(decisions.length / elapsed).toFixed(2)} decisions/sec, ${(rollouts / elapsed).toFixed(0)} rollouts/sec)`);
+}
+
+module.exports = {
+    RecordingEngine,
+    BranchEngine,
+    recordDecisions,
+    branchAndCompare,
+    isMistake,
+    runPool,
+    DEFAULTS
+};
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+async function main() {
+    const args = process.argv.slice(2);
+    const options = {};
+    let json = null;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--games': options.games = parseInt(args[++i], 10); break;
+            case '--rollouts': options.rollouts = parseInt(args[++i], 10); break;
+            case '--workers': options.workers = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--max-turns': options.maxTurns = parseInt(args[++i], 10); break;
+            case '--all': options.all = true; break;
+            case '--adjudicate': options.adjudicate = true; break;
+            case '--json': json = args[++i]; break;
+        }
+    }
+    const opts = { ...DEFAULTS, ...options };
+
+    console.log('Counterfactual Decision Audit');
+    console.log('='.repeat(70));
+    console.log(`Lineup: ${opts.lineup.join(', ')}   Games: ${opts.games}   Rollouts: ${opts.rollouts} x 2   ` +
+        `Workers: ${opts.workers}${opts.adjudicate ? '   (adjudicated)' : ''}`);
+
+    const runner = createRunner({ maxTurns: opts.maxTurns });
+    const decisions = recordDecisions(runner, opts);
+    console.log(`Recorded ${decisions.length} decisions`);
+
+    const start = Date.now();
+    const results = await runPool(decisions, {
+        ...opts,
+        onProgress: (done, total) => {
+            if (done % 50 === 0 || done === total) process.stdout.write(`\r  ${done}/${total} branched`);
+        }
+    });
+    process.stdout.write('\n');
+    printReport(decisions, results, (Date.now() - start) / 1000);
+
+    if (json) {
+        const out = decisions.map((d, i) => {
+            const { snapshot, ...rest } = d;
+            return { ...rest, turn: snapshot.turn, ...results[i], mistake: isMistake(d, results[i]) };
+        });
+        fs.mkdirSync(path.dirname(path.resolve(json)), { recursive: true });
+        fs.writeFileSync(json, JSON.stringify(out, null, 2));
+        console.log(`\nResults written to ${json}`);
+    }
+}
+
+if (!isMainThread) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
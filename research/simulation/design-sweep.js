@@ -0,0 +1,478 @@
+/**
+ * Design-of-Experiments Parameter Sweep
+ *
+ * Joint-space replacement for ParameterSweep.sweepParameter() in
+ * parameter-sweep.js, which varies one parameter at a time over a
+ * hand-picked list and so can't see interactions. Here:
+ *
+ *   1. Design    Latin hypercube (each parameter's range cut into n strata,
+ *                one point per stratum) or a Sobol low-discrepancy
+ *                sequence, over all SWEEP_SPACE parameters at once.
+ *   2. Run       Every design point plays runComparison() against the
+ *                default config on a worker_threads pool. Game i uses the
+ *                same seed at every design point (common random numbers),
+ *                so differences between points aren't dice noise.
+ *   3. Fit       A full quadratic response surface (intercept, linear,
+ *                squared and pairwise interaction terms) is fitted by
+ *                weighted least squares to the win share vs default, on
+ *                coded variables in [-1, 1].
+ *   4. Optimize  The fitted surface is maximized over the box by
+ *                coordinate ascent from every design point. Coefficients
+ *                come with standard errors, so main effects and
+ *                interactions can be read off directly.
+ *
+ * Usage:
+ *   node design-sweep.js                               # 40-point LHS, 100 games each
+ *   node design-sweep.js --design sobol --points 64 --games 200 --workers 8
+ *   node design-sweep.js --confirm 1000                # head-to-head check of the optimum
+ *   node design-sweep.js --json benchmark-results/design-sweep.json
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { isMainThread, workerData } = require('worker_threads');
+
+const { createRandom, deriveSeed } = require('./seeded-random.js');
+const { runPool, serveJobs } = require('./worker-pool.js');
+const { quietly } = require('./harness.js');
+
+/** ConfigurableTradingAI parameters and the ranges parameter-sweep.js explores */
+const SWEEP_SPACE = [
+    { name: 'cashPremiumMultiplier', min: 5, max: 25, default: 10 },
+    { name: 'maxCashOffer', min: 0.3, max: 0.9, default: 0.5 },
+    { name: 'acceptanceThreshold', min: -200, max: 0, default: -50 },
+    { name: 'paybackLimit', min: 20, max: 60, default: 40 }
+];
+
+const DEFAULTS = {
+    design: 'lhs',           // 'lhs' or 'sobol'
+    points: 40,
+    games: 100,              // per design point
+    chunk: 20,               // games per worker job
+    workers: os.cpus().length,
+    seed: 20240601,
+    maxTurns: 500,
+    confirm: 0               // games for optimum vs default afterwards
+};
+
+// =============================================================================
+// DESIGNS
+// =============================================================================
+
+/**
+ * Latin hypercube: n points in [0,1)^d, exactly one per stratum per axis.
+ */
+function latinHypercube(n, d, random = Math.random) {
+    const points = Array.from({ length: n }, () => new Array(d));
+    for (let j = 0; j < d; j++) {
+        const strata = Array.from({ length: n }, (_, i) => i);
+        for (let i = n - 1; i > 0; i--) {
+            const k = Math.floor(random() * (i + 1));
+            [strata[i], strata[k]] = [strata[k], strata[i]];
+        }
+        for (let i = 0; i < n; i++) points[i][j] = (strata[i] + random()) / n;
+    }
+    return points;
+}
+
+// Joe & Kuo direction numbers (new-joe-kuo-6.21201) for dimensions 2..8
+const SOBOL_DIRECTIONS = [
+    { s: 1, a: 0, m: [1] },
+    { s: 2, a: 1, m: [1, 3] },
+    { s: 3, a: 1, m: [1, 3, 1] },
+    { s: 3, a: 2, m: [1, 1, 1] },
+    { s: 4, a: 1, m: [1, 1, 3, 3] },
+    { s: 4, a: 4, m: [1, 3, 5, 13] },
+    { s: 5, a: 2, m: [1, 1, 5, 5, 17] }
+];
+
+/**
+ * Sobol sequence: first n points in [0,1)^d after the origin (Gray-code
+ * construction, up to 8 dimensions).
+ */
+function sobol(n, d) {
+    if (d > SOBOL_DIRECTIONS.length + 1) throw new Error(`Sobol: at most ${SOBOL_DIRECTIONS.length + 1} dimensions`);
+    const L = Math.max(1, Math.ceil(Math.log2(n + 1)));
+    const V = [];
+
+    // Dimension 1 is the van der Corput sequence
+    V.push(Array.from({ length: L + 1 }, (_, i) => (i === 0 ? 0 : Math.pow(2, 32 - i) >>> 0)));
+    for (let j = 1; j < d; j++) {
+        const { s, a, m } = SOBOL_DIRECTIONS[j - 1];
+        const v = new Array(L + 1).fill(0);
+        for (let i = 1; i <= L; i++) {
+            if (i <= s) {
+                v[i] = (m[i - 1] * Math.pow(2, 32 - i)) >>> 0;
+            } else {
+                v[i] = (v[i - s] ^ (v[i - s] >>> s)) >>> 0;
+                for (let k = 1; k < s; k++) {
+                    if ((a >>> (s - 1 - k)) & 1) v[i] = (v[i] ^ v[i - k]) >>> 0;
+                }
+            }
+        }
+        V.push(v);
+    }
+
+    const x = new Array(d).fill(0);
+    const points = [];
+    for (let i = 0; i < n; i++) {
+        // Index of the lowest zero bit of i, 1-based
+        let c = 1;
+        let value = i;
+        while (value & 1) {
+            value >>>= 1;
+            c++;
+        }
+        for (let j = 0; j < d; j++) x[j] = (x[j] ^ V[j][c]) >>> 0;
+        points.push(x.map(xi => xi / 4294967296));
+    }
+    return points;
+}
+
+function toConfig(u) {
+    const config = {};
+    SWEEP_SPACE.forEach((param, j) => {
+        const value = param.min + u[j] * (param.max - param.min);
+        config[param.name] = Math.round(value * 1000) / 1000;
+    });
+    return config;
+}
+
+function defaultConfig() {
+    return Object.fromEntries(SWEEP_SPACE.map(p => [p.name, p.default]));
+}
+
+// =============================================================================
+// QUADRATIC RESPONSE SURFACE
+// =============================================================================
+
+/** Term list for a full quadratic in d variables */
+function quadraticTerms(d) {
+    const terms = [{ label: 'intercept', vars: [] }];
+    for (let i = 0; i < d; i++) terms.push({ label: `x${i}`, vars: [i] });
+    for (let i = 0; i < d; i++) terms.push({ label: `x${i}^2`, vars: [i, i] });
+    for (let i = 0; i < d; i++) {
+        for (let j = i + 1; j < d; j++) terms.push({ label: `x${i}*x${j}`, vars: [i, j] });
+    }
+    return terms;
+}
+
+function termValues(terms, x) {
+    return terms.map(t => t.vars.reduce((p, v) => p * x[v], 1));
+}
+
+/** Solve A x = b by Gaussian elimination with partial pivoting; also returns A^-1 */
+function solveWithInverse(A, b) {
+    const n = A.length;
+    const M = A.map((row, i) => [...row, b[i], ...row.map((_, j) => (i === j ? 1 : 0))]);
+    for (let col = 0; col < n; col++) {
+        let pivot = col;
+        for (let r = col + 1; r < n; r++) if (Math.abs(M[r][col]) > Math.abs(M[pivot][col])) pivot = r;
+        if (Math.abs(M[pivot][col]) < 1e-12) throw new Error('Response surface: singular design (too few or degenerate points)');
+        [M[col], M[pivot]] = [M[pivot], M[col]];
+        const div = M[col][col];
+        for (let k = 0; k < M[col].length; k++) M[col][k] /= div;
+        for (let r = 0; r < n; r++) {
+            if (r === col || M[r][col] === 0) continue;
+            const f = M[r][col];
+            for (let k = 0; k < M[r].length; k++) M[r][k] -= f * M[col][k];
+        }
+    }
+    return { x: M.map(row => row[n]), inverse: M.map(row => row.slice(n + 1)) };
+}
+
+/**
+ * Weighted least-squares quadratic fit.
+ * @param {number[][]} X - coded design points in [-1,1]^d
+ * @param {number[]} y - responses
+ * @param {number[]} w - weights (e.g. games per point)
+ */
+class ResponseSurface {
+    constructor(X, y, w = null) {
+        const d = X[0].length;
+        this.d = d;
+        this.terms = quadraticTerms(d);
+        const k = this.terms.length;
+        const weights = w || y.map(() => 1);
+
+        const XtWX = Array.from({ length: k }, () => new Array(k).fill(0));
+        const XtWy = new Array(k).fill(0);
+        const rows = X.map(x => termValues(this.terms, x));
+        rows.forEach((row, r) => {
+            for (let i = 0; i < k; i++) {
+                XtWy[i] += weights[r] * row[i] * y[r];
+                for (let j = 0; j < k; j++) XtWX[i][j] += weights[r] * row[i] * row[j];
+            }
+        });
+
+        const { x: beta, inverse } = solveWithInverse(XtWX, XtWy);
+        this.beta = beta;
+
+        let sse = 0, sst = 0, wsum = 0, ybar = 0;
+        rows.forEach((row, r) => { wsum += weights[r]; ybar += weights[r] * y[r]; });
+        ybar /= wsum;
+        rows.forEach((row, r) => {
+            const e = y[r] - row.reduce((s, v, i) => s + v * beta[i], 0);
+            sse += weights[r] * e * e;
+            sst += weights[r] * (y[r] - ybar) * (y[r] - ybar);
+        });
+        const dof = Math.max(1, X.length - k);
+        const s2 = sse / dof;
+        this.cov = inverse.map(row => row.map(v => v * s2));
+        this.se = this.cov.map((row, i) => Math.sqrt(Math.max(0, row[i])));
+        this.r2 = sst > 0 ? 1 - sse / sst : 1;
+        this.dof = dof;
+    }
+
+    predict(x) {
+        return termValues(this.terms, x).reduce((s, v, i) => s + v * this.beta[i], 0);
+    }
+
+    /** Standard error of the fitted mean at x */
+    predictSE(x) {
+        const f = termValues(this.terms, x);
+        let v = 0;
+        for (let i = 0; i < f.length; i++) {
+            for (let j = 0; j < f.length; j++) v += f[i] * this.cov[i][j] * f[j];
+        }
+        return Math.sqrt(Math.max(0, v));
+    }
+
+    /**
+     * Maximize over [-1,1]^d by exact coordinate ascent (the surface is
+     * quadratic in each coordinate), restarted from each start point.
+     */
+    maximize(starts) {
+        const d = this.d;
+        const index = (label) => this.terms.findIndex(t => t.label === label);
+        const lin = Array.from({ length: d }, (_, i) => this.beta[index(`x${i}`)]);
+        const sq = Array.from({ length: d }, (_, i) => this.beta[index(`x${i}^2`)]);
+        const cross = Array.from({ length: d }, () => new Array(d).fill(0));
+        for (let i = 0; i < d; i++) {
+            for (let j = i + 1; j < d; j++) {
+                cross[i][j] = cross[j][i] = this.beta[index(`x${i}*x${j}`)];
+            }
+        }
+
+        let best = null;
+        for (const start of starts) {
+            const x = start.slice();
+            for (let sweep = 0; sweep < 200; sweep++) {
+                let moved = 0;
+                for (let i = 0; i < d; i++) {
+                    // f(xi) = sq xi^2 + (lin + sum cross xj) xi + const
+                    let b = lin[i];
+                    for (let j = 0; j < d; j++) if (j !== i) b += cross[i][j] * x[j];
+                    let xi;
+                    if (sq[i] < 0) {
+                        xi = Math.max(-1, Math.min(1, -b / (2 * sq[i])));
+                    } else {
+                        xi = sq[i] + b >= sq[i] - b ? 1 : -1;
+                    }
+                    moved = Math.max(moved, Math.abs(xi - x[i]));
+                    x[i] = xi;
+                }
+                if (moved < 1e-9) break;
+            }
+            const value = this.predict(x);
+            if (!best || value > best.value) best = { x, value };
+        }
+        return best;
+    }
+}
+
+// =============================================================================
+// WORKER POOL
+// =============================================================================
+
+function workerMain() {
+    const sweep = quietly(() => {
+        const { ParameterSweep } = require('./parameter-sweep.js');
+        return new ParameterSweep({ maxTurns: workerData.maxTurns });
+    });
+
+    serveJobs('job', (msg) => {
+        const result = quietly(() => sweep.runComparison(msg.config, msg.baseline, msg.games,
+            { seed: msg.seed, firstGame: msg.firstGame }));
+        return {
+            wins: result.config1Wins,
+            losses: result.config2Wins,
+            timeouts: result.timeouts,
+            turns: result.totalTurns
+        };
+    });
+}
+
+/**
+ * Play each config against the baseline for `games` games, split into
+ * chunks across a worker pool. Every config sees game seeds 0..games-1.
+ * @returns {Promise<Object[]>} per config { wins, losses, timeouts, turns }
+ */
+async function runDesign(configs, baseline, options = {}) {
+    const opts = { ...DEFAULTS, ...options };
+    const jobs = [];
+    const points = [];
+    configs.forEach((config, c) => {
+        for (let g = 0; g < opts.games; g += opts.chunk) {
+            jobs.push({ type: 'job', config, baseline, seed: opts.seed, firstGame: g,
+                games: Math.min(opts.chunk, opts.games - g) });
+            points.push(c);
+        }
+    });
+    const totals = configs.map(() => ({ wins: 0, losses: 0, timeouts: 0, turns: 0 }));
+
+    const results = await runPool(__filename, jobs, {
+        workers: opts.workers,
+        workerData: { maxTurns: opts.maxTurns },
+        onProgress: opts.onProgress
+    });
+    results.forEach((msg, i) => {
+        const t = totals[points[i]];
+        t.wins += msg.wins;
+        t.losses += msg.losses;
+        t.timeouts += msg.timeouts;
+        t.turns += msg.turns;
+    });
+    return totals;
+}
+
+/** Win share vs baseline over decided games */
+function share(t) {
+    const decided = t.wins + t.losses;
+    return decided > 0 ? t.wins / decided : 0.5;
+}
+
+module.exports = {
+    SWEEP_SPACE,
+    latinHypercube,
+    sobol,
+    toConfig,
+    defaultConfig,
+    quadraticTerms,
+    ResponseSurface,
+    runDesign,
+    share,
+    DEFAULTS
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+async function main() {
+    const args = process.argv.slice(2);
+    const options = {};
+    let json = null;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--design': options.design = args[++i]; break;
+            case '--points': options.points = parseInt(args[++i], 10); break;
+            case '--games': options.games = parseInt(args[++i], 10); break;
+            case '--workers': options.workers = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--confirm': options.confirm = parseInt(args[++i], 10); break;
+            case '--json': json = args[++i]; break;
+        }
+    }
+    const opts = { ...DEFAULTS, ...options };
+    const d = SWEEP_SPACE.length;
+    const terms = quadraticTerms(d).length;
+    if (opts.points <= terms) {
+        console.error(`--points must exceed the ${terms} quadratic terms for ${d} parameters`);
+        process.exit(1);
+    }
+
+    console.log('='.repeat(70));
+    console.log('DESIGN-OF-EXPERIMENTS PARAMETER SWEEP');
+    console.log('='.repeat(70));
+    console.log(`Design: ${opts.design} x ${opts.points} points over ${SWEEP_SPACE.map(p => p.name).join(', ')}`);
+    console.log(`Each point: ${opts.games} games vs default (2v2, alternating seats, common seeds); ` +
+        `${opts.workers} workers`);
+
+    const unit = opts.design === 'sobol'
+        ? sobol(opts.points, d)
+        : latinHypercube(opts.points, d, createRandom(opts.seed));
+    const configs = unit.map(toConfig);
+    const baseline = defaultConfig();
+
+    const start = Date.now();
+    const totals = await runDesign(configs, baseline, {
+        ...opts,
+        onProgress: (done, total) => process.stdout.write(`\r  ${done}/${total} jobs`)
+    });
+    const seconds = (Date.now() - start) / 1000;
+    process.stdout.write('\n');
+
+    const y = totals.map(share);
+    const w = totals.map(t => t.wins + t.losses);
+    const coded = unit.map(u => u.map(v => 2 * v - 1));
+    const surface = new ResponseSurface(coded, y, w);
+    if (opts.points < 2 * surface.terms.length) {
+        console.log(`\nNote: ${opts.points} points for ${surface.terms.length} terms - ` +
+            `the surface is barely determined; use --points ${2 * surface.terms.length} or more.`);
+    }
+
+    const ranked = configs.map((config, i) => ({ config, y: y[i], t: totals[i] })).sort((a, b) => b.y - a.y);
+    console.log('\nTop design points (win share vs default):');
+    for (const r of ranked.slice(0, 5)) {
+        console.log(`  ${(r.y * 100).toFixed(1).padStart(5)}%  ${JSON.stringify(r.config)}`);
+    }
+
+    console.log(`\nQuadratic response surface (R^2 = ${surface.r2.toFixed(3)}, ${surface.dof} residual dof); ` +
+        'coded units, |t| > 2 marked:');
+    const names = SWEEP_SPACE.map(p => p.name);
+    surface.terms.forEach((term, i) => {
+        const label = term.vars.length === 0 ? 'intercept'
+            : term.vars.length === 1 ? names[term.vars[0]]
+                : term.vars[0] === term.vars[1] ? `${names[term.vars[0]]}^2`
+                    : `${names[term.vars[0]]} x ${names[term.vars[1]]}`;
+        const t = surface.se[i] > 0 ? surface.beta[i] / surface.se[i] : 0;
+        console.log(`  ${label.padEnd(46)} ${surface.beta[i].toFixed(4).padStart(8)} ` +
+            `+/- ${surface.se[i].toFixed(4)}${Math.abs(t) > 2 ? '  *' : ''}`);
+    });
+
+    const optimum = surface.maximize(coded);
+    const optimumConfig = toConfig(optimum.x.map(v => (v + 1) / 2));
+    console.log(`\nFitted optimum: ${JSON.stringify(optimumConfig)}`);
+    console.log(`  Predicted win share vs default: ${(optimum.value * 100).toFixed(1)}% ` +
+        `+/- ${(surface.predictSE(optimum.x) * 100).toFixed(1)}%`);
+
+    const games = totals.reduce((s, t) => s + t.wins + t.losses + t.timeouts, 0);
+    console.log(`\n${games} games in ${seconds.toFixed(1)}s (${(games / seconds).toFixed(1)} games/sec)`);
+
+    let confirmation = null;
+    if (opts.confirm > 0) {
+        const [t] = await runDesign([optimumConfig], baseline,
+            { ...opts, games: opts.confirm, seed: deriveSeed(opts.seed, 0xC0F) });
+        const p = share(t);
+        const se = Math.sqrt(p * (1 - p) / Math.max(1, t.wins + t.losses));
+        confirmation = { ...t, share: p, se };
+        console.log(`Confirmation (${opts.confirm} fresh games): optimum wins ${(p * 100).toFixed(1)}% +/- ${(se * 100).toFixed(1)}%`);
+    }
+
+    if (json) {
+        const report = {
+            design: opts.design,
+            points: configs.map((config, i) => ({ config, ...totals[i], share: y[i] })),
+            surface: surface.terms.map((term, i) => ({ term: term.label, beta: surface.beta[i], se: surface.se[i] })),
+            r2: surface.r2,
+            optimum: { config: optimumConfig, predicted: optimum.value, se: surface.predictSE(optimum.x) },
+            confirmation
+        };
+        fs.mkdirSync(path.dirname(path.resolve(json)), { recursive: true });
+        fs.writeFileSync(json, JSON.stringify(report, null, 2));
+        console.log(`\nResults written to ${json}`);
+    }
+}
+
+if (!isMainThread) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
@@ -0,0 +1,454 @@
+/**
+ * Heads-Up Endgame Tablebase
+ *
+ * Win probabilities for two-player endgames, solved offline by value
+ * iteration over an abstracted state and probed in O(1) during play -
+ * the Monopoly analogue of a chess endgame tablebase.
+ *
+ * ABSTRACTION
+ *   Each side's holdings are reduced to a rent profile: the chance the
+ *   opponent lands on one of its rent squares in a turn (hit) and the mean
+ *   rent when they do (rent), both bucketed. Each side's money is its
+ *   liquid worth (cash + house sale value + mortgage value), bucketed in
+ *   CASH_STEP dollars with bilinear interpolation between buckets.
+ *
+ *   On a turn the mover collects INCOME (Go and cards), then with
+ *   probability `hit` pays the opponent `rent`. A player whose liquid worth
+ *   goes negative is bankrupt. Holdings are frozen, and each turn the game
+ *   ends undecided (scored 0.5) with probability HAZARD - the stand-in for
+ *   maxTurns.
+ *
+ *   W(me, opp, myCash, oppCash) = P(mover wins), and with the roles
+ *   swapped after every turn:
+ *     W = (1 - HAZARD) * E[1 - W(opp, me, oppCash', myCash')] + HAZARD / 2
+ *
+ * STORAGE
+ *   A flat binary file: header, bucket centers, then uint16 win
+ *   probabilities (x 65535) indexed [me][opp][myCash][oppCash]. load()
+ *   wraps the file bytes in a typed-array view without copying.
+ *
+ * Usage:
+ *   node endgame-tablebase.js --build          # solve and write the table
+ *   node endgame-tablebase.js --probe 11       # probe a seeded game's endgame
+ *   node endgame-tablebase.js --calibrate 100  # compare probes with outcomes
+ *
+ *   const tb = EndgameTablebase.open();
+ *   tb.probe(engine, playerId, probs)          // P(playerId wins), 2 players left
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const { BOARD } = require('./game-engine.js');
+
+const DEFAULT_FILE = path.join(__dirname, '.endgame-tablebase.bin');
+const MAGIC = 'HUT1';
+const HEADER = 64;
+
+const DEFAULTS = {
+    hitCenters: [0.04, 0.08, 0.14, 0.24, 0.40],
+    rentCenters: [25, 45, 80, 145, 260, 470, 850, 1550],
+    cashStep: 200,
+    cashBuckets: 16,        // $0 - $3000
+    income: 38,             // ~$35 from Go + ~$3 from cards per turn
+    hazard: 0.004,          // ~250 turns of endgame left on average
+    tolerance: 1e-4,        // bound on the solved values' error
+    maxSweeps: 20000
+};
+
+class EndgameTablebase {
+    constructor(params, values) {
+        this.params = params;
+        this.values = values;
+        this.profileCount = 1 + params.hitCenters.length * params.rentCenters.length;
+    }
+
+    // =========================================================================
+    // SOLVER
+    // =========================================================================
+
+    /**
+     * Solve every profile pair by Gauss-Seidel value iteration.
+     * Pairs (a, b) and (b, a) feed each other and are solved together.
+     */
+    static build(options = {}) {
+        const params = { ...DEFAULTS, ...options };
+        const tb = new EndgameTablebase(params, null);
+        const P = tb.profileCount;
+        const B = params.cashBuckets;
+        const cells = B * B;
+
+        const values = new Uint16Array(P * P * cells);
+        const stats = { pairs: 0, sweeps: 0, maxSweeps: 0, unconverged: 0 };
+
+        for (let a = 0; a < P; a++) {
+            for (let b = a; b < P; b++) {
+                const ab = new Float64Array(cells).fill(0.5);
+                const ba = a === b ? ab : new Float64Array(cells).fill(0.5);
+                const planAB = tb.plan(b);   // I am a, I pay b's rent
+                const planBA = tb.plan(a);
+
+                // Each sweep contracts by (1 - hazard), so the remaining error
+                // is up to delta / hazard
+                const stop = params.tolerance * params.hazard;
+                let sweeps = 0;
+                let delta = Infinity;
+                while (delta > stop && sweeps < params.maxSweeps) {
+                    delta = Math.max(sweep(ab, ba, planAB, params.hazard),
+                        a === b ? 0 : sweep(ba, ab, planBA, params.hazard));
+                    sweeps++;
+                }
+
+                stats.pairs++;
+                stats.sweeps += sweeps;
+                stats.maxSweeps = Math.max(stats.maxSweeps, sweeps);
+                if (delta > stop) stats.unconverged++;
+
+                values.set(quantize(ab), (a * P + b) * cells);
+                values.set(quantize(ba), (b * P + a) * cells);
+            }
+        }
+
+        tb.values = values;
+        tb.stats = stats;
+        return tb;
+    }
+
+    /**
+     * Transition plan for a mover who pays `opp`'s rent profile: for every
+     * cash cell, interpolation indices/weights into the swapped table for
+     * the miss and the hit outcome (hit weights all zero = bankrupt).
+     */
+    plan(opp) {
+        const { cashStep, cashBuckets: B, income } = this.params;
+        const { hit, rent } = this.profileCenter(opp);
+        const idx = new Int32Array(B * B * 8);
+        const w = new Float64Array(B * B * 8);
+
+        for (let i = 0; i < B; i++) {
+            for (let j = 0; j < B; j++) {
+                const cell = (i * B + j) * 8;
+                const myCash = i * cashStep + income;
+                const oppCash = j * cashStep;
+
+                // Next turn the opponent moves: their cash is the first axis
+                bilinear(oppCash / cashStep, myCash / cashStep, B, idx, w, cell, 1 - hit);
+                if (hit > 0 && myCash - rent >= 0) {
+                    bilinear((oppCash + rent) / cashStep, (myCash - rent) / cashStep, B, idx, w, cell + 4, hit);
+                }
+            }
+        }
+        return { idx, w };
+    }
+
+    // =========================================================================
+    // PROFILES
+    // =========================================================================
+
+    /** Bucket centers for a profile index */
+    profileCenter(profile) {
+        if (profile === 0) return { hit: 0, rent: 0 };
+        const R = this.params.rentCenters.length;
+        return {
+            hit: this.params.hitCenters[Math.floor((profile - 1) / R)],
+            rent: this.params.rentCenters[(profile - 1) % R]
+        };
+    }
+
+    /** Nearest profile (log scale) for a hit chance and mean rent */
+    profileIndex(hit, rent) {
+        if (!(hit > 0) || !(rent > 0)) return 0;
+        const nearest = (centers, x) => {
+            let best = 0;
+            for (let k = 1; k < centers.length; k++) {
+                if (Math.abs(Math.log(centers[k] / x)) < Math.abs(Math.log(centers[best] / x))) best = k;
+            }
+            return best;
+        };
+        return 1 + nearest(this.params.hitCenters, hit) * this.params.rentCenters.length +
+            nearest(this.params.rentCenters, rent);
+    }
+
+    /**
+     * Rent profile of a player's holdings as the opponent sees them:
+     * hit = P(landing on a rent square), rent = mean rent when landing.
+     */
+    static sideProfile(engine, playerId, probs) {
+        let hit = 0;
+        let expected = 0;
+        for (let sq = 0; sq < BOARD.length; sq++) {
+            const ps = engine.state.propertyStates[sq];
+            if (!ps || ps.owner !== playerId) continue;
+            const rent = engine.calculateRent(sq, 7);
+            if (rent <= 0) continue;
+            const p = probs ? probs[sq] : 0.025;
+            hit += p;
+            expected += p * rent;
+        }
+        return { hit, rent: hit > 0 ? expected / hit : 0, ept: expected };
+    }
+
+    /** Cash plus everything the player could raise by selling and mortgaging */
+    static liquidWorth(state, player) {
+        let worth = player.money;
+        for (const sq of player.properties) {
+            const ps = state.propertyStates[sq];
+            const square = BOARD[sq];
+            worth += Math.floor((ps.houses || 0) * (square.housePrice || 0) / 2);
+            if (!ps.mortgaged) worth += Math.floor(square.price / 2);
+        }
+        return worth;
+    }
+
+    // =========================================================================
+    // PROBING
+    // =========================================================================
+
+    /** P(mover wins), interpolated between cash buckets */
+    value(me, opp, myCash, oppCash) {
+        const { cashStep, cashBuckets: B } = this.params;
+        if (myCash < 0) return 0;
+        if (oppCash < 0) return 1;
+
+        const base = (me * this.profileCount + opp) * B * B;
+        const u = clampIndex(myCash / cashStep, B);
+        const v = clampIndex(oppCash / cashStep, B);
+        const i0 = Math.floor(u), j0 = Math.floor(v);
+        const i1 = Math.min(i0 + 1, B - 1), j1 = Math.min(j0 + 1, B - 1);
+        const fu = u - i0, fv = v - j0;
+
+        const at = (i, j) => this.values[base + i * B + j] / 65535;
+        return (1 - fu) * ((1 - fv) * at(i0, j0) + fv * at(i0, j1)) +
+            fu * ((1 - fv) * at(i1, j0) + fv * at(i1, j1));
+    }
+
+    /**
+     * P(playerId wins) in a live two-player endgame.
+     * @returns {number|null} null if more or fewer than two players remain
+     */
+    probe(engine, playerId, probs) {
+        const state = engine.state;
+        const active = state.getActivePlayers();
+        if (active.length !== 2) return null;
+
+        const me = active.find(p => p.id === playerId);
+        const opp = active.find(p => p.id !== playerId);
+        if (!me) return null;
+
+        const myProfile = EndgameTablebase.sideProfile(engine, me.id, probs);
+        const oppProfile = EndgameTablebase.sideProfile(engine, opp.id, probs);
+        const a = this.profileIndex(myProfile.hit, myProfile.rent);
+        const b = this.profileIndex(oppProfile.hit, oppProfile.rent);
+        const myWorth = EndgameTablebase.liquidWorth(state, me);
+        const oppWorth = EndgameTablebase.liquidWorth(state, opp);
+
+        const myMove = state.getCurrentPlayer().id === me.id;
+        return myMove
+            ? this.value(a, b, myWorth, oppWorth)
+            : 1 - this.value(b, a, oppWorth, myWorth);
+    }
+
+    // =========================================================================
+    // FILE FORMAT
+    // =========================================================================
+
+    save(file = DEFAULT_FILE) {
+        const p = this.params;
+        const centers = [...p.hitCenters, ...p.rentCenters];
+        const header = Buffer.alloc(HEADER + centers.length * 8);
+        header.write(MAGIC, 0, 'ascii');
+        header.writeUInt16LE(1, 4);
+        header.writeUInt16LE(p.hitCenters.length, 6);
+        header.writeUInt16LE(p.rentCenters.length, 8);
+        header.writeUInt16LE(p.cashBuckets, 10);
+        header.writeDoubleLE(p.cashStep, 16);
+        header.writeDoubleLE(p.income, 24);
+        header.writeDoubleLE(p.hazard, 32);
+        centers.forEach((c, k) => header.writeDoubleLE(c, HEADER + k * 8));
+
+        const body = Buffer.from(this.values.buffer, this.values.byteOffset, this.values.byteLength);
+        fs.writeFileSync(file, Buffer.concat([header, body]));
+        return file;
+    }
+
+    static load(file = DEFAULT_FILE) {
+        const buf = fs.readFileSync(file);
+        if (buf.toString('ascii', 0, 4) !== MAGIC) {
+            throw new Error(`${file} is not an endgame tablebase`);
+        }
+        const H = buf.readUInt16LE(6);
+        const R = buf.readUInt16LE(8);
+        const params = {
+            ...DEFAULTS,
+            hitCenters: [],
+            rentCenters: [],
+            cashBuckets: buf.readUInt16LE(10),
+            cashStep: buf.readDoubleLE(16),
+            income: buf.readDoubleLE(24),
+            hazard: buf.readDoubleLE(32)
+        };
+        for (let k = 0; k < H; k++) params.hitCenters.push(buf.readDoubleLE(HEADER + k * 8));
+        for (let k = 0; k < R; k++) params.rentCenters.push(buf.readDoubleLE(HEADER + (H + k) * 8));
+
+        const offset = buf.byteOffset + HEADER + (H + R) * 8;
+        const P = 1 + H * R;
+        const count = P * P * params.cashBuckets * params.cashBuckets;
+        const values = offset % 2 === 0
+            ? new Uint16Array(buf.buffer, offset, count)
+            : new Uint16Array(buf.buffer.slice(offset, offset + count * 2));
+        return new EndgameTablebase(params, values);
+    }
+
+    /** Load the default table, solving and saving it on first use */
+    static open(file = DEFAULT_FILE) {
+        if (fs.existsSync(file)) return EndgameTablebase.load(file);
+        const tb = EndgameTablebase.build();
+        tb.save(file);
+        return tb;
+    }
+}
+
+// =============================================================================
+// KERNELS
+// =============================================================================
+
+function clampIndex(x, buckets) {
+    return Math.max(0, Math.min(buckets - 1, x));
+}
+
+/** Write bilinear indices/weights (scaled by p) for grid point (u, v) */
+function bilinear(u, v, B, idx, w, at, p) {
+    u = clampIndex(u, B);
+    v = clampIndex(v, B);
+    const i0 = Math.floor(u), j0 = Math.floor(v);
+    const i1 = Math.min(i0 + 1, B - 1), j1 = Math.min(j0 + 1, B - 1);
+    const fu = u - i0, fv = v - j0;
+
+    idx[at] = i0 * B + j0;     w[at] = p * (1 - fu) * (1 - fv);
+    idx[at + 1] = i0 * B + j1; w[at + 1] = p * (1 - fu) * fv;
+    idx[at + 2] = i1 * B + j0; w[at + 2] = p * fu * (1 - fv);
+    idx[at + 3] = i1 * B + j1; w[at + 3] = p * fu * fv;
+}
+
+/** One in-place sweep over `table` reading `next`; returns the max change */
+function sweep(table, next, plan, hazard) {
+    const { idx, w } = plan;
+    let delta = 0;
+    for (let c = 0; c < table.length; c++) {
+        const at = c * 8;
+        let win = 0;
+        for (let k = at; k < at + 8; k++) {
+            win += w[k] * (1 - next[idx[k]]);
+        }
+        const value = (1 - hazard) * win + hazard * 0.5;
+        const change = Math.abs(value - table[c]);
+        if (change > delta) delta = change;
+        table[c] = value;
+    }
+    return delta;
+}
+
+function quantize(table) {
+    const out = new Uint16Array(table.length);
+    for (let c = 0; c < table.length; c++) {
+        out[c] = Math.round(Math.max(0, Math.min(1, table[c])) * 65535);
+    }
+    return out;
+}
+
+module.exports = { EndgameTablebase, DEFAULT_FILE };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const args = process.argv.slice(2);
+    const flag = (name) => {
+        const i = args.indexOf(name);
+        return i >= 0 ? (args[i + 1] && !args[i + 1].startsWith('--') ? args[i + 1] : true) : null;
+    };
+
+    if (flag('--build')) {
+        const start = Date.now();
+        const tb = EndgameTablebase.build();
+        const file = tb.save();
+        const s = tb.stats;
+        console.log(`Solved ${s.pairs} profile pairs in ${((Date.now() - start) / 1000).toFixed(1)}s ` +
+            `(avg ${(s.sweeps / s.pairs).toFixed(0)} sweeps, max ${s.maxSweeps}, ${s.unconverged} unconverged)`);
+        console.log(`Wrote ${path.basename(file)} (${(fs.statSync(file).size / 1024).toFixed(0)} KB)`);
+    }
+
+    const probeSeed = flag('--probe');
+    const calibrate = flag('--calibrate');
+    if (probeSeed || calibrate) {
+        const { GameEngine } = require('./game-engine.js');
+        const { createRunner } = require('./harness.js');
+        const { withSeed } = require('./seeded-random.js');
+
+        const runner = createRunner({ maxTurns: 1000 });
+
+        const tb = EndgameTablebase.open();
+        const probs = runner.markovEngine.getAllProbabilities('stay');
+        const lineup = ['strategic', 'optimal', 'relative', 'growth'];
+
+        // Play a seeded game; probe the first time two players remain
+        const playEndgame = (seed) => withSeed(seed, () => {
+            const engine = new GameEngine({ maxTurns: 1000 });
+            engine.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+            let probe = null;
+            while (!engine.state.isGameOver() && engine.state.turn < engine.options.maxTurns) {
+                engine.executeTurn();
+                if (!probe && engine.state.getActivePlayers().length === 2) {
+                    const [a, b] = engine.state.getActivePlayers();
+                    probe = { turn: engine.state.turn, a: a.id, b: b.id, p: tb.probe(engine, a.id, probs) };
+                }
+            }
+            const winner = engine.state.getWinner();
+            return { probe, winner: winner ? winner.id : null };
+        });
+
+        if (probeSeed) {
+            const { probe, winner } = playEndgame(parseInt(probeSeed, 10));
+            if (!probe) {
+                console.log('Game never reached a two-player endgame');
+            } else {
+                console.log(`Turn ${probe.turn}: P(${lineup[probe.a]} beats ${lineup[probe.b]}) = ` +
+                    `${probe.p.toFixed(3)}; actual winner: ${winner === null ? 'none (max turns)' : lineup[winner]}`);
+            }
+        }
+
+        if (calibrate) {
+            const games = parseInt(calibrate, 10) || 100;
+            const bins = Array.from({ length: 5 }, () => ({ n: 0, p: 0, wins: 0 }));
+            let brier = 0;
+            let scored = 0;
+            for (let seed = 1; seed <= games; seed++) {
+                const { probe, winner } = playEndgame(seed);
+                if (!probe) continue;
+                const outcome = winner === probe.a ? 1 : winner === probe.b ? 0 : 0.5;
+                brier += (probe.p - outcome) ** 2;
+                scored++;
+                const bin = bins[Math.min(4, Math.floor(probe.p * 5))];
+                bin.n++;
+                bin.p += probe.p;
+                bin.wins += outcome;
+            }
+            console.log(`\n${scored} two-player endgames from ${games} games, ` +
+                `Brier score ${(brier / Math.max(1, scored)).toFixed(3)} (0.25 = coin flip)\n`);
+            console.log('  predicted    games   mean p   actual');
+            bins.forEach((bin, k) => {
+                if (!bin.n) return;
+                console.log(`  ${(k / 5).toFixed(1)}-${((k + 1) / 5).toFixed(1)}` +
+                    String(bin.n).padStart(10) +
+                    (bin.p / bin.n).toFixed(3).padStart(9) +
+                    (bin.wins / bin.n).toFixed(3).padStart(9));
+            });
+        }
+    }
+
+    if (!args.length) {
+        console.log('Usage: node endgame-tablebase.js [--build] [--probe <seed>] [--calibrate <games>]');
+    }
+}
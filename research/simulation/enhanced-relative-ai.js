@@ -932,6 +932,29 @@ class EnhancedRelativeSmartBlock extends EnhancedRelativeAI {
     }
 }
 
+/**
+ * Optimal configuration with an MDP jail policy (see jail-policy.js):
+ * pay or roll is looked up from a table solved on the current board,
+ * by cash on hand and jail turn, instead of "leave while anything is unowned".
+ */
+class EnhancedRelativeMDPJail extends EnhancedRelativeOptimal {
+    constructor(player, engine, markovEngine = null, valuator = null) {
+        super(player, engine, markovEngine, valuator);
+        this.name = 'EnhancedRelativeMDPJail';
+        this.jailPolicy = null;
+    }
+
+    decideJail(state) {
+        if (!this.engine || state !== this.engine.state) return super.decideJail(state);
+        if (!this.jailPolicy) {
+            const { JailPolicy } = require('./jail-policy.js');
+            this.jailPolicy = new JailPolicy(this.engine, this.player.id, this.probs,
+                { dice: this.markovEngine ? this.markovEngine.dice : 'classic' });
+        }
+        return this.jailPolicy.shouldLeave(this.player.money, this.player.jailTurns);
+    }
+}
+
 // =============================================================================
 // EXPORTS
 // =============================================================================
@@ -943,5 +966,6 @@ module.exports = {
     EnhancedRelative10,
     EnhancedRelative15,
     EnhancedRelativeNoDebt,
-    EnhancedRelativeSmartBlock
+    EnhancedRelativeSmartBlock,
+    EnhancedRelativeMDPJail
 };
@@ -0,0 +1,235 @@
+/**
+ * Incremental EPT Tracker
+ *
+ * Maintains every player's property EPT (rent expected from opponents per
+ * turn) as running sums that the engine updates on each property mutation,
+ * so AIs can read per-player, average and relative EPT without iterating
+ * all holdings on every query.
+ *
+ * A change to one square only affects its rent unit: the color group
+ * (monopoly doubling), all railroads (count-based rent) or both utilities.
+ * update(position) re-prices that unit - at most 4 squares - and moves the
+ * difference between the owners' sums.
+ *
+ * Sums are kept in fixed point (integer multiples of 1/SCALE) so that
+ * repeated add/subtract over a long game never drifts.
+ *
+ * Two flavours are tracked per player:
+ *   income - streets, railroads and utilities (RelativeGrowthAI semantics)
+ *   street - streets only (position-estimator.js semantics)
+ *
+ * Usage:
+ *   const tracker = engine.getEPTTracker(probs);
+ *   tracker.propertyEPT(playerId);   // same as calculatePropertyEPT
+ *   tracker.relativeEPTs();          // same as calculateRelativeEPTs
+ */
+
+'use strict';
+
+const { BOARD, COLOR_GROUPS, RAILROAD_RENT, UTILITY_MULTIPLIER, SQUARE_TYPES } = require('./game-engine.js');
+
+const DICE_EPT = 38;  // ~$35 from Go + ~$3 from cards per turn
+const SCALE = 1e9;
+const BOARD_SIZE = 40;
+const DEFAULT_PROB = 0.025;
+
+const RAILROADS = [];
+const UTILITIES = [];
+for (let sq = 0; sq < BOARD_SIZE; sq++) {
+    if (BOARD[sq].type === SQUARE_TYPES.RAILROAD) RAILROADS.push(sq);
+    if (BOARD[sq].type === SQUARE_TYPES.UTILITY) UTILITIES.push(sq);
+}
+
+/** Squares whose rent depends on the ownership of `sq` (including itself) */
+const RENT_UNIT = BOARD.map((square, sq) => {
+    if (square.type === SQUARE_TYPES.RAILROAD) return RAILROADS;
+    if (square.type === SQUARE_TYPES.UTILITY) return UTILITIES;
+    if (square.group) return COLOR_GROUPS[square.group].squares;
+    return square.price ? [sq] : [];
+});
+
+class EPTTracker {
+    /**
+     * @param {GameState} state - live engine state (read, never modified)
+     * @param {number[]} probs - landing probability per square (null = 2.5% each)
+     */
+    constructor(state, probs) {
+        this.state = state;
+        this.probs = probs || null;
+
+        // Per-square contribution currently booked to owner[sq]
+        this.owner = new Int8Array(BOARD_SIZE).fill(-1);
+        this.income = new Float64Array(BOARD_SIZE);
+        this.street = new Float64Array(BOARD_SIZE);
+
+        // Per-player running sums (fixed point, per opponent)
+        this.incomeSum = new Float64Array(state.players.length);
+        this.streetSum = new Float64Array(state.players.length);
+
+        this.knownProbs = new WeakSet();
+        if (probs) this.knownProbs.add(probs);
+
+        this.rebuild();
+    }
+
+    /**
+     * Recompute everything from the state
+     */
+    rebuild() {
+        this.owner.fill(-1);
+        this.income.fill(0);
+        this.street.fill(0);
+        this.incomeSum.fill(0);
+        this.streetSum.fill(0);
+
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            if (BOARD[sq].price) this.book(sq);
+        }
+        return this;
+    }
+
+    /**
+     * Re-price the rent unit containing `position` after its owner, houses
+     * or mortgage changed.
+     */
+    update(position) {
+        const unit = RENT_UNIT[position];
+        for (let i = 0; i < unit.length; i++) {
+            this.book(unit[i]);
+        }
+    }
+
+    /**
+     * Replace the booked contribution of one square with its current value
+     */
+    book(sq) {
+        const previous = this.owner[sq];
+        if (previous >= 0) {
+            this.incomeSum[previous] -= this.income[sq];
+            this.streetSum[previous] -= this.street[sq];
+        }
+
+        const propState = this.state.propertyStates[sq];
+        const owner = propState && propState.owner !== null && propState.owner !== undefined
+            ? propState.owner : -1;
+
+        let income = 0;
+        let street = 0;
+        if (owner >= 0) {
+            const square = BOARD[sq];
+            const prob = this.probs ? this.probs[sq] : DEFAULT_PROB;
+            let rent = 0;
+
+            if (square.type === SQUARE_TYPES.RAILROAD) {
+                rent = RAILROAD_RENT[this.countOwned(RAILROADS, owner)];
+            } else if (square.type === SQUARE_TYPES.UTILITY) {
+                rent = UTILITY_MULTIPLIER[this.countOwned(UTILITIES, owner)] * 7;  // Average dice roll
+            } else if (square.rent) {
+                const houses = propState.houses || 0;
+                const monopoly = COLOR_GROUPS[square.group].squares.every(s =>
+                    this.state.propertyStates[s]?.owner === owner
+                );
+                rent = monopoly && houses === 0 ? square.rent[0] * 2 : square.rent[houses];
+
+                const streetRent = monopoly ? rent : square.rent[0];
+                street = Math.round(prob * streetRent * SCALE);
+            }
+
+            if (rent > 0) income = Math.round(prob * rent * SCALE);
+
+            this.incomeSum[owner] += income;
+            this.streetSum[owner] += street;
+        }
+
+        this.owner[sq] = owner;
+        this.income[sq] = income;
+        this.street[sq] = street;
+    }
+
+    countOwned(squares, owner) {
+        let count = 0;
+        for (const sq of squares) {
+            if (this.state.propertyStates[sq]?.owner === owner) count++;
+        }
+        return count;
+    }
+
+    /**
+     * True if `probs` holds the same values this tracker was built with.
+     * Each AI keeps its own copy of the Markov probabilities, so arrays are
+     * compared once by value and then remembered.
+     */
+    matches(probs) {
+        if (!probs || !this.probs) return probs === this.probs;
+        if (this.knownProbs.has(probs)) return true;
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            if (probs[sq] !== this.probs[sq]) return false;
+        }
+        this.knownProbs.add(probs);
+        return true;
+    }
+
+    // =========================================================================
+    // READERS
+    // =========================================================================
+
+    /** Number of active opponents each player collects rent from */
+    opponents() {
+        let active = 0;
+        for (const p of this.state.players) {
+            if (!p.bankrupt) active++;
+        }
+        return Math.max(0, active - 1);
+    }
+
+    /** Property EPT including railroads and utilities */
+    propertyEPT(playerId) {
+        return this.incomeSum[playerId] / SCALE * this.opponents();
+    }
+
+    /** Street-only EPT (position-estimator.js calculatePlayerEPT) */
+    streetEPT(playerId) {
+        return this.streetSum[playerId] / SCALE * this.opponents();
+    }
+
+    /** Average property EPT over active players */
+    averageEPT() {
+        const opponents = this.opponents();
+        if (opponents === 0) return 0;
+
+        let total = 0;
+        for (const p of this.state.players) {
+            if (!p.bankrupt) total += this.incomeSum[p.id];
+        }
+        return total / SCALE * opponents / (opponents + 1);
+    }
+
+    /** Property EPT minus the table average */
+    relativeEPT(playerId) {
+        return this.propertyEPT(playerId) - this.averageEPT();
+    }
+
+    /**
+     * Map of playerId -> { propertyEPT, relativeEPT, netGrowth } for active
+     * players, in the shape RelativeGrowthAI.calculateRelativeEPTs returns.
+     */
+    relativeEPTs() {
+        const eptMap = new Map();
+        const opponents = this.opponents();
+        if (opponents === 0) return eptMap;
+
+        const avgEPT = this.averageEPT();
+        for (const p of this.state.players) {
+            if (p.bankrupt) continue;
+            const propertyEPT = this.incomeSum[p.id] / SCALE * opponents;
+            eptMap.set(p.id, {
+                propertyEPT,
+                relativeEPT: propertyEPT - avgEPT,
+                netGrowth: DICE_EPT + propertyEPT - avgEPT
+            });
+        }
+        return eptMap;
+    }
+}
+
+module.exports = { EPTTracker, RENT_UNIT, DICE_EPT };
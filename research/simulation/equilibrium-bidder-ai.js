@@ -0,0 +1,46 @@
+/**
+ * Equilibrium Bidder AI
+ *
+ * RelativeGrowthAI with auction limits read from the solved equilibrium
+ * table (auction-equilibrium.js) instead of face value with fixed
+ * completion/blocking premiums. The table is keyed by square and by how
+ * many of the group each live player already holds; the limit is capped
+ * by cash above reserve as usual.
+ *
+ * Patterns the table doesn't cover (more than DEFAULTS.players players)
+ * fall back to the usual limit. The limit is still a plain
+ * { limit, step } rule, so auctions resolve in closed form.
+ */
+
+'use strict';
+
+const { RelativeGrowthAI } = require('./relative-growth-ai.js');
+const { AuctionEquilibrium, ownershipCounts } = require('./auction-equilibrium.js');
+
+// One table per process, loaded (or solved) on first use
+let sharedTable = null;
+
+function equilibriumTable(markovEngine) {
+    if (!sharedTable) {
+        sharedTable = AuctionEquilibrium.open(undefined,
+            markovEngine ? { probabilities: markovEngine.getAllProbabilities() } : {});
+    }
+    return sharedTable;
+}
+
+class EquilibriumBidderAI extends RelativeGrowthAI {
+    constructor(player, engine, markovEngine, valuator) {
+        super(player, engine, markovEngine, valuator);
+        this.name = 'EquilibriumBidderAI';
+        this.table = equilibriumTable(markovEngine);
+    }
+
+    getBidLimit(position, state) {
+        const { mine, others } = ownershipCounts(position, state, this.player.id);
+        const limit = this.table.bid(position, mine, others);
+        if (limit === null) return super.getBidLimit(position, state);
+        return Math.min(limit, this.player.money - this.getMinReserve(state));
+    }
+}
+
+module.exports = { EquilibriumBidderAI };
@@ -710,6 +710,7 @@ class FormationTrackingEngine extends GameEngine {
             player.money -= square.price;
             player.properties.add(position);
             this.state.propertyStates[position].owner = player.id;
+            this.propertyChanged(position);
             this.log(`${player.name} bought ${square.name} for $${square.price}`);
             this.state.stats.propertiesBought[player.id]++;
 
@@ -779,6 +780,7 @@ class FormationTrackingEngine extends GameEngine {
             highBidder.money -= highBid;
             highBidder.properties.add(position);
             this.state.propertyStates[position].owner = highBidder.id;
+            this.propertyChanged(position);
             this.log(`${highBidder.name} won auction for ${square.name} at $${highBid}`);
 
             // Track acquisition
@@ -0,0 +1,456 @@
+/**
+ * Island-Model Genetic Algorithm
+ *
+ * Runs several genetic-algorithm.js populations ("islands") as separate
+ * processes, one core each, and migrates elites between them. Islands
+ * evolve independently, which keeps diversity that one large population
+ * loses to premature convergence. Every migrationInterval generations each
+ * island sends its best few genomes to the next island in a ring. They
+ * replace the receiver's worst individuals, fitness included, so they
+ * compete in selection at once.
+ *
+ * Migration goes through the coordinator over newline-delimited JSON on a
+ * socket: a Unix socket for islands forked on this machine, plus a TCP port
+ * (--port) that islands on other machines can join. Migration is
+ * asynchronous - a slow island never holds up a fast one; migrants wait in
+ * the socket until the receiver finishes its generation.
+ *
+ * Checkpoints use the ga-state.json format:
+ *   <outputDir>/island-<k>/ga-state.json   each island (GeneticAlgorithm.saveState)
+ *   <outputDir>/ga-state.json              all islands merged, loadable by
+ *                                          genetic-algorithm.js
+ * --resume restarts every island from its own checkpoint. --from seeds the
+ * islands by splitting an existing ga-state.json population.
+ *
+ * Usage:
+ *   node ga-islands.js                                  # one island per core
+ *   node ga-islands.js --islands 8 --population 20 --generations 150
+ *   node ga-islands.js --resume
+ *   node ga-islands.js --from ga-results/ga-state.json
+ *   node ga-islands.js --islands 4 --remote 4 --port 7070      # coordinator
+ *   node ga-islands.js --join host:7070 --island 4             # on another machine
+ */
+
+'use strict';
+
+const fs = require('fs');
+const net = require('net');
+const os = require('os');
+const path = require('path');
+const { fork } = require('child_process');
+
+const { GeneticAlgorithm, PARAMETERS } = require('./genetic-algorithm.js');
+const { quietly } = require('./harness.js');
+
+const DEFAULTS = {
+    islands: Math.max(2, os.cpus().length),   // forked on this machine
+    remote: 0,                                // expected to --join over TCP
+    populationSize: 20,                       // per island
+    generations: 100,
+    gamesPerEvaluation: 50,
+    migrationInterval: 5,
+    migrants: 2,
+    saveInterval: 5,
+    port: 0,                                  // TCP port for remote islands (0 = none)
+    outputDir: path.join(__dirname, 'ga-results', 'islands')
+};
+
+/**
+ * Newline-delimited JSON over a socket.
+ * @returns {function(Object): void} send
+ */
+function channel(socket, onMessage) {
+    let buffer = '';
+    socket.setEncoding('utf8');
+    socket.on('data', (chunk) => {
+        buffer += chunk;
+        let newline;
+        while ((newline = buffer.indexOf('\n')) >= 0) {
+            const line = buffer.slice(0, newline);
+            buffer = buffer.slice(newline + 1);
+            if (line) onMessage(JSON.parse(line));
+        }
+    });
+    return (msg) => socket.write(JSON.stringify(msg) + '\n');
+}
+
+// =============================================================================
+// ISLAND
+// =============================================================================
+
+/**
+ * One island: a GeneticAlgorithm with its own checkpoint directory and
+ * the two migration hooks.
+ */
+class IslandGA extends GeneticAlgorithm {
+    constructor(island, options = {}) {
+        super({ ...options, outputDir: path.join(options.outputDir || DEFAULTS.outputDir, `island-${island}`) });
+        this.island = island;
+    }
+
+    /** Best `count` individuals of the evaluated population */
+    emigrants(count) {
+        return [...this.population]
+            .sort((a, b) => b.fitness - a.fitness)
+            .slice(0, count)
+            .map(ind => ({ genome: { ...ind.genome }, fitness: ind.fitness }));
+    }
+
+    /** Replace the worst individuals with migrants, keeping their fitness */
+    immigrate(migrants) {
+        this.population.sort((a, b) => b.fitness - a.fitness);
+        const count = Math.min(migrants.length, this.population.length - 1);
+        for (let i = 0; i < count; i++) {
+            this.population[this.population.length - 1 - i] = {
+                genome: { ...migrants[i].genome },
+                fitness: migrants[i].fitness,
+                wins: 0,
+                games: 0
+            };
+        }
+        this.population.sort((a, b) => b.fitness - a.fitness);
+        return count;
+    }
+}
+
+/**
+ * Island process: connect, take the run configuration from the
+ * coordinator, then evolve, yielding between generations so migrants can
+ * arrive.
+ */
+function islandMain(island, address) {
+    const socket = address.port ? net.connect(address.port, address.host) : net.connect(address.path);
+    const inbox = [];
+    let config = null;
+    let stopped = false;
+    let wake = null;
+
+    const send = channel(socket, (msg) => {
+        if (msg.type === 'config') config = msg;
+        else if (msg.type === 'migrants') inbox.push(...msg.migrants);
+        else if (msg.type === 'stop') stopped = true;
+        if (wake) wake();
+    });
+    const next = () => new Promise(resolve => {
+        wake = resolve;
+        setImmediate(resolve);
+    });
+
+    socket.on('connect', async () => {
+        send({ type: 'hello', island });
+        while (!config) await new Promise(resolve => { wake = resolve; });
+
+        const options = config.options;
+        const ga = quietly(() => new IslandGA(island, options));
+        ga.startTime = Date.now();
+
+        if (!(options.resume && quietly(() => ga.loadState()))) {
+            if (config.population && config.population.length > 0) {
+                ga.population = config.population;
+            } else {
+                quietly(() => ga.initializePopulation());
+            }
+        } else {
+            ga.generation++;
+        }
+
+        while (ga.generation < options.generations && !stopped) {
+            const stats = quietly(() => ga.runGeneration());
+            send({
+                type: 'generation',
+                island,
+                generation: ga.generation,
+                bestFitness: stats.bestFitness,
+                avgFitness: stats.avgFitness,
+                bestGenome: stats.bestGenome,
+                time: stats.time,
+                population: ga.population
+            });
+
+            if ((ga.generation + 1) % options.migrationInterval === 0) {
+                send({ type: 'migrants', island, generation: ga.generation, migrants: ga.emigrants(options.migrants) });
+            }
+
+            await next();
+            if (inbox.length > 0) ga.immigrate(inbox.splice(0));
+
+            if (ga.generation % options.saveInterval === 0) quietly(() => ga.saveState());
+            if (ga.generation < options.generations - 1) ga.evolve();
+            ga.generation++;
+        }
+
+        quietly(() => ga.saveState());
+        send({ type: 'done', island, generation: ga.generation });
+        socket.end();
+    });
+
+    socket.on('error', (err) => {
+        console.error(`Island ${island}: ${err.message}`);
+        process.exit(1);
+    });
+}
+
+// =============================================================================
+// COORDINATOR
+// =============================================================================
+
+class IslandCoordinator {
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS, ...options };
+        this.total = this.options.islands + this.options.remote;
+        this.connections = new Map();     // island -> send
+        this.pending = new Map();         // island -> migrants waiting for it to connect
+        this.latest = new Map();          // island -> last 'generation' message
+        this.byGeneration = new Map();    // generation -> messages
+        this.history = [];
+        this.migrations = 0;
+        this.done = 0;
+        this.bestFitness = 0;
+        this.bestGenome = null;
+        this.startTime = null;
+        this.seedPopulations = null;
+    }
+
+    get socketPath() {
+        return process.platform === 'win32'
+            ? `\\\\?\\pipe\\monopoly-ga-islands-${process.pid}`
+            : path.join(os.tmpdir(), `monopoly-ga-islands-${process.pid}.sock`);
+    }
+
+    /** Split a saved ga-state.json population across the islands */
+    seedFrom(file) {
+        const saved = JSON.parse(fs.readFileSync(file, 'utf8'));
+        const sorted = [...saved.population].sort((a, b) => b.fitness - a.fitness);
+        this.seedPopulations = Array.from({ length: this.total }, () => []);
+        sorted.forEach((ind, i) => this.seedPopulations[i % this.total].push(ind));
+        for (const pop of this.seedPopulations) {
+            while (pop.length < this.options.populationSize) {
+                pop.push({ genome: { ...sorted[pop.length % sorted.length].genome }, fitness: 0, wins: 0, games: 0 });
+            }
+            pop.length = this.options.populationSize;
+        }
+        console.log(`Seeded ${this.total} islands from ${file} (${saved.population.length} individuals)`);
+    }
+
+    islandOptions() {
+        const { islands, remote, port, from, ...options } = this.options;
+        return options;
+    }
+
+    onMessage(send, msg) {
+        switch (msg.type) {
+            case 'hello': {
+                this.connections.set(msg.island, send);
+                send({
+                    type: 'config',
+                    options: this.islandOptions(),
+                    population: this.seedPopulations ? this.seedPopulations[msg.island] : null
+                });
+                const waiting = this.pending.get(msg.island);
+                if (waiting) {
+                    send({ type: 'migrants', migrants: waiting });
+                    this.pending.delete(msg.island);
+                }
+                break;
+            }
+            case 'generation':
+                this.recordGeneration(msg);
+                break;
+            case 'migrants': {
+                const to = (msg.island + 1) % this.total;
+                this.migrations += msg.migrants.length;
+                const target = this.connections.get(to);
+                if (target) {
+                    target({ type: 'migrants', from: msg.island, migrants: msg.migrants });
+                } else {
+                    this.pending.set(to, [...(this.pending.get(to) || []), ...msg.migrants]);
+                }
+                break;
+            }
+            case 'done':
+                this.done++;
+                break;
+        }
+    }
+
+    recordGeneration(msg) {
+        this.latest.set(msg.island, msg);
+        if (msg.bestFitness > this.bestFitness) {
+            this.bestFitness = msg.bestFitness;
+            this.bestGenome = msg.bestGenome;
+        }
+
+        const reports = this.byGeneration.get(msg.generation) || [];
+        reports.push(msg);
+        this.byGeneration.set(msg.generation, reports);
+        if (reports.length < this.total) return;
+
+        // Every island has finished this generation
+        this.byGeneration.delete(msg.generation);
+        const best = reports.reduce((a, b) => (b.bestFitness > a.bestFitness ? b : a));
+        const entry = {
+            generation: msg.generation,
+            bestFitness: best.bestFitness,
+            avgFitness: reports.reduce((s, r) => s + r.avgFitness, 0) / reports.length,
+            bestGenome: best.bestGenome,
+            time: Math.max(...reports.map(r => r.time))
+        };
+        this.history.push(entry);
+        console.log(`  Gen ${String(entry.generation).padStart(3)}: best ${(entry.bestFitness * 100).toFixed(1)}% ` +
+            `(island ${best.island}), avg ${(entry.avgFitness * 100).toFixed(1)}%, ` +
+            `${this.migrations} migrants so far, ${entry.time.toFixed(1)}s`);
+
+        if (msg.generation % this.options.saveInterval === 0) this.saveState();
+    }
+
+    /** Merged checkpoint in ga-state.json format */
+    saveState() {
+        const reports = [...this.latest.values()];
+        if (reports.length === 0) return;
+        fs.mkdirSync(this.options.outputDir, { recursive: true });
+
+        const state = {
+            generation: Math.min(...reports.map(r => r.generation)),
+            bestFitness: this.bestFitness,
+            bestGenome: this.bestGenome,
+            population: reports.flatMap(r => r.population),
+            history: this.history,
+            options: { ...this.islandOptions(), populationSize: this.options.populationSize * this.total },
+            islands: this.total,
+            timestamp: new Date().toISOString()
+        };
+        fs.writeFileSync(path.join(this.options.outputDir, 'ga-state.json'), JSON.stringify(state, null, 2));
+        fs.writeFileSync(path.join(this.options.outputDir, 'ga-summary.txt'),
+            GeneticAlgorithm.prototype.generateSummary.call({
+                startTime: this.startTime,
+                generation: state.generation + 1,
+                bestFitness: this.bestFitness,
+                bestGenome: this.bestGenome,
+                history: this.history
+            }));
+    }
+
+    run() {
+        const opts = this.options;
+        this.startTime = Date.now();
+        if (opts.from) this.seedFrom(opts.from);
+
+        return new Promise((resolve, reject) => {
+            const servers = [];
+            const children = [];
+            const onConnection = (socket) => {
+                const send = channel(socket, (msg) => {
+                    this.onMessage(send, msg);
+                    if (this.done === this.total) finish();
+                });
+                socket.on('error', () => {});
+            };
+
+            const finish = () => {
+                this.saveState();
+                for (const server of servers) server.close();
+                resolve({
+                    bestFitness: this.bestFitness,
+                    bestGenome: this.bestGenome,
+                    history: this.history,
+                    migrations: this.migrations
+                });
+            };
+
+            const local = net.createServer(onConnection);
+            servers.push(local);
+            const socketPath = this.socketPath;
+            if (fs.existsSync(socketPath)) fs.unlinkSync(socketPath);
+            local.listen(socketPath, () => {
+                for (let k = 0; k < opts.islands; k++) {
+                    const child = fork(__filename, ['--island', String(k), '--socket', socketPath]);
+                    child.on('exit', (code) => {
+                        if (code !== 0) reject(new Error(`Island ${k} exited with code ${code}`));
+                    });
+                    children.push(child);
+                }
+            });
+            local.on('error', reject);
+
+            if (opts.port) {
+                const remote = net.createServer(onConnection);
+                servers.push(remote);
+                remote.listen(opts.port, () => {
+                    console.log(`Waiting for ${opts.remote} remote islands on port ${opts.port}`);
+                });
+                remote.on('error', reject);
+            }
+        });
+    }
+}
+
+module.exports = { IslandGA, IslandCoordinator, DEFAULTS };
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+function parseArgs(argv) {
+    const args = {};
+    for (let i = 0; i < argv.length; i++) {
+        switch (argv[i]) {
+            case '--islands': args.islands = parseInt(argv[++i], 10); break;
+            case '--remote': args.remote = parseInt(argv[++i], 10); break;
+            case '--population': args.populationSize = parseInt(argv[++i], 10); break;
+            case '--generations': args.generations = parseInt(argv[++i], 10); break;
+            case '--games': args.gamesPerEvaluation = parseInt(argv[++i], 10); break;
+            case '--migration-interval': args.migrationInterval = parseInt(argv[++i], 10); break;
+            case '--migrants': args.migrants = parseInt(argv[++i], 10); break;
+            case '--save-interval': args.saveInterval = parseInt(argv[++i], 10); break;
+            case '--port': args.port = parseInt(argv[++i], 10); break;
+            case '--output': args.outputDir = path.resolve(argv[++i]); break;
+            case '--from': args.from = argv[++i]; break;
+            case '--resume': case '-r': args.resume = true; break;
+            // Island side
+            case '--island': args.island = parseInt(argv[++i], 10); break;
+            case '--socket': args.socket = argv[++i]; break;
+            case '--join': args.join = argv[++i]; break;
+        }
+    }
+    return args;
+}
+
+async function main() {
+    const args = parseArgs(process.argv.slice(2));
+
+    if (args.island !== undefined) {
+        if (args.join) {
+            const [host, port] = args.join.split(':');
+            islandMain(args.island, { host, port: parseInt(port, 10) });
+        } else {
+            islandMain(args.island, { path: args.socket });
+        }
+        return;
+    }
+
+    const coordinator = new IslandCoordinator(args);
+    const opts = coordinator.options;
+    console.log('Island-Model Genetic Algorithm');
+    console.log('='.repeat(70));
+    console.log(`Islands: ${opts.islands} local + ${opts.remote} remote, ${opts.populationSize} each; ` +
+        `${opts.generations} generations, ${opts.gamesPerEvaluation} games per evaluation`);
+    console.log(`Migration: best ${opts.migrants} to the next island every ${opts.migrationInterval} generations`);
+    console.log(`Checkpoints: ${opts.outputDir}${opts.resume ? ' (resuming)' : ''}\n`);
+
+    const result = await coordinator.run();
+    const minutes = (Date.now() - coordinator.startTime) / 60000;
+
+    console.log(`\n${'='.repeat(70)}`);
+    console.log(`Done in ${minutes.toFixed(1)} minutes, ${result.migrations} migrants exchanged`);
+    console.log(`Best win rate: ${(result.bestFitness * 100).toFixed(1)}%`);
+    if (result.bestGenome) {
+        for (const param of PARAMETERS) console.log(`  ${param.name}: ${result.bestGenome[param.name]}`);
+    }
+}
+
+if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
@@ -337,6 +337,17 @@ class GameState {
     }
 }
 
+let steadyState = null;
+
+/** Classic steady-state landing probabilities ('stay' jail), loaded once */
+function steadyStateProbabilities() {
+    if (!steadyState) {
+        const { getCachedEngines } = require('./cached-engines.js');
+        steadyState = getCachedEngines({ log: () => {} }).markovEngine.getAllProbabilities();
+    }
+    return steadyState;
+}
+
 // =============================================================================
 // GAME ENGINE CLASS
 // =============================================================================
@@ -351,6 +362,10 @@ class GameEngine {
 
         this.state = null;
         this.eventLog = [];
+        this.stateView = null;
+        this.eptTracker = null;
+        this.rentFlow = null;
+        this.boardVersion = 0;
     }
 
     /**
@@ -359,6 +374,10 @@ class GameEngine {
     newGame(playerCount = 4, aiFactories = []) {
         this.state = new GameState(playerCount);
         this.eventLog = [];
+        this.stateView = null;
+        this.eptTracker = null;
+        this.rentFlow = null;
+        this.boardVersion = 0;
 
         // Assign AIs to players
         for (let i = 0; i < playerCount; i++) {
@@ -370,6 +389,78 @@ class GameEngine {
         this.log('Game started with ' + playerCount + ' players');
     }
 
+    /**
+     * Plain-data copy of the game state. Survives structured cloning
+     * (postMessage) and JSON, so it can be shipped to worker threads.
+     * AIs are not included; restore() builds fresh ones.
+     */
+    snapshot() {
+        const s = this.state;
+        return {
+            players: s.players.map(p => ({
+                money: p.money,
+                position: p.position,
+                inJail: p.inJail,
+                jailTurns: p.jailTurns,
+                properties: [...p.properties],
+                getOutOfJailCards: p.getOutOfJailCards,
+                bankrupt: p.bankrupt
+            })),
+            currentPlayerIndex: s.currentPlayerIndex,
+            turn: s.turn,
+            phase: s.phase,
+            propertyStates: JSON.parse(JSON.stringify(s.propertyStates)),
+            chanceJailCardOut: s.chanceJailCardOut,
+            ccJailCardOut: s.ccJailCardOut,
+            housesAvailable: s.housesAvailable,
+            hotelsAvailable: s.hotelsAvailable,
+            stats: JSON.parse(JSON.stringify(s.stats))
+        };
+    }
+
+    /**
+     * Continue a game from a snapshot() with newly built AIs.
+     * AI memory (recent trades, caches) starts empty.
+     */
+    restore(snapshot, aiFactories = []) {
+        const playerCount = snapshot.players.length;
+        this.state = new GameState(playerCount);
+        this.eventLog = [];
+        this.stateView = null;
+        this.eptTracker = null;
+        this.rentFlow = null;
+        this.boardVersion = 0;
+
+        const s = this.state;
+        snapshot.players.forEach((saved, i) => {
+            const player = s.players[i];
+            player.money = saved.money;
+            player.position = saved.position;
+            player.inJail = saved.inJail;
+            player.jailTurns = saved.jailTurns;
+            player.properties = new Set(saved.properties);
+            player.getOutOfJailCards = saved.getOutOfJailCards;
+            player.bankrupt = saved.bankrupt;
+        });
+        s.currentPlayerIndex = snapshot.currentPlayerIndex;
+        s.turn = snapshot.turn;
+        s.phase = snapshot.phase;
+        s.propertyStates = JSON.parse(JSON.stringify(snapshot.propertyStates));
+        s.chanceJailCardOut = snapshot.chanceJailCardOut;
+        s.ccJailCardOut = snapshot.ccJailCardOut;
+        s.housesAvailable = snapshot.housesAvailable;
+        s.hotelsAvailable = snapshot.hotelsAvailable;
+        s.stats = JSON.parse(JSON.stringify(snapshot.stats));
+
+        for (let i = 0; i < playerCount; i++) {
+            if (aiFactories[i]) {
+                s.players[i].ai = aiFactories[i](s.players[i], this);
+            }
+        }
+
+        this.log(`Game restored at turn ${s.turn}`);
+    }
+
     /**
      * Log event
      */
@@ -380,6 +471,55 @@ class GameEngine {
         this.eventLog.push({ turn: this.state.turn, message });
     }
 
+    /**
+     * Packed typed-array view of the current state (see state-view.js).
+     * The same view object is reused and refreshed in place on each call.
+     */
+    getStateView() {
+        if (!this.stateView) {
+            const { StateView } = require('./state-view.js');
+            this.stateView = new StateView(this.state.players.length);
+        }
+        return this.stateView.sync(this.state);
+    }
+
+    /**
+     * Incrementally maintained per-player EPT (see ept-tracker.js).
+     * Created on first use; rebuilt if asked for different probabilities.
+     */
+    getEPTTracker(probs) {
+        if (!this.eptTracker || !this.eptTracker.matches(probs)) {
+            const { EPTTracker } = require('./ept-tracker.js');
+            this.eptTracker = new EPTTracker(this.state, probs);
+        }
+        return this.eptTracker;
+    }
+
+    /**
+     * Incrementally maintained pairwise rent-flow matrix (see rent-flow.js).
+     * Created on first use; rebuilt only if asked for probabilities with
+     * different values. Without `probs`, the current matrix or the classic
+     * steady state.
+     */
+    getRentFlow(probs) {
+        if (!probs) probs = this.rentFlow ? this.rentFlow.probs : steadyStateProbabilities();
+        if (!this.rentFlow || !this.rentFlow.matches(probs)) {
+            const { RentFlowMatrix } = require('./rent-flow.js');
+            this.rentFlow = new RentFlowMatrix(this, probs);
+        }
+        return this.rentFlow;
+    }
+
+    /**
+     * Notify derived state that a property's owner, houses or mortgage changed.
+     * Subclasses that mutate propertyStates directly must call this too.
+     */
+    propertyChanged(position) {
+        this.boardVersion++;
+        if (this.eptTracker) this.eptTracker.update(position);
+        if (this.rentFlow) this.rentFlow.update(position);
+    }
+
     /**
      * Roll two dice
      */
@@ -405,6 +545,22 @@ class GameEngine {
         return player.position;
     }
 
+    /**
+     * "Advance to GO" card: move there and collect the salary
+     */
+    advanceToGo(player) {
+        player.position = 0;
+        player.money += GO_SALARY;
+    }
+
+    /**
+     * Pay a tax, fine or card fee to the bank (the caller handles any
+     * shortfall). Rule variants hook here to redirect the money.
+     */
+    payBank(player, amount) {
+        player.money -= amount;
+    }
+
     /**
      * Send player to jail
      */
@@ -478,7 +634,7 @@ class GameEngine {
                 if (player.money < square.amount) {
                     this.raiseCash(player, square.amount);
                 }
-                player.money -= square.amount;
+                this.payBank(player, square.amount);
                 this.log(`${player.name} paid $${square.amount} tax`);
                 // Check for bankruptcy (owe to bank)
                 if (player.money < 0) {
@@ -549,6 +705,7 @@ class GameEngine {
             player.money -= square.price;
             player.properties.add(position);
             this.state.propertyStates[position].owner = player.id;
+            this.propertyChanged(position);
             this.log(`${player.name} bought ${square.name} for $${square.price}`);
             this.state.stats.propertiesBought[player.id]++;
         } else {
@@ -559,12 +716,14 @@ class GameEngine {
 
     /**
      * Run a property auction
-     * Uses proper round-robin bidding until all but one player passes
+     * Uses proper round-robin bidding until all but one player passes.
+     * AIs that publish a reservation rule are resolved in closed form
+     * (auction-resolver.js); options.interactiveAuctions forces every
+     * bid through decideBid().
      */
     runAuction(position) {
         const square = BOARD[position];
-        let highBid = 0;
-        let highBidder = null;
+        const { resolveAuction } = require('./auction-resolver.js');
 
         // Get active players and randomize starting order to avoid seat bias
         const bidders = [...this.state.getActivePlayers()];
@@ -575,52 +734,14 @@ class GameEngine {
             [bidders[i], bidders[j]] = [bidders[j], bidders[i]];
         }
 
-        // Track who is still in the auction
-        const stillBidding = new Set(bidders.map(p => p.id));
-
-        // Round-robin until only one bidder remains or all pass
-        let rounds = 0;
-        const maxRounds = 100;  // Prevent infinite loops
-
-        while (stillBidding.size > 1 && rounds < maxRounds) {
-            rounds++;
-            let anyBidThisRound = false;
-
-            for (const player of bidders) {
-                if (!stillBidding.has(player.id)) continue;
-
-                let bid = 0;
-
-                if (player.ai && player.ai.decideBid) {
-                    bid = player.ai.decideBid(position, highBid, this.state);
-                } else {
-                    // Default: bid up to property price if can afford
-                    const maxBid = Math.min(player.money - 50, square.price);
-                    if (maxBid > highBid) {
-                        bid = highBid + 10;
-                    }
-                }
-
-                if (bid > highBid && bid <= player.money) {
-                    highBid = bid;
-                    highBidder = player;
-                    anyBidThisRound = true;
-                } else {
-                    // Player passes - remove from auction
-                    stillBidding.delete(player.id);
-                }
-            }
-
-            // If no one bid this round and we have a high bidder, they win
-            if (!anyBidThisRound && highBidder) {
-                break;
-            }
-        }
+        const { winner: highBidder, price: highBid } = resolveAuction(bidders, position, this.state,
+            { interactive: this.options.interactiveAuctions });
 
         if (highBidder) {
             highBidder.money -= highBid;
             highBidder.properties.add(position);
             this.state.propertyStates[position].owner = highBidder.id;
+            this.propertyChanged(position);
             this.log(`${highBidder.name} won auction for ${square.name} at $${highBid}`);
         }
     }
@@ -669,6 +790,7 @@ class GameEngine {
 
             // Mortgaged properties stay mortgaged but transfer to creditor
             // (In real rules, creditor must pay 10% or unmortgage)
+            this.propertyChanged(propIdx);
         }
 
         player.properties.clear();
@@ -700,6 +822,7 @@ class GameEngine {
                     this.state.housesAvailable += houses;
                 }
             }
+            this.propertyChanged(propIdx);
         }
 
         player.properties.clear();
@@ -720,8 +843,7 @@ class GameEngine {
                 this.handleLanding(player, 39, 7);
                 break;
             case 1:  // Advance to GO
-                player.position = 0;
-                player.money += GO_SALARY;
+                this.advanceToGo(player);
                 break;
             case 2:  // Advance to Illinois
                 if (player.position > 24) player.money += GO_SALARY;
@@ -772,7 +894,7 @@ class GameEngine {
                 player.getOutOfJailCards++;
                 break;
             case 12: // Pay poor tax $15
-                player.money -= 15;
+                this.payBank(player, 15);
                 break;
             case 13: // Pay each player $50
                 for (const other of this.state.getActivePlayers()) {
@@ -791,7 +913,7 @@ class GameEngine {
                     if (houses === 5) repairCost += 100;  // Hotel
                     else repairCost += houses * 25;
                 }
-                player.money -= repairCost;
+                this.payBank(player, repairCost);
                 break;
         }
 
@@ -807,8 +929,7 @@ class GameEngine {
 
         switch (card) {
             case 0:  // Advance to GO
-                player.position = 0;
-                player.money += GO_SALARY;
+                this.advanceToGo(player);
                 break;
             case 1:  // Go to Jail
                 this.sendToJail(player);
@@ -818,7 +939,7 @@ class GameEngine {
                 player.money += 200;
                 break;
             case 3:  // Doctor's fee $50
-                player.money -= 50;
+                this.payBank(player, 50);
                 break;
             case 4:  // Sale of stock $50
                 player.money += 50;
@@ -843,10 +964,10 @@ class GameEngine {
                 player.money += 100;
                 break;
             case 10: // Hospital fee $100
-                player.money -= 100;
+                this.payBank(player, 100);
                 break;
             case 11: // School fee $50
-                player.money -= 50;
+                this.payBank(player, 50);
                 break;
             case 12: // Consultancy fee $25
                 player.money += 25;
@@ -858,7 +979,7 @@ class GameEngine {
                     if (houses === 5) repairCost += 115;  // Hotel
                     else repairCost += houses * 40;
                 }
-                player.money -= repairCost;
+                this.payBank(player, repairCost);
                 break;
             case 14: // Beauty contest $10
                 player.money += 10;
@@ -945,7 +1066,7 @@ class GameEngine {
 
         // Pay $50 to leave
         if (postBail && player.money >= 50) {
-            player.money -= 50;
+            this.payBank(player, 50);
             player.inJail = false;
             player.jailTurns = 0;
             this.log(`${player.name} paid $50 to leave jail`);
@@ -970,7 +1091,7 @@ class GameEngine {
 
             if (player.jailTurns >= 3) {
                 // Must leave on 3rd turn
-                player.money -= 50;
+                this.payBank(player, 50);
                 player.inJail = false;
                 player.jailTurns = 0;
                 this.log(`${player.name} paid $50 after 3 turns in jail`);
@@ -1040,26 +1161,48 @@ class GameEngine {
     }
 
     /**
-     * Run the game until completion or max turns
+     * Run the game until completion or max turns.
+     * With options.adjudicate set, the game also stops once its outcome is
+     * settled (see adjudicator.js) and the result carries the verdict.
      */
     runGame() {
+        let adjudicator = null;
+        if (this.options.adjudicate) {
+            const { Adjudicator } = require('./adjudicator.js');
+            adjudicator = new Adjudicator(this, this.options.adjudicate);
+        }
+
+        let verdict = null;
         while (!this.state.isGameOver() && this.state.turn < this.options.maxTurns) {
             this.executeTurn();
+            if (adjudicator && !verdict) {
+                verdict = adjudicator.check();
+                if (verdict && !adjudicator.params.shadow) break;
+            }
         }
 
+        const adjudicated = verdict !== null && !adjudicator.params.shadow;
         const winner = this.state.getWinner();
-        if (winner) {
+        if (adjudicated) {
+            this.log(`Game adjudicated: ${verdict.winner === null ? 'stalemate' :
+                this.state.players[verdict.winner].name + ' wins'} (${verdict.reason})`);
+        } else if (winner) {
             this.log(`Game over! ${winner.name} wins!`);
         } else {
             this.log(`Game ended at turn limit (${this.options.maxTurns})`);
         }
 
-        return {
-            winner: winner ? winner.id : null,
+        const result = {
+            winner: adjudicated ? verdict.winner : (winner ? winner.id : null),
             turns: this.state.turn,
             stats: this.state.stats,
             finalState: this.state
         };
+        if (adjudicator) {
+            result.adjudicated = adjudicated;
+            result.adjudication = verdict;
+        }
+        return result;
     }
 
     /**
@@ -1075,12 +1218,7 @@ class GameEngine {
         if (propState.houses >= 5) return false;
         if (!player.hasMonopoly(square.group, this.state)) return false;
 
-        // Check even building rule
-        const groupSquares = COLOR_GROUPS[square.group].squares;
-        const minHouses = Math.min(...groupSquares.map(sq =>
-            this.state.propertyStates[sq].houses
-        ));
-        if (propState.houses > minHouses) return false;
+        if (!this.isEvenBuild(position, false)) return false;
 
         // Check house availability
         if (propState.houses === 4) {
@@ -1092,9 +1230,53 @@ class GameEngine {
         // Check affordability
         if (player.money < square.housePrice) return false;
 
-        // Build!
-        player.money -= square.housePrice;
+        // Short bank: the unit goes to auction instead of to whoever asks first
+        let price = square.housePrice;
+        if (this.options.houseAuctions) {
+            const { auctionLastUnit } = require('./house-bank.js');
+            const sale = auctionLastUnit(this, player, position, propState.houses === 4 ? 'hotel' : 'house');
+            if (sale) {
+                const stats = this.state.stats;
+                stats.houseAuctions = (stats.houseAuctions || 0) + 1;
+                stats.housePremiums = (stats.housePremiums || 0) + sale.price - BOARD[sale.target].housePrice;
+                if (sale.winner !== player) {
+                    this.log(`${sale.winner.name} outbid ${player.name} for the bank's last units`);
+                    this.placeUnit(sale.winner, sale.target, sale.price);
+                    return false;
+                }
+                price = sale.price;
+            }
+        }
+
+        this.placeUnit(player, position, price);
+        return true;
+    }
+
+    /**
+     * Even building rule: build on a square with the fewest houses in its
+     * group, sell from one with the most
+     */
+    isEvenBuild(position, selling) {
+        const groupSquares = COLOR_GROUPS[BOARD[position].group].squares;
+        const houses = this.state.propertyStates[position].houses;
+        for (const sq of groupSquares) {
+            const other = this.state.propertyStates[sq].houses;
+            if (selling ? other > houses : other < houses) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Pay for and place the next house or hotel on a square that already
+     * passed buildHouse()'s checks
+     */
+    placeUnit(player, position, price) {
+        const propState = this.state.propertyStates[position];
+        const square = BOARD[position];
+
+        player.money -= price;
         propState.houses++;
+        this.propertyChanged(position);
 
         if (propState.houses === 5) {
             this.state.hotelsAvailable--;
@@ -1103,9 +1285,9 @@ class GameEngine {
             this.state.housesAvailable--;
         }
 
-        this.log(`${player.name} built on ${square.name} (now ${propState.houses} houses)`);
+        this.log(`${player.name} built on ${square.name} (now ${propState.houses} houses)` +
+            (price !== square.housePrice ? ` for $${price} at auction` : ''));
         this.state.stats.housesBought[player.id]++;
-        return true;
     }
 
     /**
@@ -1125,13 +1307,7 @@ class GameEngine {
         if (propState.owner !== player.id) return 0;
         if (propState.houses <= 0) return 0;
 
-        const groupSquares = COLOR_GROUPS[square.group].squares;
-
-        // Check even selling rule - can only sell from property with most houses
-        const maxHouses = Math.max(...groupSquares.map(sq =>
-            this.state.propertyStates[sq].houses
-        ));
-        if (propState.houses < maxHouses) return 0;
+        if (!this.isEvenBuild(position, true)) return 0;
 
         const salePrice = Math.floor(square.housePrice / 2);
 
@@ -1143,6 +1319,7 @@ class GameEngine {
                 this.state.hotelsAvailable++;
                 this.state.housesAvailable -= 4;
                 propState.houses = 4;
+                this.propertyChanged(position);
                 player.money += salePrice;
                 this.log(`${player.name} sold hotel on ${square.name} (now 4 houses) for $${salePrice}`);
                 return salePrice;
@@ -1154,6 +1331,7 @@ class GameEngine {
                 // We can only physically place back what's available
                 // The rest are "lost" - player only gets paid for what they can sell
                 propState.houses = 0;
+                this.propertyChanged(position);
                 const totalSale = salePrice * 5;  // Still get paid for all 5 levels
                 player.money += totalSale;
                 this.log(`${player.name} FORCED to sell ALL development on ${square.name} (no houses available) for $${totalSale}`);
@@ -1163,6 +1341,7 @@ class GameEngine {
 
         // Selling a regular house
         propState.houses--;
+        this.propertyChanged(position);
         this.state.housesAvailable++;
         player.money += salePrice;
         this.log(`${player.name} sold house on ${square.name} (now ${propState.houses} houses) for $${salePrice}`);
@@ -1199,6 +1378,7 @@ class GameEngine {
 
         const mortgageValue = Math.floor(square.price / 2);
         propState.mortgaged = true;
+        this.propertyChanged(position);
         player.money += mortgageValue;
 
         this.log(`${player.name} mortgaged ${square.name} for $${mortgageValue}`);
@@ -1224,6 +1404,7 @@ class GameEngine {
 
         player.money -= unmortgageCost;
         propState.mortgaged = false;
+        this.propertyChanged(position);
 
         this.log(`${player.name} unmortgaged ${square.name} for $${unmortgageCost}`);
         return true;
@@ -1367,6 +1548,7 @@ class GameEngine {
             this.state.propertyStates[prop].owner = to.id;
             from.properties.delete(prop);
             to.properties.add(prop);
+            this.propertyChanged(prop);
         }
 
         // Transfer properties to -> from
@@ -1374,6 +1556,7 @@ class GameEngine {
             this.state.propertyStates[prop].owner = from.id;
             to.properties.delete(prop);
             from.properties.add(prop);
+            this.propertyChanged(prop);
         }
 
         // Transfer cash
@@ -56,32 +56,19 @@ class GrowthTradingAI extends TradingAI {
      * Returns cumulative NPV over the projection horizon
      */
     calculateGrowthNPV(group, startingCash, opponents) {
-        const houseCost = BOARD[COLOR_GROUPS[group].squares[0]].housePrice;
-        const groupSize = COLOR_GROUPS[group].squares.length;
-        const costPerLevel = houseCost * groupSize;
-
-        let cash = startingCash;
-        let houses = 0;
-        let npv = 0;
-
-        for (let t = 1; t <= this.projectionHorizon; t++) {
-            const ept = this.calculateGroupEPT(group, houses, opponents);
-
-            // Add discounted EPT to NPV
-            const discountFactor = 1 / Math.pow(1 + this.discountRate, t);
-            npv += ept * discountFactor;
-
-            // Earn EPT
-            cash += ept;
-
-            // Buy houses if possible (build evenly)
-            while (houses < 5 && cash >= costPerLevel) {
-                cash -= costPerLevel;
-                houses++;
-            }
-        }
+        return this.calculateGrowthNPVs(group, [startingCash], opponents)[0];
+    }
 
-        return npv;
+    /**
+     * calculateGrowthNPV for many starting cash values in one batch
+     * @returns {Float64Array} NPV per starting cash
+     */
+    calculateGrowthNPVs(group, startingCashes, opponents) {
+        return this.getProjector().growthNPV(
+            group, 0, opponents, startingCashes,
+            this.projectionHorizon, this.discountRate,
+            { diceIncome: 0, capEachBuild: true }
+        );
     }
 
     /**
@@ -191,9 +178,15 @@ class GrowthTradingAI extends TradingAI {
         const step = 50;
 
         // Sample offers from base value up to max
+        const offers = [];
         for (let offer = baseValue; offer <= maxOffer; offer += step) {
-            const cashAfterTrade = myCash - offer;
-            const monopolyNPV = this.calculateGrowthNPV(group, cashAfterTrade, opponents);
+            offers.push(offer);
+        }
+        const npvs = this.calculateGrowthNPVs(group, offers.map(offer => myCash - offer), opponents);
+
+        for (let k = 0; k < offers.length; k++) {
+            const offer = offers[k];
+            const monopolyNPV = npvs[k];
 
             // Profit = value gained - price paid
             const profit = monopolyNPV - offer;
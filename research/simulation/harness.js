@@ -0,0 +1,69 @@
+/**
+ * Shared Script Harness
+ *
+ * Helpers used by the test-*.js scripts and by tools that drive the
+ * engine in bulk: silencing the engine's console chatter, counting
+ * pass/fail checks, and building a quiet SimulationRunner fixture.
+ *
+ * Usage:
+ *   const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+ *   const runner = createRunner({ maxTurns: 300 });  // Markov init without the log
+ *   const check = createCheck();
+ *   header('TESTING SOMETHING');
+ *   check(ok, 'what passed', `what failed: ${detail}`);
+ *   summary(check, 'ALL SOMETHING TESTS PASSED');    // sets process.exitCode
+ */
+
+'use strict';
+
+/** Run fn with console.log silenced */
+function quietly(fn) {
+    const log = console.log;
+    console.log = () => {};
+    try {
+        return fn();
+    } finally {
+        console.log = log;
+    }
+}
+
+/** SimulationRunner built without its initialization output */
+function createRunner(options = {}) {
+    return quietly(() => {
+        const { SimulationRunner } = require('./simulation-runner.js');
+        return new SimulationRunner(options);
+    });
+}
+
+/** check(ok, pass, fail) prints a ✓/✗ line; failed checks accumulate in check.failures */
+function createCheck() {
+    const check = (ok, pass, fail) => {
+        console.log(ok ? `✓ ${pass}` : `✗ ${fail}`);
+        if (!ok) check.failures++;
+        return ok;
+    };
+    check.failures = 0;
+    return check;
+}
+
+function header(title) {
+    console.log('='.repeat(60));
+    console.log(title);
+    console.log('='.repeat(60));
+}
+
+/** Closing banner; a failed check makes the script exit non-zero */
+function summary(check, passed) {
+    console.log('\n' + '='.repeat(60));
+    console.log(check.failures === 0 ? passed : `${check.failures} TEST(S) FAILED`);
+    console.log('='.repeat(60));
+    process.exitCode = check.failures === 0 ? 0 : 1;
+}
+
+module.exports = {
+    quietly,
+    createRunner,
+    createCheck,
+    header,
+    summary
+};
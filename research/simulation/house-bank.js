@@ -0,0 +1,298 @@
+/**
+ * House Bank
+ *
+ * The bank holds 32 houses and 12 hotels. self-play-analytics.js shows
+ * shortages happen (housesAvailable <= 3), but the engine hands the last
+ * houses out first-come in seat order, and no AI plans around them.
+ *
+ * With GameEngine option houseAuctions, a contended unit is auctioned
+ * instead, as the rules say ("if two or more players wish to buy more
+ * than the bank has, the houses must be sold at auction to the highest
+ * bidder"). A house (or hotel) is contended when more than one player can
+ * place one and together they could place more than the bank has left.
+ *
+ *   - Bidders are the players with demand, the builder first, then seat
+ *     order.
+ *   - Each bidder's limit comes from ai.getHouseBidLimit(kind, state),
+ *     or is the list price if the AI publishes none. It is capped by cash.
+ *   - Nobody may bid below the list price of their own cheapest target.
+ *   - The highest limit wins and pays one step over the second highest,
+ *     never less than list: the ascending auction of auction-resolver.js
+ *     in closed form.
+ *   - A winner other than the builder places the unit on its own best
+ *     target.
+ *
+ * Everything is a single pass over at most 22 streets per player, cheap
+ * enough to call inside every build decision.
+ *
+ * Supply as a weapon: opponentBuildGains() lists the rent (EPT) that
+ * opponents would add with each further house. On top of it:
+ *   denialValue()      rent a house we take away from opponents is worth
+ *   shouldHoldAtFour() whether the 4 houses a hotel returns to the bank are
+ *                      worth more to opponents than the hotel is to us
+ *
+ * Usage:
+ *   const engine = new GameEngine({ houseAuctions: true });
+ *   node house-bank.js --games 200 --seed 1    # starver vs relative, with and without
+ */
+
+'use strict';
+
+const { BOARD, COLOR_GROUPS } = require('./game-engine.js');
+
+const BID_STEP = 10;
+
+// =============================================================================
+// DEMAND AND CONTENTION
+// =============================================================================
+
+/** Squares where `player` may place its next house or hotel (engine rules) */
+function buildTargets(state, player, kind) {
+    const targets = [];
+    for (const group of player.getMonopolies(state)) {
+        const squares = COLOR_GROUPS[group].squares;
+        const min = Math.min(...squares.map(sq => state.propertyStates[sq].houses));
+        for (const sq of squares) {
+            const ps = state.propertyStates[sq];
+            if (ps.mortgaged || ps.houses !== min) continue;
+            if (kind === 'hotel' ? ps.houses === 4 : ps.houses < 4) targets.push(sq);
+        }
+    }
+    return targets;
+}
+
+/**
+ * Most houses (or hotels) `player` could buy right now with its cash,
+ * cheapest groups first, building evenly.
+ */
+function unitDemand(state, player, kind) {
+    const groups = [];
+    for (const group of player.getMonopolies(state)) {
+        const squares = COLOR_GROUPS[group].squares.filter(sq => !state.propertyStates[sq].mortgaged);
+        const need = kind === 'hotel'
+            ? (Math.min(...squares.map(sq => state.propertyStates[sq].houses)) === 4
+                ? squares.filter(sq => state.propertyStates[sq].houses === 4).length : 0)
+            : squares.reduce((n, sq) => n + Math.max(0, 4 - state.propertyStates[sq].houses), 0);
+        if (need > 0) groups.push({ need, price: COLOR_GROUPS[group].housePrice });
+    }
+    groups.sort((a, b) => a.price - b.price);
+    let money = player.money;
+    let demand = 0;
+    for (const g of groups) {
+        const n = Math.min(g.need, Math.floor(money / g.price));
+        demand += n;
+        money -= n * g.price;
+    }
+    return demand;
+}
+
+/**
+ * Per-player demand for a unit and whether the bank can't meet it.
+ * @returns {{available: number, demands: number[], contended: boolean}}
+ */
+function contention(state, kind) {
+    const available = kind === 'hotel' ? state.hotelsAvailable : state.housesAvailable;
+    const demands = state.players.map(p => (p.bankrupt ? 0 : unitDemand(state, p, kind)));
+    const wanting = demands.filter(d => d > 0).length;
+    const total = demands.reduce((s, d) => s + d, 0);
+    return { available, demands, contended: wanting > 1 && total > available };
+}
+
+// =============================================================================
+// LAST-HOUSES AUCTION
+// =============================================================================
+
+/** Next-unit rent gain per opponent turn (EPT) on a square at `houses` */
+function marginalRent(position, houses, probs) {
+    const square = BOARD[position];
+    const from = houses === 0 ? square.rent[0] * 2 : square.rent[houses];
+    return probs[position] * (square.rent[houses + 1] - from);
+}
+
+/** Target with the largest rent step (probabilities not needed) */
+function defaultTarget(state, targets) {
+    let best = targets[0];
+    let bestGain = -Infinity;
+    for (const sq of targets) {
+        const h = state.propertyStates[sq].houses;
+        const gain = BOARD[sq].rent[h + 1] - (h === 0 ? BOARD[sq].rent[0] * 2 : BOARD[sq].rent[h]);
+        if (gain > bestGain) { bestGain = gain; best = sq; }
+    }
+    return best;
+}
+
+/**
+ * Auction the unit `builder` asked for at `position`, if it is contended.
+ * @returns {{winner: Player, price: number, target: number, bidders: number}|null}
+ *          null when the bank isn't short (the builder just buys at list)
+ */
+function auctionLastUnit(engine, builder, position, kind) {
+    const state = engine.state;
+    const { demands, contended } = contention(state, kind);
+    if (!contended) return null;
+
+    const n = state.players.length;
+    const bids = [];
+    for (let k = 0; k < n; k++) {
+        const player = state.players[(builder.id + k) % n];
+        if (demands[player.id] === 0) continue;
+        const targets = player === builder ? [position] : buildTargets(state, player, kind);
+        const list = Math.min(...targets.map(sq => BOARD[sq].housePrice));
+        const published = player.ai && player.ai.getHouseBidLimit
+            ? player.ai.getHouseBidLimit(kind, state) : null;
+        const limit = Math.min(published === null || published === undefined ? list : published, player.money);
+        if (limit >= list) bids.push({ player, targets, list, limit });
+    }
+    if (bids.length === 0) return null;
+
+    let top = bids[0];
+    for (const b of bids) if (b.limit > top.limit) top = b;
+    const second = bids.reduce((m, b) => (b === top ? m : Math.max(m, b.limit)), 0);
+
+    let target = top.player === builder ? position : null;
+    if (target === null) {
+        const chosen = top.player.ai && top.player.ai.chooseBuildTarget
+            ? top.player.ai.chooseBuildTarget(kind, state) : null;
+        // Only targets the winning limit covers at list price
+        const affordable = top.targets.filter(sq => BOARD[sq].housePrice <= top.limit);
+        target = affordable.includes(chosen) ? chosen : defaultTarget(state, affordable);
+    }
+    const price = Math.max(BOARD[target].housePrice, Math.min(top.limit, second + BID_STEP));
+    return { winner: top.player, price, target, bidders: bids.length };
+}
+
+// =============================================================================
+// SUPPLY STRATEGY
+// =============================================================================
+
+/**
+ * Rent per turn (EPT x their opponents) each further house would add for
+ * the opponents of `player`, best first, as far as their cash reaches
+ * (or up to 4 houses everywhere with options.ignoreCash).
+ */
+function opponentBuildGains(state, player, probs, options = {}) {
+    const active = state.players.filter(p => !p.bankrupt).length;
+    const gains = [];
+    for (const opp of state.players) {
+        if (opp.bankrupt || opp.id === player.id) continue;
+        const steps = [];
+        for (const group of opp.getMonopolies(state)) {
+            const squares = COLOR_GROUPS[group].squares.filter(sq => !state.propertyStates[sq].mortgaged);
+            const level = squares.map(sq => state.propertyStates[sq].houses);
+            // Even building: raise the lowest squares one level at a time
+            for (let h = Math.min(...level); h < 4; h++) {
+                squares.forEach((sq, i) => {
+                    if (level[i] <= h) steps.push({ gain: marginalRent(sq, h, probs) * (active - 1), price: BOARD[sq].housePrice });
+                });
+            }
+        }
+        steps.sort((a, b) => b.gain - a.gain);
+        let money = options.ignoreCash ? Infinity : opp.money;
+        for (const s of steps) {
+            if (money < s.price) continue;
+            money -= s.price;
+            gains.push(s.gain);
+        }
+    }
+    return gains.sort((a, b) => b - a);
+}
+
+/**
+ * Rent per turn denied to opponents by taking one house from the bank:
+ * their worst house that would have fit, or 0 if the bank can serve them all.
+ */
+function denialValue(state, player, probs) {
+    const gains = opponentBuildGains(state, player, probs);
+    const available = state.housesAvailable;
+    if (available === 0 || gains.length < available) return 0;
+    return gains[available - 1];
+}
+
+/**
+ * True if upgrading `position` to a hotel would release houses that earn
+ * opponents more than the hotel earns us. A hotel is for good, so
+ * opponents' demand is counted at full capacity, not just today's cash.
+ */
+function shouldHoldAtFour(state, player, position, probs) {
+    const gains = opponentBuildGains(state, player, probs, { ignoreCash: true });
+    const available = state.housesAvailable;
+    if (gains.length <= available) return false;
+    const active = state.players.filter(p => !p.bankrupt).length;
+    const ours = marginalRent(position, 4, probs) * (active - 1);
+    const released = gains.slice(available, available + 4).reduce((s, g) => s + g, 0);
+    return released > ours;
+}
+
+module.exports = {
+    buildTargets,
+    unitDemand,
+    contention,
+    auctionLastUnit,
+    marginalRent,
+    opponentBuildGains,
+    denialValue,
+    shouldHoldAtFour,
+    BID_STEP
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+function main() {
+    const args = process.argv.slice(2);
+    let games = 100;
+    let seed = 1;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--games': games = parseInt(args[++i], 10); break;
+            case '--seed': seed = parseInt(args[++i], 10); break;
+        }
+    }
+
+    const { GameEngine } = require('./game-engine.js');
+    const { createRunner } = require('./harness.js');
+    const { SeatSchedule } = require('./seat-schedule.js');
+    const { withSeed } = require('./seeded-random.js');
+    const runner = createRunner({ maxTurns: 500 });
+
+    const lineup = ['starver', 'relative', 'relative', 'relative'];
+    const schedule = new SeatSchedule(4, { mode: 'latin', seed });
+    console.log(`House supply: ${lineup.join(', ')}, ${games} games per rule set (Latin seating)\n`);
+
+    for (const houseAuctions of [false, true]) {
+        const wins = [0, 0, 0, 0];
+        let timeouts = 0, shortTurns = 0, turns = 0, auctions = 0, premium = 0;
+        const start = Date.now();
+        for (let g = 0; g < games; g++) {
+            const { order, seed: gameSeed } = schedule.game(g);
+            const result = withSeed(gameSeed, () => {
+                const engine = new GameEngine({ maxTurns: 500, houseAuctions });
+                engine.newGame(4, order.map(e => runner.createAIFactory(lineup[e])));
+                const baseTurn = engine.executeTurn.bind(engine);
+                engine.executeTurn = (...a) => {
+                    const r = baseTurn(...a);
+                    if (engine.state.housesAvailable === 0) shortTurns++;
+                    return r;
+                };
+                const r = engine.runGame();
+                auctions += engine.state.stats.houseAuctions || 0;
+                premium += engine.state.stats.housePremiums || 0;
+                return r;
+            });
+            turns += result.turns;
+            if (result.winner === null) timeouts++;
+            else wins[order[result.winner]]++;
+        }
+        const rate = wins[0] / games;
+        console.log(`${houseAuctions ? 'Last-houses auctions' : 'Seat order (default)'}:`);
+        console.log(`  starver wins ${wins[0]}/${games} (${(rate * 100).toFixed(1)}% +/- ` +
+            `${(Math.sqrt(rate * (1 - rate) / games) * 100).toFixed(1)}%), relative [${wins.slice(1)}], ${timeouts} timeouts`);
+        console.log(`  bank empty on ${(100 * shortTurns / Math.max(1, turns)).toFixed(1)}% of turns; ` +
+            `${auctions} house auctions, $${premium} paid over list; ${((Date.now() - start) / 1000).toFixed(1)}s\n`);
+    }
+}
+
+if (require.main === module) {
+    main();
+}
@@ -0,0 +1,71 @@
+/**
+ * House Starver AI
+ *
+ * RelativeGrowthAI that treats the bank's 32 houses as a contested
+ * resource (house-bank.js):
+ *
+ * 1. Holds at 4 houses while a hotel would hand the bank 4 houses that earn
+ *    opponents more than the hotel earns us.
+ * 2. While opponents want more houses than the bank has left, keeps
+ *    buying them down to a thinner cash reserve: each house it takes is
+ *    rent an opponent can't build.
+ * 3. Bids the value of own rent plus denial over its projection horizon
+ *    at last-houses auctions (with GameEngine option houseAuctions).
+ */
+
+'use strict';
+
+const { RelativeGrowthAI } = require('./relative-growth-ai.js');
+const { BOARD } = require('./game-engine.js');
+const { buildTargets, marginalRent, denialValue, shouldHoldAtFour } = require('./house-bank.js');
+
+class HouseStarverAI extends RelativeGrowthAI {
+    constructor(player, engine, markovEngine, valuator) {
+        super(player, engine, markovEngine, valuator);
+        this.name = 'HouseStarverAI';
+
+        // Fraction of the usual cash reserve kept while starving opponents
+        this.starveReserveFactor = 0.5;
+    }
+
+    calculateMarginalROI(position, currentHouses, state) {
+        if (this.probs && currentHouses === 4 && shouldHoldAtFour(state, this.player, position, this.probs)) {
+            return 0;
+        }
+        return super.calculateMarginalROI(position, currentHouses, state);
+    }
+
+    buildOptimalHouses(state) {
+        super.buildOptimalHouses(state);
+        if (!this.probs) return;
+
+        // Into a shortage: keep taking the houses opponents are waiting for
+        const reserve = this.getMinReserve(state) * this.starveReserveFactor;
+        while (denialValue(state, this.player, this.probs) > 0) {
+            let best = null;
+            let bestROI = 0;
+            for (const sq of buildTargets(state, this.player, 'house')) {
+                if (this.player.money - BOARD[sq].housePrice < reserve) continue;
+                const roi = this.calculateMarginalROI(sq, state.propertyStates[sq].houses, state);
+                if (roi > bestROI) { bestROI = roi; best = sq; }
+            }
+            if (best === null || !this.engine.buildHouse(this.player, best)) break;
+        }
+    }
+
+    getHouseBidLimit(kind, state) {
+        if (!this.probs) return null;
+        const targets = buildTargets(state, this.player, kind);
+        if (targets.length === 0) return null;
+
+        const opponents = state.players.filter(p => !p.bankrupt).length - 1;
+        const own = Math.max(...targets.map(sq =>
+            marginalRent(sq, state.propertyStates[sq].houses, this.probs) * opponents));
+        const denial = kind === 'house' ? denialValue(state, this.player, this.probs) : 0;
+        const annuity = (1 - Math.pow(1 + this.discountRate, -this.projectionHorizon)) / this.discountRate;
+
+        return Math.min(Math.floor((own + denial) * annuity), this.player.money - this.getMinReserve(state));
+    }
+}
+
+module.exports = { HouseStarverAI };
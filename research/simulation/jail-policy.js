@@ -0,0 +1,447 @@
+/**
+ * Jail Policy by MDP Policy Iteration
+ *
+ * The AIs choose between paying $50 to leave jail and rolling for doubles
+ * with fixed rules of thumb (opponent house counts, 'stay' vs 'leave' in
+ * the Markov engine). This module solves the choice as a Markov decision
+ * process on the current board instead:
+ *
+ *   states   40 board squares + jail turns 1-3 (extended Markov states 40-42)
+ *   actions  in jail: pay (leave now, full doubles) or roll (stay strategy)
+ *   reward   per landing: -rent owed to opponents, +an opportunity value
+ *            for unowned property we can afford, -tax, +GO salary;
+ *            -$50 for paying bail (or for failing the third roll)
+ *
+ * Rents come from engine.calculateRent, so every rule (monopoly doubling,
+ * houses, railroad counts, mortgages) is included. Own cash enters through
+ * the cost of a shortfall: dollars of rent beyond liquid cash must be raised
+ * by selling houses or mortgaging at half value, so each costs 1 +
+ * shortfallPenalty dollars. The MDP is solved once per cash bucket.
+ *
+ * Policy iteration evaluates a policy exactly and improves it in the three
+ * jail states; with only 2^3 jail policies it stops after two or three
+ * evaluations. The linear system (I - gamma P) depends only on the policy,
+ * so its inverse is cached and each evaluation is one 43 x 43 mat-vec. A
+ * full table solves in well under a millisecond, so it is refreshed
+ * whenever opponents' rents move by more than `materiality` dollars per
+ * turn.
+ *
+ * Transitions come from the Markov engine's `dice` configuration, classic
+ * unless options.dice says otherwise; pass variantDice(name) when playing
+ * a rule variant that changes movement (e.g. 'speed' for speedDie).
+ *
+ * Usage:
+ *   const policy = new JailPolicy(engine, playerId, probs);
+ *   policy.shouldLeave(player.money, player.jailTurns);   // O(1) lookup
+ *   node jail-policy.js --seed 7 --turns 60
+ *   node jail-policy.js --compare 200
+ */
+
+'use strict';
+
+const { BOARD, SQUARE_TYPES } = require('./game-engine.js');
+const MonopolyMarkov = require('../../ai/markov-engine.js');
+
+const BOARD_SIZE = 40;
+const STATES = 43;
+const JAIL_STATE = 40;
+const BAIL = 50;
+const GO_SALARY = 200;
+
+const ROLL = 0;
+const PAY = 1;
+
+const DEFAULTS = {
+    discount: 0.97,          // per own turn; ~30-turn horizon
+    cashStep: 100,
+    cashBuckets: 21,         // $0 .. $2000+
+    shortfallPenalty: 1.0,   // extra cost per dollar raised by liquidation
+    unownedValue: 0.25,      // opportunity value of an affordable unowned square, x price
+    materiality: 1.0,        // re-solve when landing values move this many $/turn
+    dice: 'classic'          // MarkovEngine dice configuration (name or object)
+};
+
+// =============================================================================
+// TRANSITIONS
+// =============================================================================
+
+// Per dice configuration, keyed by diceKey()
+const transitions = new Map();
+
+function diceKey(dice) {
+    return typeof dice === 'string' ? dice : JSON.stringify(dice);
+}
+
+/**
+ * Extended transition rows for both jail actions, built once per process
+ * for each dice configuration. Board rows are shared; jail rows differ by
+ * action.
+ */
+function getTransitions(dice) {
+    const key = diceKey(dice);
+    if (!transitions.has(key)) {
+        const stay = MonopolyMarkov.buildExtendedTransitionMatrix('stay', dice);
+        const leave = MonopolyMarkov.buildExtendedTransitionMatrix('leave', dice);
+        const toArray = (T) => {
+            const flat = new Float64Array(STATES * STATES);
+            for (let i = 0; i < STATES; i++) flat.set(T[i], i * STATES);
+            return flat;
+        };
+        transitions.set(key, { [ROLL]: toArray(stay), [PAY]: toArray(leave) });
+    }
+    return transitions.get(key);
+}
+
+/** Board square a state sits on (jail states are on square 10) */
+function squareOf(state) {
+    return state >= JAIL_STATE ? 10 : state;
+}
+
+// =============================================================================
+// JAIL POLICY
+// =============================================================================
+
+class JailPolicy {
+    /**
+     * @param {GameEngine} engine - rents come from engine.calculateRent
+     * @param {number} playerId - whose decision this is
+     * @param {number[]} probs - steady-state landing probabilities (materiality weights)
+     * @param {Object} options - overrides for DEFAULTS
+     */
+    constructor(engine, playerId, probs, options = {}) {
+        this.engine = engine;
+        this.playerId = playerId;
+        this.probs = probs;
+        this.params = { ...DEFAULTS, ...options };
+
+        const B = this.params.cashBuckets;
+        // 1 = pay to leave, indexed [cashBucket * 3 + jailTurns]
+        this.table = new Uint8Array(B * 3);
+        // Q(pay) - Q(roll) in dollars, for diagnostics
+        this.advantage = new Float64Array(B * 3);
+
+        // Board the table was solved for
+        this.rent = new Float64Array(BOARD_SIZE);
+        this.price = new Float64Array(BOARD_SIZE);
+        this.boardVersion = -1;
+        this.solves = 0;
+        this.solved = false;
+    }
+
+    /**
+     * Should the player pay to leave? O(1) unless the board changed.
+     * @param {number} cash - cash on hand
+     * @param {number} jailTurns - failed rolls so far (0-2)
+     */
+    shouldLeave(cash, jailTurns) {
+        this.refresh();
+        return this.table[this.bucket(cash) * 3 + Math.min(jailTurns, 2)] === PAY;
+    }
+
+    bucket(cash) {
+        const b = Math.floor(Math.max(0, cash) / this.params.cashStep);
+        return Math.min(b, this.params.cashBuckets - 1);
+    }
+
+    /**
+     * Re-solve if the board moved materially since the last solve. Nothing
+     * is read unless engine.propertyChanged() has fired since the last call.
+     * @returns {boolean} true if the table was re-solved
+     */
+    refresh() {
+        if (this.engine.boardVersion === this.boardVersion) return false;
+        this.boardVersion = this.engine.boardVersion;
+
+        const rent = new Float64Array(BOARD_SIZE);
+        const price = new Float64Array(BOARD_SIZE);
+        this.readBoard(rent, price);
+
+        if (this.solved) {
+            const { unownedValue, materiality } = this.params;
+            let moved = 0;
+            for (let sq = 0; sq < BOARD_SIZE; sq++) {
+                const p = this.probs ? this.probs[sq] : 1 / BOARD_SIZE;
+                moved += p * (Math.abs(rent[sq] - this.rent[sq]) +
+                    unownedValue * Math.abs(price[sq] - this.price[sq]));
+            }
+            if (moved < materiality) return false;
+        }
+
+        this.rent = rent;
+        this.price = price;
+        this.solve();
+        return true;
+    }
+
+    /**
+     * Rent owed on each opponent-owned square and the price of each
+     * unowned purchasable square, from this player's point of view.
+     */
+    readBoard(rent, price) {
+        const state = this.engine.state;
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            const propState = state.propertyStates[sq];
+            if (!propState) continue;
+            if (propState.owner === null || propState.owner === undefined) {
+                price[sq] = BOARD[sq].price;
+            } else if (propState.owner !== this.playerId) {
+                rent[sq] = this.engine.calculateRent(sq, 7);
+            }
+        }
+    }
+
+    // =========================================================================
+    // SOLVER
+    // =========================================================================
+
+    /** Solve the MDP for every cash bucket */
+    solve() {
+        const B = this.params.cashBuckets;
+        for (let b = 0; b < B; b++) {
+            const cash = b * this.params.cashStep;
+            const { policy, advantage } = this.iterate(this.landingValues(cash), cash);
+            for (let t = 0; t < 3; t++) {
+                this.table[b * 3 + t] = policy[t];
+                this.advantage[b * 3 + t] = advantage[t];
+            }
+        }
+        this.solves++;
+        this.solved = true;
+    }
+
+    /** Expected value of ending a turn on each square, at a given cash level */
+    landingValues(cash) {
+        const { shortfallPenalty, unownedValue } = this.params;
+        const cost = (amount) => amount + shortfallPenalty * Math.max(0, amount - cash);
+
+        const values = new Float64Array(BOARD_SIZE);
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            const square = BOARD[sq];
+            if (this.rent[sq] > 0) {
+                values[sq] = -cost(this.rent[sq]);
+            } else if (this.price[sq] > 0 && this.price[sq] <= cash) {
+                values[sq] = unownedValue * this.price[sq];
+            } else if (square.type === SQUARE_TYPES.TAX) {
+                values[sq] = -cost(square.amount);
+            }
+        }
+        return values;
+    }
+
+    /** Immediate expected reward of each (state, action), indexed [action][state] */
+    rewards(landing, cash) {
+        const T = getTransitions(this.params.dice);
+        const bail = BAIL + this.params.shortfallPenalty * Math.max(0, BAIL - cash);
+
+        const reward = { [ROLL]: new Float64Array(STATES), [PAY]: new Float64Array(STATES) };
+        for (const a of [ROLL, PAY]) {
+            const P = T[a];
+            for (let s = 0; s < STATES; s++) {
+                const from = squareOf(s);
+                let r = 0;
+                for (let t = 0; t < BOARD_SIZE; t++) {
+                    const p = P[s * STATES + t];
+                    if (p === 0) continue;
+                    // Forward moves that end behind the start passed GO
+                    r += p * (landing[t] + (t < from ? GO_SALARY : 0));
+                }
+                reward[a][s] = r;
+            }
+        }
+        for (let s = JAIL_STATE; s < STATES; s++) reward[PAY][s] -= bail;
+        // Third failed roll: pay bail anyway (5/6 of the time)
+        reward[ROLL][STATES - 1] -= bail * 5 / 6;
+        return reward;
+    }
+
+    /**
+     * Policy iteration over the jail actions.
+     * @returns {{policy: number[], advantage: number[]}} per jail turn
+     */
+    iterate(landing, cash) {
+        const T = getTransitions(this.params.dice);
+        const gamma = this.params.discount;
+        const reward = this.rewards(landing, cash);
+
+        const policy = [ROLL, ROLL, ROLL];
+        const advantage = [0, 0, 0];
+        for (let round = 0; round < 8; round++) {
+            const V = this.evaluate(policy, reward, gamma);
+
+            let changed = false;
+            for (let j = 0; j < 3; j++) {
+                const s = JAIL_STATE + j;
+                const q = [ROLL, PAY].map(a => {
+                    let future = 0;
+                    const P = T[a];
+                    for (let t = 0; t < STATES; t++) future += P[s * STATES + t] * V[t];
+                    return reward[a][s] + gamma * future;
+                });
+                advantage[j] = q[PAY] - q[ROLL];
+                const best = q[PAY] > q[ROLL] + 1e-9 ? PAY : ROLL;
+                if (best !== policy[j]) {
+                    policy[j] = best;
+                    changed = true;
+                }
+            }
+            if (!changed) break;
+        }
+        return { policy, advantage };
+    }
+
+    /**
+     * Exact policy evaluation: V = (I - gamma P_pi)^-1 r_pi. The resolvent
+     * depends only on the jail policy, the discount and the dice, never on
+     * the board or cash, so each of the eight is inverted once per process.
+     */
+    evaluate(policy, reward, gamma) {
+        const inverse = getResolvent(policy, gamma, this.params.dice);
+        const n = STATES;
+        const r = new Float64Array(n);
+        for (let s = 0; s < n; s++) {
+            r[s] = reward[s >= JAIL_STATE ? policy[s - JAIL_STATE] : ROLL][s];
+        }
+
+        const V = new Float64Array(n);
+        for (let s = 0; s < n; s++) {
+            let sum = 0;
+            for (let t = 0; t < n; t++) sum += inverse[s * n + t] * r[t];
+            V[s] = sum;
+        }
+        return V;
+    }
+}
+
+const resolvents = new Map();
+
+function getResolvent(policy, gamma, dice) {
+    const key = `${policy.join('')}:${gamma}:${diceKey(dice)}`;
+    let inverse = resolvents.get(key);
+    if (!inverse) {
+        const T = getTransitions(dice);
+        const n = STATES;
+        const A = new Float64Array(n * n);
+        for (let s = 0; s < n; s++) {
+            const P = T[s >= JAIL_STATE ? policy[s - JAIL_STATE] : ROLL];
+            for (let t = 0; t < n; t++) A[s * n + t] = -gamma * P[s * n + t];
+            A[s * n + s] += 1;
+        }
+        inverse = invert(A, n);
+        resolvents.set(key, inverse);
+    }
+    return inverse;
+}
+
+/**
+ * Invert A (Gauss-Jordan with partial pivoting). I - gamma P is strictly
+ * diagonally dominant for gamma < 1, but pivoting keeps it robust.
+ */
+function invert(A, n) {
+    const inv = new Float64Array(n * n);
+    for (let i = 0; i < n; i++) inv[i * n + i] = 1;
+
+    const swapRows = (M, a, b) => {
+        for (let j = 0; j < n; j++) {
+            const tmp = M[a * n + j];
+            M[a * n + j] = M[b * n + j];
+            M[b * n + j] = tmp;
+        }
+    };
+
+    for (let k = 0; k < n; k++) {
+        let pivot = k;
+        for (let i = k + 1; i < n; i++) {
+            if (Math.abs(A[i * n + k]) > Math.abs(A[pivot * n + k])) pivot = i;
+        }
+        if (pivot !== k) {
+            swapRows(A, k, pivot);
+            swapRows(inv, k, pivot);
+        }
+        const diag = A[k * n + k];
+        for (let j = 0; j < n; j++) {
+            A[k * n + j] /= diag;
+            inv[k * n + j] /= diag;
+        }
+        for (let i = 0; i < n; i++) {
+            if (i === k) continue;
+            const f = A[i * n + k];
+            if (f === 0) continue;
+            for (let j = 0; j < n; j++) {
+                A[i * n + j] -= f * A[k * n + j];
+                inv[i * n + j] -= f * inv[k * n + j];
+            }
+        }
+    }
+    return inv;
+}
+
+module.exports = { JailPolicy, DEFAULTS };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const { GameEngine } = require('./game-engine.js');
+    const { createRunner, quietly } = require('./harness.js');
+    const { withSeed } = require('./seeded-random.js');
+
+    const args = process.argv.slice(2);
+    const options = { seed: 7, turns: 60, compare: 0 };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--turns': options.turns = parseInt(args[++i], 10); break;
+            case '--compare': options.compare = parseInt(args[++i], 10); break;
+        }
+    }
+
+    const runner = createRunner({ maxTurns: 500 });
+    const probs = runner.markovEngine.getAllProbabilities('stay');
+
+    if (options.compare > 0) {
+        // Rotate one MDP-jail seat through three baseline seats
+        let wins = 0;
+        let games = 0;
+        for (let g = 0; g < options.compare; g++) {
+            const seat = g % 4;
+            const lineup = ['optimal', 'optimal', 'optimal', 'optimal'];
+            lineup[seat] = 'mdpjail';
+            const result = withSeed(options.seed + g, () => quietly(() => runner.runSingleGame(lineup)));
+            games++;
+            if (result.winner === seat) wins++;
+        }
+        const rate = wins / games;
+        const se = Math.sqrt(0.25 * 0.75 / games);
+        console.log(`MDP jail vs 3x optimal: ${wins}/${games} wins ` +
+            `(${(rate * 100).toFixed(1)}%, baseline 25%, z=${((rate - 0.25) / se).toFixed(2)})`);
+    } else {
+        const lineup = ['strategic', 'optimal', 'relative', 'growth'];
+        const engine = withSeed(options.seed, () => {
+            const e = new GameEngine({ maxTurns: 500 });
+            e.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+            quietly(() => {
+                while (!e.state.isGameOver() && e.state.turn < options.turns) e.executeTurn();
+            });
+            return e;
+        });
+
+        console.log(`Jail policy after ${engine.state.turn} turns (seed ${options.seed})`);
+        console.log('P = pay to leave, r = roll for doubles; columns are jail turns 1-3\n');
+        for (const player of engine.state.getActivePlayers()) {
+            const policy = new JailPolicy(engine, player.id, probs);
+            const start = process.hrtime.bigint();
+            policy.refresh();
+            const ms = Number(process.hrtime.bigint() - start) / 1e6;
+
+            const row = [];
+            for (let b = 0; b < policy.params.cashBuckets; b += 2) {
+                row.push(Array.from({ length: 3 }, (_, t) =>
+                    policy.table[b * 3 + t] === PAY ? 'P' : 'r').join(''));
+            }
+            console.log(`  ${lineup[player.id].padEnd(10)} cash $0..$2000 by 200: ${row.join(' ')}` +
+                `   (now $${player.money}: ${policy.shouldLeave(player.money, 0) ? 'pay' : 'roll'}, ` +
+                `solved in ${ms.toFixed(1)}ms)`);
+        }
+    }
+}
@@ -0,0 +1,548 @@
+/**
+ * Empirical Meta-Game Solver
+ *
+ * Answers "which AI is best against a mix of AIs" rather than "which AI
+ * beats three copies of X" (the question nash-comparison.js and the
+ * one-vs-three tournaments ask).
+ *
+ * A 4-player game between K strategies is symmetric, so its payoffs depend
+ * only on the lineup - the multiset of strategies at the table. There are
+ * C(K+3, 4) lineups. For each one the solver estimates the per-player win
+ * share of every strategy in it, with standard errors. Together these form
+ * the empirical payoff tensor. Then:
+ *
+ *   - Every lineup is played in blocks of 4 cyclic seat rotations, so each
+ *     strategy sits in each seat equally often. Game j of every lineup uses
+ *     seed deriveSeed(seed, j) (common random numbers across lineups).
+ *   - Symmetric equilibria are found by running replicator dynamics from
+ *     many starting mixes. Each fixed point is checked for regret: the most
+ *     any single strategy gains over the mix against 3 opponents drawn
+ *     from it. Zero regret within noise means a Nash equilibrium.
+ *   - Adaptive allocation: after an initial pass, each round sends games to
+ *     the lineups whose payoff uncertainty most affects the equilibrium
+ *     payoffs. Lineup L is weighted by sum over s in L of
+ *     P(L minus s | mix) * SE(u_s in L). Lineups the equilibrium never
+ *     reaches get almost nothing, so far fewer games are needed than with
+ *     a uniform round robin.
+ *
+ * A timed-out game counts as a quarter win for every seat, so each game
+ * hands out exactly 1 and the neutral payoff is 0.25.
+ *
+ * Strategies are SimulationRunner AI types ('growth', 'leader', ...) or
+ * the nash-comparison.js pricing variants 'convergence', 'area' and
+ * 'original'.
+ *
+ * Usage:
+ *   node meta-game.js                                   # growth, leader, relative, optimal
+ *   node meta-game.js --strategies convergence,area,original --rounds 6
+ *   node meta-game.js --initial 8 --round-games 400 --workers 8
+ *   node meta-game.js --json benchmark-results/meta-game.json
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { isMainThread, workerData } = require('worker_threads');
+
+const { withSeed, deriveSeed, createRandom } = require('./seeded-random.js');
+const { WorkerPool, serveJobs } = require('./worker-pool.js');
+const { quietly, createRunner } = require('./harness.js');
+
+const PLAYERS = 4;
+
+const NASH_VARIANTS = {
+    convergence: 'createConvergenceFactory',
+    area: 'createAreaFactory',
+    original: 'createOriginalFactory'
+};
+
+const DEFAULTS = {
+    strategies: ['growth', 'leader', 'relative', 'optimal'],
+    initialGames: 8,        // per lineup, rounded up to whole rotations
+    rounds: 4,
+    roundGames: 200,        // adaptive games per round
+    explore: 0.1,           // share of each round spread uniformly
+    workers: os.cpus().length,
+    seed: 20240601,
+    maxTurns: 500
+};
+
+// =============================================================================
+// LINEUPS
+// =============================================================================
+
+/** All non-decreasing index tuples of length `size` over k strategies */
+function enumerateLineups(k, size = PLAYERS) {
+    const lineups = [];
+    const build = (prefix, from) => {
+        if (prefix.length === size) {
+            lineups.push(prefix.slice());
+            return;
+        }
+        for (let s = from; s < k; s++) {
+            prefix.push(s);
+            build(prefix, s);
+            prefix.pop();
+        }
+    };
+    build([], 0);
+    return lineups;
+}
+
+const lineupKey = (lineup) => lineup.join(',');
+
+/** Canonical lineup formed by adding strategy s to opponents */
+function withStrategy(opponents, s) {
+    return [...opponents, s].sort((a, b) => a - b);
+}
+
+/** Seat order for game j: rotate the lineup by j mod 4 */
+function seatOrder(lineup, game) {
+    const r = game % lineup.length;
+    return [...lineup.slice(r), ...lineup.slice(0, r)];
+}
+
+/**
+ * Opponent multisets of size PLAYERS - 1, each with its multinomial
+ * coefficient, for computing P(opponents | mix).
+ */
+function opponentProfiles(k) {
+    const n = PLAYERS - 1;
+    const factorial = (m) => (m <= 1 ? 1 : m * factorial(m - 1));
+    return enumerateLineups(k, n).map(members => {
+        const counts = new Array(k).fill(0);
+        for (const s of members) counts[s]++;
+        return { members, counts, coef: factorial(n) / counts.reduce((p, c) => p * factorial(c), 1) };
+    });
+}
+
+function profileProbability(profile, x) {
+    let p = profile.coef;
+    profile.counts.forEach((c, s) => { if (c > 0) p *= Math.pow(x[s], c); });
+    return p;
+}
+
+// =============================================================================
+// PAYOFF TABLE
+// =============================================================================
+
+/**
+ * Per-lineup, per-strategy payoff statistics. The payoff to one player of
+ * strategy s in a game is 1/count(s) if s won, 1/4 on timeout, else 0.
+ */
+class PayoffTable {
+    constructor(k) {
+        this.k = k;
+        this.entries = new Map();
+        for (const lineup of enumerateLineups(k)) {
+            this.entries.set(lineupKey(lineup), {
+                lineup,
+                games: 0,
+                sum: new Array(k).fill(0),
+                sumSq: new Array(k).fill(0)
+            });
+        }
+    }
+
+    /** @param {number} winner - strategy index that won, or -1 on timeout */
+    record(lineup, winner) {
+        const entry = this.entries.get(lineupKey(lineup));
+        const counts = new Array(this.k).fill(0);
+        for (const s of lineup) counts[s]++;
+        entry.games++;
+        for (let s = 0; s < this.k; s++) {
+            if (counts[s] === 0) continue;
+            const payoff = winner < 0 ? 1 / PLAYERS : (winner === s ? 1 / counts[s] : 0);
+            entry.sum[s] += payoff;
+            entry.sumSq[s] += payoff * payoff;
+        }
+    }
+
+    mean(s, lineup) {
+        const e = this.entries.get(lineupKey(lineup));
+        return e.games > 0 ? e.sum[s] / e.games : 1 / PLAYERS;
+    }
+
+    /**
+     * Standard error, floored so unplayed or one-sided lineups aren't treated
+     * as certain. A lineup of one strategy pays exactly 1/4 and needs no games.
+     */
+    se(s, lineup) {
+        if (lineup.every(t => t === lineup[0])) return 0;
+        const e = this.entries.get(lineupKey(lineup));
+        if (e.games < 2) return 0.5;
+        const m = e.sum[s] / e.games;
+        const variance = Math.max((e.sumSq[s] / e.games - m * m) * e.games / (e.games - 1), 0.25 * 0.75 / 4);
+        return Math.sqrt(variance / e.games);
+    }
+
+    get totalGames() {
+        let n = 0;
+        for (const e of this.entries.values()) n += e.games;
+        return n;
+    }
+
+    toJSON() {
+        return [...this.entries.values()].map(e => ({
+            lineup: e.lineup,
+            games: e.games,
+            payoff: e.lineup.filter((s, i) => e.lineup.indexOf(s) === i)
+                .map(s => ({ strategy: s, mean: this.mean(s, e.lineup), se: this.se(s, e.lineup) }))
+        }));
+    }
+}
+
+// =============================================================================
+// SOLVER
+// =============================================================================
+
+/**
+ * Expected payoff of each pure strategy against 3 opponents drawn from mix x.
+ * @returns {{u: number[], se: number[], average: number}}
+ */
+function expectedPayoffs(table, x, profiles = opponentProfiles(table.k)) {
+    const k = table.k;
+    const u = new Array(k).fill(0);
+    const variance = new Array(k).fill(0);
+    for (const profile of profiles) {
+        const p = profileProbability(profile, x);
+        if (p === 0) continue;
+        for (let s = 0; s < k; s++) {
+            const lineup = withStrategy(profile.members, s);
+            u[s] += p * table.mean(s, lineup);
+            variance[s] += p * p * Math.pow(table.se(s, lineup), 2);
+        }
+    }
+    const average = u.reduce((sum, v, s) => sum + x[s] * v, 0);
+    return { u, se: variance.map(Math.sqrt), average };
+}
+
+/** Gain of the best pure deviation over the mix */
+function regret(table, x, profiles) {
+    const { u, average } = expectedPayoffs(table, x, profiles);
+    return Math.max(...u) - average;
+}
+
+/**
+ * Symmetric equilibria by discrete replicator dynamics
+ * (x_s <- x_s * u_s / mean u) from the centroid, near-vertex and random
+ * interior starts. Fixed points are de-duplicated and ranked by regret.
+ */
+function solveEquilibria(table, options = {}) {
+    const k = table.k;
+    const iterations = options.iterations || 5000;
+    const starts = options.starts || 20;
+    const random = createRandom(options.seed || 1);
+    const profiles = opponentProfiles(k);
+
+    const initial = [new Array(k).fill(1 / k)];
+    for (let s = 0; s < k; s++) {
+        initial.push(Array.from({ length: k }, (_, t) => (t === s ? 0.9 : 0.1 / (k - 1))));
+    }
+    while (initial.length < starts) {
+        const g = Array.from({ length: k }, () => -Math.log(1 - random()));
+        const total = g.reduce((a, b) => a + b, 0);
+        initial.push(g.map(v => v / total));
+    }
+
+    const found = [];
+    for (const start of initial) {
+        let x = start.slice();
+        for (let it = 0; it < iterations; it++) {
+            const { u, average } = expectedPayoffs(table, x, profiles);
+            if (average <= 0) break;
+            const next = x.map((xs, s) => xs * u[s] / average);
+            const moved = next.reduce((m, v, s) => Math.max(m, Math.abs(v - x[s])), 0);
+            x = next;
+            if (moved < 1e-10) break;
+        }
+        x = x.map(v => (v < 1e-4 ? 0 : v));
+        const total = x.reduce((a, b) => a + b, 0);
+        x = x.map(v => v / total);
+
+        if (found.some(f => f.mix.every((v, s) => Math.abs(v - x[s]) < 0.01))) continue;
+        const payoffs = expectedPayoffs(table, x, profiles);
+        found.push({ mix: x, ...payoffs, regret: Math.max(...payoffs.u) - payoffs.average });
+    }
+    return found.sort((a, b) => a.regret - b.regret);
+}
+
+/**
+ * Split `budget` games over lineups in proportion to how much their payoff
+ * SE feeds into u(mix), plus a uniform `explore` share. Counts are whole
+ * 4-game rotations.
+ * @returns {Map<string, number>} lineup key -> games
+ */
+function allocate(table, x, budget, explore = DEFAULTS.explore) {
+    const profiles = opponentProfiles(table.k);
+    const weights = new Map();
+    for (const [key, e] of table.entries) {
+        if (!e.lineup.every(s => s === e.lineup[0])) weights.set(key, 0);
+    }
+    for (const profile of profiles) {
+        const p = profileProbability(profile, x);
+        if (p === 0) continue;
+        for (let s = 0; s < table.k; s++) {
+            const lineup = withStrategy(profile.members, s);
+            const key = lineupKey(lineup);
+            if (weights.has(key)) weights.set(key, weights.get(key) + p * table.se(s, lineup));
+        }
+    }
+
+    const total = [...weights.values()].reduce((a, b) => a + b, 0);
+    const rotations = Math.floor(budget / PLAYERS);
+    const uniform = explore / weights.size;
+    const plan = new Map();
+    let assigned = 0;
+    const shares = [...weights.entries()].map(([key, w]) => {
+        const share = (1 - explore) * (total > 0 ? w / total : 1 / weights.size) + uniform;
+        const exact = share * rotations;
+        plan.set(key, Math.floor(exact));
+        assigned += Math.floor(exact);
+        return { key, remainder: exact - Math.floor(exact) };
+    });
+    shares.sort((a, b) => b.remainder - a.remainder);
+    for (let i = 0; assigned < rotations; i++, assigned++) {
+        plan.set(shares[i].key, plan.get(shares[i].key) + 1);
+    }
+    for (const [key, r] of plan) plan.set(key, r * PLAYERS);
+    return plan;
+}
+
+// =============================================================================
+// WORKER POOL
+// =============================================================================
+
+function workerMain() {
+    const { GameEngine } = require('./game-engine.js');
+    const runner = createRunner({ maxTurns: workerData.maxTurns });
+    const factories = quietly(() => workerData.strategies.map(name => {
+        if (NASH_VARIANTS[name]) return require('./nash-comparison.js')[NASH_VARIANTS[name]]();
+        return runner.createAIFactory(name);
+    }));
+
+    serveJobs('games', (msg) => {
+        const winners = [];
+        quietly(() => {
+            for (let j = msg.firstGame; j < msg.firstGame + msg.count; j++) {
+                const seats = seatOrder(msg.lineup, j);
+                const result = withSeed(deriveSeed(msg.seed, j), () => {
+                    const engine = new GameEngine({ maxTurns: workerData.maxTurns });
+                    engine.newGame(PLAYERS, seats.map(s => factories[s]));
+                    return engine.runGame();
+                });
+                winners.push(result.winner === null || result.winner === undefined ? -1 : seats[result.winner]);
+            }
+        });
+        return { winners };
+    });
+}
+
+/** Persistent pool; work is handed out one rotation (4 games) at a time */
+class GamePool {
+    constructor(strategies, options = {}) {
+        this.pool = new WorkerPool(__filename, {
+            workers: options.workers || DEFAULTS.workers,
+            workerData: { strategies, maxTurns: options.maxTurns || DEFAULTS.maxTurns }
+        });
+    }
+
+    start() {
+        return this.pool.start();
+    }
+
+    /** @returns {Promise<number[]>} winning strategy per game (-1 on timeout) */
+    play(lineup, seed, firstGame, count) {
+        const jobs = [];
+        for (let j = firstGame; j < firstGame + count; j += PLAYERS) {
+            jobs.push(this.pool.run({ type: 'games', lineup, seed, firstGame: j,
+                count: Math.min(PLAYERS, firstGame + count - j) }).then(msg => msg.winners));
+        }
+        return Promise.all(jobs).then(parts => parts.flat());
+    }
+
+    stop() {
+        return this.pool.close();
+    }
+}
+
+// =============================================================================
+// META-GAME
+// =============================================================================
+
+class MetaGame {
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS, ...options };
+        this.strategies = this.options.strategies;
+        this.table = new PayoffTable(this.strategies.length);
+        this.history = [];
+    }
+
+    /** Play `plan` (lineup key -> games) continuing each lineup's seed sequence */
+    async playPlan(pool, plan) {
+        const runs = [];
+        for (const [key, games] of plan) {
+            if (games <= 0) continue;
+            const entry = this.table.entries.get(key);
+            runs.push(pool.play(entry.lineup, this.options.seed, entry.games, games)
+                .then(winners => ({ lineup: entry.lineup, winners })));
+        }
+        // Record in plan order so results don't depend on worker timing
+        for (const { lineup, winners } of await Promise.all(runs)) {
+            for (const w of winners) this.table.record(lineup, w);
+        }
+    }
+
+    async run() {
+        const opts = this.options;
+        const initial = Math.ceil(opts.initialGames / PLAYERS) * PLAYERS;
+        const pool = new GamePool(this.strategies, opts);
+        await pool.start();
+        try {
+            const plan = new Map([...this.table.entries.values()]
+                .map(e => [lineupKey(e.lineup), e.lineup.every(s => s === e.lineup[0]) ? 0 : initial]));
+            await this.playPlan(pool, plan);
+            this.record('initial');
+
+            for (let round = 1; round <= opts.rounds; round++) {
+                const [best] = solveEquilibria(this.table, { seed: opts.seed });
+                await this.playPlan(pool, allocate(this.table, best.mix, opts.roundGames, opts.explore));
+                this.record(`round ${round}`);
+            }
+        } finally {
+            await pool.stop();
+        }
+        this.equilibria = solveEquilibria(this.table, { seed: opts.seed });
+        return this.equilibria;
+    }
+
+    record(label) {
+        const [best] = solveEquilibria(this.table, { seed: this.options.seed });
+        const entry = { label, games: this.table.totalGames, mix: best.mix, regret: best.regret,
+            maxSE: Math.max(...best.se) };
+        this.history.push(entry);
+        if (this.options.onRound) this.options.onRound(entry);
+    }
+
+    printReport() {
+        const names = this.strategies;
+        const pad = Math.max(...names.map(n => n.length)) + 2;
+
+        console.log('\nPayoff tensor (per-player win share; 0.25 = neutral):');
+        for (const e of this.table.entries.values()) {
+            const cells = e.lineup.filter((s, i) => e.lineup.indexOf(s) === i).map(s =>
+                `${names[s]} ${this.table.mean(s, e.lineup).toFixed(3)}+/-${this.table.se(s, e.lineup).toFixed(3)}`);
+            console.log(`  [${e.lineup.map(s => names[s]).join(', ')}]`.padEnd(pad * 4 + 4) +
+                `${String(e.games).padStart(5)} games  ${cells.join('  ')}`);
+        }
+
+        console.log('\nSymmetric equilibria (replicator fixed points, best first):');
+        for (const eq of this.equilibria) {
+            const support = eq.mix.map((v, s) => (v > 0 ? `${names[s]} ${(v * 100).toFixed(1)}%` : null))
+                .filter(Boolean).join(', ');
+            const se = Math.max(...eq.se);
+            const tag = eq.regret <= 2 * se ? 'Nash (within noise)' : 'not Nash';
+            console.log(`  ${support}`);
+            console.log(`    regret ${eq.regret.toFixed(4)} (payoff SE ${se.toFixed(4)}) - ${tag}`);
+        }
+
+        const [best] = this.equilibria;
+        console.log('\nPayoff of each AI against 3 opponents drawn from the equilibrium mix:');
+        best.u.map((u, s) => ({ s, u, se: best.se[s] })).sort((a, b) => b.u - a.u).forEach(r => {
+            console.log(`  ${names[r.s].padEnd(pad)} ${(r.u * 100).toFixed(1).padStart(5)}% +/- ${(r.se * 196).toFixed(1)}% (95% CI)`);
+        });
+
+        const uniform = expectedPayoffs(this.table, new Array(names.length).fill(1 / names.length));
+        console.log('\nPayoff against a uniform mix:');
+        uniform.u.map((u, s) => ({ s, u, se: uniform.se[s] })).sort((a, b) => b.u - a.u).forEach(r => {
+            console.log(`  ${names[r.s].padEnd(pad)} ${(r.u * 100).toFixed(1).padStart(5)}% +/- ${(r.se * 196).toFixed(1)}% (95% CI)`);
+        });
+    }
+
+    toJSON() {
+        return {
+            strategies: this.strategies,
+            options: { ...this.options, onRound: undefined },
+            games: this.table.totalGames,
+            payoffs: this.table.toJSON(),
+            equilibria: this.equilibria,
+            history: this.history
+        };
+    }
+}
+
+module.exports = {
+    enumerateLineups,
+    opponentProfiles,
+    seatOrder,
+    PayoffTable,
+    expectedPayoffs,
+    regret,
+    solveEquilibria,
+    allocate,
+    GamePool,
+    MetaGame,
+    NASH_VARIANTS,
+    DEFAULTS
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+async function main() {
+    const args = process.argv.slice(2);
+    const options = {};
+    let json = null;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--strategies': options.strategies = args[++i].split(','); break;
+            case '--initial': options.initialGames = parseInt(args[++i], 10); break;
+            case '--rounds': options.rounds = parseInt(args[++i], 10); break;
+            case '--round-games': options.roundGames = parseInt(args[++i], 10); break;
+            case '--workers': options.workers = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--max-turns': options.maxTurns = parseInt(args[++i], 10); break;
+            case '--json': json = args[++i]; break;
+        }
+    }
+
+    const start = Date.now();
+    const meta = new MetaGame({
+        ...options,
+        onRound: (h) => console.log(`  ${h.label.padEnd(10)} ${String(h.games).padStart(6)} games  ` +
+            `regret ${h.regret.toFixed(4)}  max SE ${h.maxSE.toFixed(4)}  ` +
+            `mix [${h.mix.map(v => v.toFixed(2)).join(', ')}]`)
+    });
+    const opts = meta.options;
+
+    console.log('='.repeat(70));
+    console.log('EMPIRICAL META-GAME');
+    console.log('='.repeat(70));
+    console.log(`Strategies: ${opts.strategies.join(', ')} (${meta.table.entries.size} lineups)`);
+    console.log(`Initial ${opts.initialGames} games per lineup, then ${opts.rounds} adaptive rounds of ` +
+        `${opts.roundGames}; ${opts.workers} workers\n`);
+
+    await meta.run();
+    meta.printReport();
+
+    const seconds = (Date.now() - start) / 1000;
+    console.log(`\n${meta.table.totalGames} games in ${seconds.toFixed(1)}s`);
+
+    if (json) {
+        fs.mkdirSync(path.dirname(path.resolve(json)), { recursive: true });
+        fs.writeFileSync(json, JSON.stringify(meta.toJSON(), null, 2));
+        console.log(`Results written to ${json}`);
+    }
+}
+
+if (!isMainThread) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
@@ -0,0 +1,487 @@
+/**
+ * Microbenchmark Suite
+ *
+ * Google-Benchmark-style timing of the simulator's hot kernels:
+ * dice, one Monte Carlo turn (the JS counterpart of do_calculation()
+ * in source-material/c/mon_sim.c), card resolution, Markov solve,
+ * EPT table build, rent lookup, state clone / packed view sync /
+ * make-unmake, trade evaluation and a full game.
+ *
+ * Each benchmark is calibrated to run for at least --min-time seconds,
+ * repeated --repetitions times, and reported as ns/op with mean,
+ * median and stddev aggregates. Results can be written as JSON in the
+ * same shape Google Benchmark emits, and compared against a stored
+ * baseline with benchmark-compare.js.
+ *
+ * Usage:
+ *   node microbenchmark.js                         # print table
+ *   node microbenchmark.js --json out.json         # also write JSON
+ *   node microbenchmark.js --filter rent           # regex filter
+ *   node microbenchmark.js --save-baseline         # refresh stored baseline
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const { GameEngine, GameState, COLOR_GROUPS } = require('./game-engine.js');
+const { withSeed, createRandom } = require('./seeded-random.js');
+
+const { MarkovEngine } = require('../../ai/markov-engine.js');
+const PropertyValuator = require('../../ai/property-valuator.js');
+const MonteCarloSim = require('../../ai/monte-carlo-sim.js');
+const { quietly, createRunner } = require('./harness.js');
+
+const RESULTS_DIR = path.join(__dirname, 'benchmark-results');
+const BASELINE_FILE = path.join(RESULTS_DIR, 'baseline.json');
+
+// README lineup, used for the full-game benchmark
+const README_LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+// Results are folded into this so the JIT cannot discard benchmark bodies
+let blackhole = 0;
+
+/**
+ * Run fn with console.log silenced (Markov/valuator initialization is chatty)
+ */
+// =============================================================================
+// FIXTURES
+// =============================================================================
+
+/**
+ * Shared, lazily-built fixtures. Building them is not part of any measurement.
+ */
+class Fixtures {
+    constructor() {
+        this._runner = null;
+        this._midGame = null;
+    }
+
+    get runner() {
+        if (!this._runner) this._runner = createRunner({ maxTurns: 500 });
+        return this._runner;
+    }
+
+    get markovEngine() {
+        return this.runner.markovEngine;
+    }
+
+    get valuator() {
+        return this.runner.valuator;
+    }
+
+    /**
+     * A reproducible mid-game position: README lineup, 40 rounds in.
+     */
+    get midGame() {
+        if (!this._midGame) {
+            const runner = this.runner;
+            this._midGame = withSeed(20240601, () => {
+                const engine = new GameEngine({ maxTurns: 500 });
+                engine.newGame(4, README_LINEUP.map(t => runner.createAIFactory(t)));
+                while (!engine.state.isGameOver() && engine.state.turn < 40) {
+                    engine.executeTurn();
+                }
+                return engine;
+            });
+        }
+        return this._midGame;
+    }
+}
+
+// =============================================================================
+// BENCHMARK DEFINITIONS
+// =============================================================================
+
+/**
+ * Each entry's setup(fixtures) returns the function to time. Setup runs
+ * once per benchmark and is not measured.
+ */
+const BENCHMARKS = [
+    {
+        name: 'dice/rollDice',
+        setup() {
+            const engine = new GameEngine();
+            return () => { blackhole += engine.rollDice().sum; };
+        }
+    },
+    {
+        name: 'movement/simulateTurn',
+        setup() {
+            let pos = 0, inJail = false, jailTurns = 0;
+            return () => {
+                const r = MonteCarloSim.simulateTurn(pos, inJail, jailTurns, 'stay');
+                pos = r.finalPos;
+                inJail = r.inJail;
+                jailTurns = r.jailTurns;
+                blackhole += pos;
+            };
+        }
+    },
+    {
+        name: 'cards/drawChance',
+        setup() {
+            const engine = new GameEngine();
+            engine.newGame(4);
+            engine.log = () => {};
+            const player = engine.state.players[0];
+            return () => {
+                player.position = 7;
+                player.money = 1500;
+                player.inJail = false;
+                engine.drawChance(player, 7);
+                blackhole += player.position;
+            };
+        }
+    },
+    {
+        name: 'cards/drawCommunityChest',
+        setup() {
+            const engine = new GameEngine();
+            engine.newGame(4);
+            engine.log = () => {};
+            const player = engine.state.players[0];
+            return () => {
+                player.position = 17;
+                player.money = 1500;
+                player.inJail = false;
+                engine.drawCommunityChest(player, 17);
+                blackhole += player.position;
+            };
+        }
+    },
+    {
+        name: 'markov/solve',
+        setup() {
+            return () => quietly(() => {
+                const markov = new MarkovEngine();
+                markov.initialize();
+                blackhole += markov.getLandingProbability(24);
+            });
+        }
+    },
+    {
+        name: 'ept/generateTables',
+        setup(fixtures) {
+            const probs = fixtures.markovEngine.getAllProbabilities('stay');
+            return () => {
+                const tables = PropertyValuator.generateEPTTables(probs);
+                blackhole += tables.properties[19].ept.house3;
+            };
+        }
+    },
+    {
+        name: 'rent/calculateRent',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            const owned = Object.keys(engine.state.propertyStates)
+                .map(Number)
+                .filter(sq => engine.state.propertyStates[sq].owner !== null);
+            let i = 0;
+            return () => {
+                blackhole += engine.calculateRent(owned[i++ % owned.length], 7);
+            };
+        }
+    },
+    {
+        name: 'rent/flowUpdate',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            const flow = engine.getRentFlow(fixtures.markovEngine.getAllProbabilities('stay'));
+            let sq = 0;
+            return () => {
+                flow.update(5 + 10 * (sq++ & 3));
+                blackhole += flow.netDrift(0);
+            };
+        }
+    },
+    {
+        name: 'state/clone',
+        setup(fixtures) {
+            const state = fixtures.midGame.state;
+            return () => { blackhole += state.clone().turn; };
+        }
+    },
+    {
+        name: 'state/syncView',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            return () => { blackhole += engine.getStateView().turn; };
+        }
+    },
+    {
+        name: 'state/makeUnmake',
+        setup(fixtures) {
+            const { MoveStack } = require('./move-stack.js');
+            const stack = new MoveStack(fixtures.midGame);
+            let roll = 0;
+            return () => {
+                const d = roll++ % 6;
+                blackhole += stack.makeRoll(1 + d, 6 - (d >> 1)).position;
+                stack.makeEndTurn();
+                stack.unmake();
+                stack.unmake();
+            };
+        }
+    },
+    {
+        name: 'ept/relativeFull',
+        setup(fixtures) {
+            const state = fixtures.midGame.state;
+            const ai = fixtures.runner.createAIFactory('relative')(state.players[0], null);
+            return () => { blackhole += ai.calculateRelativeEPTs(state).size; };
+        }
+    },
+    {
+        name: 'ept/relativeTracked',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            const ai = fixtures.runner.createAIFactory('relative')(engine.state.players[0], engine);
+            return () => { blackhole += ai.calculateRelativeEPTs(engine.state).size; };
+        }
+    },
+    {
+        name: 'growth/bilateral',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            const state = engine.state;
+            const ai = fixtures.runner.createAIFactory('relative')(state.players[0], engine);
+            const groups = Object.keys(COLOR_GROUPS);
+            const me = { groups: groups.slice(3, 5), cash: 900, id: 0 };
+            const them = { groups: groups.slice(5, 7), cash: 700, id: 1 };
+            return () => {
+                blackhole += ai.simulateBilateralGrowth(me, them, state.propertyStates, 2).myTrajectory[62];
+            };
+        }
+    },
+    {
+        name: 'trade/evaluateTrade',
+        setup(fixtures) {
+            const engine = fixtures.midGame;
+            const state = engine.state;
+            const [me, other] = state.getActivePlayers();
+            const ai = fixtures.runner.createAIFactory('strategic')(me, engine);
+            const theirs = [...other.properties].filter(sq => state.propertyStates[sq].houses === 0);
+            const mine = [...me.properties].filter(sq => state.propertyStates[sq].houses === 0);
+            const offer = {
+                from: other,
+                to: me,
+                fromProperties: new Set(theirs.slice(0, 1)),
+                toProperties: new Set(mine.slice(0, 1)),
+                fromCash: 100
+            };
+            return () => { blackhole += ai.evaluateTrade(offer, state) ? 1 : 0; };
+        }
+    },
+    {
+        name: 'game/fullGame',
+        setup(fixtures) {
+            const runner = fixtures.runner;
+            let seed = 1;
+            return () => {
+                const result = withSeed(seed++, () => runner.runSingleGame(README_LINEUP));
+                blackhole += result.turns;
+            };
+        }
+    }
+];
+
+// =============================================================================
+// RUNNER
+// =============================================================================
+
+class MicroBenchmark {
+    constructor(options = {}) {
+        this.options = {
+            minTime: options.minTime || 0.5,        // seconds per repetition
+            repetitions: options.repetitions || 3,
+            maxIterations: options.maxIterations || 1e9,
+            filter: options.filter || null,
+            seed: options.seed || 12345,
+            ...options
+        };
+        this.fixtures = new Fixtures();
+    }
+
+    /**
+     * Time `iterations` calls of fn. Returns wall and CPU time in ns.
+     */
+    measure(fn, iterations) {
+        const cpuStart = process.cpuUsage();
+        const start = process.hrtime.bigint();
+        for (let i = 0; i < iterations; i++) fn();
+        const realNs = Number(process.hrtime.bigint() - start);
+        const cpu = process.cpuUsage(cpuStart);
+        return { realNs, cpuNs: (cpu.user + cpu.system) * 1000 };
+    }
+
+    /**
+     * Grow the iteration count until one batch takes at least minTime,
+     * the same calibration strategy Google Benchmark uses.
+     */
+    calibrate(fn) {
+        const minNs = this.options.minTime * 1e9;
+        let iterations = 1;
+
+        while (true) {
+            const { realNs } = this.measure(fn, iterations);
+            if (realNs >= minNs || iterations >= this.options.maxIterations) {
+                return iterations;
+            }
+            // Predict the count needed, overshoot slightly, never grow > 10x
+            const multiplier = realNs > 0 ? Math.min(10, (minNs * 1.4) / realNs) : 10;
+            iterations = Math.min(this.options.maxIterations,
+                Math.max(iterations + 1, Math.ceil(iterations * multiplier)));
+        }
+    }
+
+    /**
+     * Run one benchmark: calibrate, then time each repetition
+     */
+    runBenchmark(bench) {
+        const fn = withSeed(this.options.seed, () => bench.setup(this.fixtures));
+
+        return withSeed(this.options.seed, () => {
+            const iterations = this.calibrate(fn);
+            const runs = [];
+
+            for (let r = 0; r < this.options.repetitions; r++) {
+                const { realNs, cpuNs } = this.measure(fn, iterations);
+                runs.push({
+                    name: bench.name,
+                    run_name: bench.name,
+                    run_type: 'iteration',
+                    repetitions: this.options.repetitions,
+                    repetition_index: r,
+                    iterations,
+                    real_time: realNs / iterations,
+                    cpu_time: cpuNs / iterations,
+                    time_unit: 'ns'
+                });
+            }
+
+            return runs.concat(this.aggregate(bench.name, runs));
+        });
+    }
+
+    /**
+     * Mean / median / stddev rows, named the way Google Benchmark names them
+     */
+    aggregate(name, runs) {
+        const stats = (key) => {
+            const values = runs.map(r => r[key]).sort((a, b) => a - b);
+            const mean = values.reduce((a, b) => a + b, 0) / values.length;
+            const median = values[Math.floor(values.length / 2)];
+            const variance = values.length > 1
+                ? values.reduce((s, v) => s + (v - mean) ** 2, 0) / (values.length - 1)
+                : 0;
+            return { mean, median, stddev: Math.sqrt(variance) };
+        };
+
+        const real = stats('real_time');
+        const cpu = stats('cpu_time');
+
+        return ['mean', 'median', 'stddev'].map(agg => ({
+            name: `${name}_${agg}`,
+            run_name: name,
+            run_type: 'aggregate',
+            aggregate_name: agg,
+            repetitions: runs.length,
+            iterations: runs.length,
+            real_time: real[agg],
+            cpu_time: cpu[agg],
+            time_unit: 'ns'
+        }));
+    }
+
+    /**
+     * Run all (filtered) benchmarks and return a Google-Benchmark-shaped report
+     */
+    run() {
+        const filter = this.options.filter ? new RegExp(this.options.filter) : null;
+        const selected = BENCHMARKS.filter(b => !filter || filter.test(b.name));
+
+        const report = {
+            context: {
+                date: new Date().toISOString(),
+                host_name: os.hostname(),
+                executable: `node ${process.version}`,
+                num_cpus: os.cpus().length,
+                mhz_per_cpu: os.cpus()[0] ? os.cpus()[0].speed : 0,
+                min_time: this.options.minTime,
+                seed: this.options.seed
+            },
+            benchmarks: []
+        };
+
+        for (const bench of selected) {
+            const rows = this.runBenchmark(bench);
+            report.benchmarks.push(...rows);
+            const median = rows.find(r => r.aggregate_name === 'median');
+            console.log(`  ${bench.name.padEnd(28)} ${formatNs(median.real_time).padStart(12)}  ` +
+                `${formatNs(median.cpu_time).padStart(12)}  ${String(rows[0].iterations).padStart(10)}`);
+        }
+
+        report.context.blackhole = blackhole !== 0;
+        return report;
+    }
+}
+
+/**
+ * Human-friendly duration
+ */
+function formatNs(ns) {
+    if (ns >= 1e9) return (ns / 1e9).toFixed(2) + ' s';
+    if (ns >= 1e6) return (ns / 1e6).toFixed(2) + ' ms';
+    if (ns >= 1e3) return (ns / 1e3).toFixed(2) + ' us';
+    return ns.toFixed(1) + ' ns';
+}
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+function parseArgs(argv) {
+    const args = { minTime: 0.5, repetitions: 3 };
+    for (let i = 0; i < argv.length; i++) {
+        switch (argv[i]) {
+            case '--json': args.json = argv[++i]; break;
+            case '--filter': args.filter = argv[++i]; break;
+            case '--min-time': args.minTime = parseFloat(argv[++i]); break;
+            case '--repetitions': args.repetitions = parseInt(argv[++i], 10); break;
+            case '--seed': args.seed = parseInt(argv[++i], 10); break;
+            case '--save-baseline': args.saveBaseline = true; break;
+        }
+    }
+    return args;
+}
+
+function main() {
+    const args = parseArgs(process.argv.slice(2));
+
+    console.log('Monopoly Simulator Microbenchmarks');
+    console.log('='.repeat(70));
+    console.log(`  ${'Benchmark'.padEnd(28)} ${'Time'.padStart(12)}  ${'CPU'.padStart(12)}  ${'Iterations'.padStart(10)}`);
+    console.log('-'.repeat(70));
+
+    const bench = new MicroBenchmark(args);
+    const report = bench.run();
+
+    const outputs = [];
+    if (args.json) outputs.push(args.json);
+    if (args.saveBaseline) outputs.push(BASELINE_FILE);
+
+    for (const file of outputs) {
+        fs.mkdirSync(path.dirname(path.resolve(file)), { recursive: true });
+        fs.writeFileSync(file, JSON.stringify(report, null, 2));
+        console.log(`\nResults written to ${file}`);
+    }
+}
+
+module.exports = { MicroBenchmark, BENCHMARKS, BASELINE_FILE, formatNs };
+
+if (require.main === module) {
+    main();
+}
@@ -0,0 +1,664 @@
+/**
+ * Make/Unmake Move Stack
+ *
+ * Lookahead without copying state. Each make*() applies one action to the
+ * engine's live GameState and pushes a frame. unmake() pops the last
+ * frame and restores exactly what that action changed. Search code can
+ * walk a tree depth-first on one state:
+ *
+ *   const stack = new MoveStack(engine);
+ *   stack.makeRoll(3, 4);
+ *   if (stack.landing.unowned) { stack.makeBuy(sq); ...; stack.unmake(); }
+ *   stack.unmake();
+ *
+ * UNDO RECORDS
+ *   Before a field is written, its old value goes onto a trail of
+ *   (kind, index, old value, extra) float64 entries, so fractional
+ *   balances come back exactly. unmake() replays the
+ *   frame's entries in reverse. An ownership change also records where the
+ *   square sat in the old owner's property Set, so Set iteration order is
+ *   restored too. Property writes, forward or undone, are reported through
+ *   engine.propertyChanged(), which keeps the EPT tracker, rent flow and
+ *   board version in step.
+ *
+ * ACTIONS
+ *   Build, sell, mortgage, unmortgage and end-of-turn delegate to the
+ *   engine's own rule methods after saving the fields those methods touch.
+ *   Rolls, purchases, trades and cards are applied here as the engine
+ *   would apply them, minus the AI callbacks and log lines: a roll lands
+ *   and pays rent or tax but never buys or auctions, and a Chance or
+ *   Community Chest square waits for makeCard(). Payments never trigger
+ *   raiseCash or bankruptcy; money may go negative and the search scores
+ *   it.
+ *
+ * DEBUG
+ *   With { debug: true }, every make() fingerprints the state and the
+ *   matching unmake() throws if the state differs afterwards, then checks
+ *   ownership/Set and house-bank invariants.
+ *
+ * Usage:
+ *   node move-stack.js --nodes 200000   # make/unmake vs clone() throughput
+ */
+
+'use strict';
+
+const { BOARD, SQUARE_TYPES } = require('./game-engine.js');
+
+const BOARD_SIZE = 40;
+const JAIL_POSITION = 10;
+const GO_SALARY = 200;
+const BAIL = 50;
+const PHASES = ['early', 'mid', 'late'];
+
+// Trail entry kinds
+const MONEY = 0;
+const POSITION = 1;
+const IN_JAIL = 2;
+const JAIL_TURNS = 3;
+const JAIL_CARDS = 4;
+const OWNER = 5;
+const HOUSES = 6;
+const MORTGAGED = 7;
+const HOUSES_AVAILABLE = 8;
+const HOTELS_AVAILABLE = 9;
+const CURRENT = 10;
+const TURN = 11;
+const PHASE = 12;
+const STAT_TOTAL_TURNS = 13;
+const STAT_HOUSES_BOUGHT = 14;
+const STAT_PROPERTIES_BOUGHT = 15;
+
+const ENTRY = 4;
+
+class MoveStack {
+    /**
+     * @param {GameEngine} engine - the live state is engine.state
+     * @param {Object} options - { debug: verify every unmake }
+     */
+    constructor(engine, options = {}) {
+        this.engine = engine;
+        this.debug = options.debug || false;
+
+        this.trail = new Float64Array(1024 * ENTRY);
+        this.top = 0;                            // next free slot in trail
+        this.frames = new Int32Array(256 * 2);   // (trail top, event log length)
+        this.depth = 0;
+        this.fingerprints = [];
+
+        // Outcome of the last makeRoll()/makeCard() landing
+        this.landing = null;
+    }
+
+    get state() {
+        return this.engine.state;
+    }
+
+    // =========================================================================
+    // TRAIL
+    // =========================================================================
+
+    read(kind, index) {
+        const state = this.engine.state;
+        switch (kind) {
+            case MONEY: return state.players[index].money;
+            case POSITION: return state.players[index].position;
+            case IN_JAIL: return state.players[index].inJail ? 1 : 0;
+            case JAIL_TURNS: return state.players[index].jailTurns;
+            case JAIL_CARDS: return state.players[index].getOutOfJailCards;
+            case OWNER: {
+                const owner = state.propertyStates[index].owner;
+                return owner === null ? -1 : owner;
+            }
+            case HOUSES: return state.propertyStates[index].houses;
+            case MORTGAGED: return state.propertyStates[index].mortgaged ? 1 : 0;
+            case HOUSES_AVAILABLE: return state.housesAvailable;
+            case HOTELS_AVAILABLE: return state.hotelsAvailable;
+            case CURRENT: return state.currentPlayerIndex;
+            case TURN: return state.turn;
+            case PHASE: return PHASES.indexOf(state.phase);
+            case STAT_TOTAL_TURNS: return state.stats.totalTurns;
+            case STAT_HOUSES_BOUGHT: return state.stats.housesBought[index];
+            case STAT_PROPERTIES_BOUGHT: return state.stats.propertiesBought[index];
+        }
+        throw new Error(`Unknown trail kind ${kind}`);
+    }
+
+    restore(kind, index, value, extra) {
+        const state = this.engine.state;
+        switch (kind) {
+            case MONEY: state.players[index].money = value; return;
+            case POSITION: state.players[index].position = value; return;
+            case IN_JAIL: state.players[index].inJail = value === 1; return;
+            case JAIL_TURNS: state.players[index].jailTurns = value; return;
+            case JAIL_CARDS: state.players[index].getOutOfJailCards = value; return;
+            case OWNER: this.restoreOwner(index, value, extra); return;
+            case HOUSES: state.propertyStates[index].houses = value; break;
+            case MORTGAGED: state.propertyStates[index].mortgaged = value === 1; break;
+            case HOUSES_AVAILABLE: state.housesAvailable = value; return;
+            case HOTELS_AVAILABLE: state.hotelsAvailable = value; return;
+            case CURRENT: state.currentPlayerIndex = value; return;
+            case TURN: state.turn = value; return;
+            case PHASE: state.phase = PHASES[value]; return;
+            case STAT_TOTAL_TURNS: state.stats.totalTurns = value; return;
+            case STAT_HOUSES_BOUGHT: state.stats.housesBought[index] = value; return;
+            case STAT_PROPERTIES_BOUGHT: state.stats.propertiesBought[index] = value; return;
+        }
+        this.engine.propertyChanged(index);
+    }
+
+    /** Push the current value of a field onto the trail */
+    save(kind, index = 0, extra = 0) {
+        if (this.top + ENTRY > this.trail.length) {
+            const grown = new Float64Array(this.trail.length * 2);
+            grown.set(this.trail);
+            this.trail = grown;
+        }
+        const t = this.trail;
+        t[this.top] = kind;
+        t[this.top + 1] = index;
+        t[this.top + 2] = this.read(kind, index);
+        t[this.top + 3] = extra;
+        this.top += ENTRY;
+    }
+
+    /** Save, then add `amount` to a player's money */
+    addMoney(playerId, amount) {
+        if (amount === 0) return;
+        this.save(MONEY, playerId);
+        this.engine.state.players[playerId].money += amount;
+    }
+
+    /** Save ownership (with Set position), then move a square to a new owner */
+    setOwner(position, owner) {
+        const state = this.engine.state;
+        const propState = state.propertyStates[position];
+        const old = propState.owner;
+
+        let slot = -1;
+        if (old !== null) {
+            slot = 0;
+            for (const sq of state.players[old].properties) {
+                if (sq === position) break;
+                slot++;
+            }
+        }
+        this.save(OWNER, position, slot);
+
+        if (old !== null) state.players[old].properties.delete(position);
+        propState.owner = owner;
+        if (owner !== null) state.players[owner].properties.add(position);
+        this.engine.propertyChanged(position);
+    }
+
+    restoreOwner(position, old, slot) {
+        const state = this.engine.state;
+        const propState = state.propertyStates[position];
+        if (propState.owner !== null) state.players[propState.owner].properties.delete(position);
+
+        if (old >= 0) {
+            const props = state.players[old].properties;
+            if (slot >= props.size) {
+                props.add(position);
+            } else {
+                const order = [...props];
+                order.splice(slot, 0, position);
+                props.clear();
+                for (const sq of order) props.add(sq);
+            }
+        }
+        propState.owner = old >= 0 ? old : null;
+        this.engine.propertyChanged(position);
+    }
+
+    // =========================================================================
+    // FRAMES
+    // =========================================================================
+
+    begin() {
+        if ((this.depth + 1) * 2 > this.frames.length) {
+            const grown = new Int32Array(this.frames.length * 2);
+            grown.set(this.frames);
+            this.frames = grown;
+        }
+        this.frames[this.depth * 2] = this.top;
+        this.frames[this.depth * 2 + 1] = this.engine.eventLog.length;
+        if (this.debug) this.fingerprints[this.depth] = fingerprint(this.engine);
+        this.depth++;
+    }
+
+    /** Undo the most recent action */
+    unmake() {
+        if (this.depth === 0) throw new Error('unmake() with an empty move stack');
+        this.depth--;
+        const base = this.frames[this.depth * 2];
+        const t = this.trail;
+        for (let at = this.top - ENTRY; at >= base; at -= ENTRY) {
+            this.restore(t[at], t[at + 1], t[at + 2], t[at + 3]);
+        }
+        this.top = base;
+        this.engine.eventLog.length = this.frames[this.depth * 2 + 1];
+        this.landing = null;
+
+        if (this.debug) {
+            const expected = this.fingerprints[this.depth];
+            const actual = fingerprint(this.engine);
+            if (actual !== expected) {
+                throw new Error(`MoveStack: state differs after unmake at depth ${this.depth}\n` +
+                    `  expected ${expected}\n  actual   ${actual}`);
+            }
+            checkConsistency(this.engine.state);
+        }
+    }
+
+    /** Undo everything back to `depth` */
+    unmakeTo(depth = 0) {
+        while (this.depth > depth) this.unmake();
+    }
+
+    // =========================================================================
+    // ACTIONS
+    // =========================================================================
+
+    /**
+     * Current player rolls d1 + d2: jail rules, movement, GO salary, then
+     * rent, tax or Go To Jail on the landing square.
+     * this.landing describes where the player ended up.
+     */
+    makeRoll(d1, d2) {
+        this.begin();
+        const state = this.engine.state;
+        const player = state.getCurrentPlayer();
+        const sum = d1 + d2;
+        const doubles = d1 === d2;
+
+        if (player.inJail) {
+            if (!doubles && player.jailTurns < 2) {
+                this.save(JAIL_TURNS, player.id);
+                player.jailTurns++;
+                this.landing = { position: player.position, stayed: true };
+                return this.landing;
+            }
+            if (!doubles) this.addMoney(player.id, -BAIL);
+            this.save(IN_JAIL, player.id);
+            this.save(JAIL_TURNS, player.id);
+            player.inJail = false;
+            player.jailTurns = 0;
+        }
+
+        const from = player.position;
+        const to = (from + sum) % BOARD_SIZE;
+        this.save(POSITION, player.id);
+        player.position = to;
+        if (to < from && to !== JAIL_POSITION) this.addMoney(player.id, GO_SALARY);
+
+        this.landing = this.land(player, to, sum);
+        this.landing.doubles = doubles;
+        return this.landing;
+    }
+
+    /** Landing effects that need no decision */
+    land(player, position, diceRoll) {
+        const square = BOARD[position];
+        const landing = { position, rent: 0, owner: null, unowned: false, card: null };
+
+        switch (square.type) {
+            case SQUARE_TYPES.PROPERTY:
+            case SQUARE_TYPES.RAILROAD:
+            case SQUARE_TYPES.UTILITY: {
+                const propState = this.engine.state.propertyStates[position];
+                if (propState.owner === null) {
+                    landing.unowned = true;
+                } else if (propState.owner !== player.id && !propState.mortgaged) {
+                    const rent = this.engine.calculateRent(position, diceRoll);
+                    this.addMoney(player.id, -rent);
+                    this.addMoney(propState.owner, rent);
+                    landing.rent = rent;
+                    landing.owner = propState.owner;
+                }
+                break;
+            }
+            case SQUARE_TYPES.TAX:
+                this.addMoney(player.id, -square.amount);
+                break;
+            case SQUARE_TYPES.CHANCE:
+                landing.card = 'chance';
+                break;
+            case SQUARE_TYPES.COMMUNITY_CHEST:
+                landing.card = 'communityChest';
+                break;
+            case SQUARE_TYPES.GO_TO_JAIL:
+                this.jail(player);
+                landing.position = JAIL_POSITION;
+                landing.jailed = true;
+                break;
+        }
+        return landing;
+    }
+
+    jail(player) {
+        this.save(POSITION, player.id);
+        this.save(IN_JAIL, player.id);
+        this.save(JAIL_TURNS, player.id);
+        player.position = JAIL_POSITION;
+        player.inJail = true;
+        player.jailTurns = 0;
+    }
+
+    /** Current player is sent to jail (e.g. third doubles) */
+    makeGoToJail() {
+        this.begin();
+        this.jail(this.engine.state.getCurrentPlayer());
+    }
+
+    /** Current player pays $50 (or uses a card) to leave jail before rolling */
+    makePayBail(useCard = false) {
+        this.begin();
+        const player = this.engine.state.getCurrentPlayer();
+        if (useCard) {
+            this.save(JAIL_CARDS, player.id);
+            player.getOutOfJailCards--;
+        } else {
+            this.addMoney(player.id, -BAIL);
+        }
+        this.save(IN_JAIL, player.id);
+        this.save(JAIL_TURNS, player.id);
+        player.inJail = false;
+        player.jailTurns = 0;
+    }
+
+    /**
+     * Resolve card `card` (0-15, numbered as in GameEngine.drawChance /
+     * drawCommunityChest) for the current player. `diceRoll` is only used
+     * by the nearest-utility card (10x dice).
+     */
+    makeCard(deck, card, diceRoll = 7) {
+        this.begin();
+        const state = this.engine.state;
+        const player = state.getCurrentPlayer();
+        const from = player.position;
+        this.landing = { position: from, rent: 0, owner: null, unowned: false, card: null };
+
+        const advance = (to, collectGo) => {
+            if (collectGo) this.addMoney(player.id, GO_SALARY);
+            this.save(POSITION, player.id);
+            player.position = to;
+            this.landing = this.land(player, to, 7);
+        };
+        const payEach = (amount) => {
+            for (const other of state.getActivePlayers()) {
+                if (other.id === player.id) continue;
+                this.addMoney(player.id, -amount);
+                this.addMoney(other.id, amount);
+            }
+        };
+        const repairs = (perHouse, perHotel) => {
+            let cost = 0;
+            for (const sq of player.properties) {
+                const houses = state.propertyStates[sq].houses;
+                cost += houses === 5 ? perHotel : houses * perHouse;
+            }
+            this.addMoney(player.id, -cost);
+        };
+
+        if (deck === 'chance') {
+            switch (card) {
+                case 0: advance(39, false); break;
+                case 1: this.save(POSITION, player.id); player.position = 0; this.addMoney(player.id, GO_SALARY); break;
+                case 2: advance(24, from > 24); break;
+                case 3: advance(11, from > 11); break;
+                case 4: advance(5, from > 5); break;
+                case 5: this.jail(player); this.landing.jailed = true; break;
+                case 6:
+                case 7: {
+                    const rr = this.engine.nearestRailroad(from);
+                    advance(rr, rr < from);
+                    break;
+                }
+                case 8: {
+                    const util = this.engine.nearestUtility(from);
+                    if (util < from) this.addMoney(player.id, GO_SALARY);
+                    this.save(POSITION, player.id);
+                    player.position = util;
+                    const propState = state.propertyStates[util];
+                    this.landing = { position: util, rent: 0, owner: null, unowned: propState.owner === null, card: null };
+                    if (propState.owner !== null && propState.owner !== player.id) {
+                        const rent = 10 * diceRoll;
+                        this.addMoney(player.id, -rent);
+                        this.addMoney(propState.owner, rent);
+                        this.landing.rent = rent;
+                        this.landing.owner = propState.owner;
+                    }
+                    break;
+                }
+                case 9: advance((from - 3 + BOARD_SIZE) % BOARD_SIZE, false); break;
+                case 10: this.addMoney(player.id, 50); break;
+                case 11: this.save(JAIL_CARDS, player.id); player.getOutOfJailCards++; break;
+                case 12: this.addMoney(player.id, -15); break;
+                case 13: payEach(50); break;
+                case 14: this.addMoney(player.id, 150); break;
+                case 15: repairs(25, 100); break;
+            }
+        } else {
+            const money = [0, 0, 200, -50, 50, 0, 100, 20, 0, 100, -100, -50, 25, 0, 10, 100];
+            switch (card) {
+                case 0: this.save(POSITION, player.id); player.position = 0; this.addMoney(player.id, GO_SALARY); break;
+                case 1: this.jail(player); this.landing.jailed = true; break;
+                case 5: this.save(JAIL_CARDS, player.id); player.getOutOfJailCards++; break;
+                case 8: payEach(-10); break;
+                case 13: repairs(40, 115); break;
+                default: this.addMoney(player.id, money[card]); break;
+            }
+        }
+        return this.landing;
+    }
+
+    /** Current player buys an unowned square at list price */
+    makeBuy(position) {
+        this.begin();
+        const player = this.engine.state.getCurrentPlayer();
+        this.addMoney(player.id, -BOARD[position].price);
+        this.save(STAT_PROPERTIES_BOUGHT, player.id);
+        this.engine.state.stats.propertiesBought[player.id]++;
+        this.setOwner(position, player.id);
+    }
+
+    /** Square `position` changes hands outright (auction result, etc.) */
+    makeAward(position, playerId, price) {
+        this.begin();
+        this.addMoney(playerId, -price);
+        this.setOwner(position, playerId);
+    }
+
+    /** GameEngine.buildHouse; the frame is pushed even if the build is illegal */
+    makeBuild(position) {
+        this.begin();
+        const owner = this.ownerOf(position);
+        this.saveDevelopment(position, owner);
+        this.save(STAT_HOUSES_BOUGHT, owner.id);
+        return this.engine.buildHouse(owner, position);
+    }
+
+    /** GameEngine.sellHouse */
+    makeSellHouse(position) {
+        this.begin();
+        const owner = this.ownerOf(position);
+        this.saveDevelopment(position, owner);
+        return this.engine.sellHouse(owner, position);
+    }
+
+    /** GameEngine.mortgageProperty */
+    makeMortgage(position) {
+        this.begin();
+        const owner = this.ownerOf(position);
+        this.save(MONEY, owner.id);
+        this.save(MORTGAGED, position);
+        return this.engine.mortgageProperty(owner, position);
+    }
+
+    /** GameEngine.unmortgageProperty */
+    makeUnmortgage(position) {
+        this.begin();
+        const owner = this.ownerOf(position);
+        this.save(MONEY, owner.id);
+        this.save(MORTGAGED, position);
+        return this.engine.unmortgageProperty(owner, position);
+    }
+
+    /** GameEngine.executeTrade rules and trade shape, without the log line */
+    makeTrade(trade) {
+        this.begin();
+        const { from, to, fromProperties, toProperties, fromCash } = trade;
+        const state = this.engine.state;
+
+        const tradable = (sq, player) =>
+            state.propertyStates[sq].owner === player.id && state.propertyStates[sq].houses === 0;
+        for (const sq of fromProperties) if (!tradable(sq, from)) return false;
+        for (const sq of toProperties) if (!tradable(sq, to)) return false;
+        if (fromCash > 0 && from.money < fromCash) return false;
+        if (fromCash < 0 && to.money < -fromCash) return false;
+
+        for (const sq of fromProperties) this.setOwner(sq, to.id);
+        for (const sq of toProperties) this.setOwner(sq, from.id);
+        this.addMoney(from.id, -fromCash);
+        this.addMoney(to.id, fromCash);
+        return true;
+    }
+
+    /** GameEngine.advanceToNextPlayer */
+    makeEndTurn() {
+        this.begin();
+        this.save(CURRENT);
+        this.save(TURN);
+        this.save(PHASE);
+        this.save(STAT_TOTAL_TURNS);
+        this.engine.advanceToNextPlayer();
+    }
+
+    ownerOf(position) {
+        const owner = this.engine.state.propertyStates[position].owner;
+        if (owner === null) throw new Error(`Square ${position} has no owner`);
+        return this.engine.state.players[owner];
+    }
+
+    /** Everything a build or sale on `position` can touch */
+    saveDevelopment(position, owner) {
+        this.save(MONEY, owner.id);
+        this.save(HOUSES, position);
+        this.save(HOUSES_AVAILABLE);
+        this.save(HOTELS_AVAILABLE);
+    }
+}
+
+// =============================================================================
+// DEBUG CHECKS
+// =============================================================================
+
+/** Every field the trail can restore, in a comparable string */
+function fingerprint(engine) {
+    const state = engine.state;
+    const parts = [state.currentPlayerIndex, state.turn, state.phase,
+        state.housesAvailable, state.hotelsAvailable, state.stats.totalTurns, engine.eventLog.length];
+    for (const p of state.players) {
+        parts.push(`${p.id}:${p.money},${p.position},${p.inJail},${p.jailTurns},` +
+            `${p.getOutOfJailCards},${p.bankrupt},[${[...p.properties]}],` +
+            `${state.stats.housesBought[p.id]},${state.stats.propertiesBought[p.id]}`);
+    }
+    for (let sq = 0; sq < BOARD_SIZE; sq++) {
+        const ps = state.propertyStates[sq];
+        if (ps) parts.push(`${sq}:${ps.owner},${ps.houses},${ps.mortgaged}`);
+    }
+    return parts.join('|');
+}
+
+/** Ownership agrees with every player's Set; houses and the bank add up */
+function checkConsistency(state) {
+    const fail = (msg) => { throw new Error(`MoveStack consistency: ${msg}`); };
+
+    for (const p of state.players) {
+        for (const sq of p.properties) {
+            if (state.propertyStates[sq].owner !== p.id) fail(`player ${p.id} holds ${sq} owned by ${state.propertyStates[sq].owner}`);
+        }
+    }
+    let houses = 0;
+    let hotels = 0;
+    for (let sq = 0; sq < BOARD_SIZE; sq++) {
+        const ps = state.propertyStates[sq];
+        if (!ps) continue;
+        if (ps.owner !== null && !state.players[ps.owner].properties.has(sq)) fail(`${sq} missing from owner ${ps.owner}`);
+        if (ps.houses < 0 || ps.houses > 5) fail(`${sq} has ${ps.houses} houses`);
+        if (ps.houses === 5) hotels++;
+        else houses += ps.houses;
+    }
+    if (state.hotelsAvailable + hotels !== 12) fail(`${hotels} hotels built, ${state.hotelsAvailable} in bank`);
+    if (state.housesAvailable + houses > 32) fail(`${houses} houses built, ${state.housesAvailable} in bank`);
+}
+
+module.exports = { MoveStack, fingerprint, checkConsistency };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const { GameEngine } = require('./game-engine.js');
+    const { createRunner, quietly } = require('./harness.js');
+    const { withSeed, createRandom } = require('./seeded-random.js');
+
+    const args = process.argv.slice(2);
+    const options = { nodes: 200000, seed: 7, debug: false };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--nodes': options.nodes = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--debug': options.debug = true; break;
+        }
+    }
+
+    const runner = createRunner({ maxTurns: 500 });
+    const engine = withSeed(options.seed, () => quietly(() => {
+        const e = new GameEngine({ maxTurns: 500 });
+        e.newGame(4, ['strategic', 'optimal', 'relative', 'growth'].map(t => runner.createAIFactory(t)));
+        for (let i = 0; i < 120 && !e.state.isGameOver(); i++) e.executeTurn();
+        return e;
+    }));
+
+    // Random depth-4 walks: roll, maybe buy/build, end turn, then unwind
+    const random = createRandom(options.seed);
+    const die = () => 1 + Math.floor(random() * 6);
+    const stack = new MoveStack(engine, { debug: options.debug });
+    const before = fingerprint(engine);
+
+    let nodes = 0;
+    const start = process.hrtime.bigint();
+    while (nodes < options.nodes) {
+        for (let ply = 0; ply < 4; ply++) {
+            const landing = stack.makeRoll(die(), die());
+            nodes++;
+            if (landing.card) {
+                stack.makeCard(landing.card, Math.floor(random() * 16), die() + die());
+                nodes++;
+            } else if (landing.unowned && engine.state.getCurrentPlayer().money >= BOARD[landing.position].price) {
+                stack.makeBuy(landing.position);
+                nodes++;
+            }
+            stack.makeEndTurn();
+            nodes++;
+        }
+        stack.unmakeTo(0);
+    }
+    const makeSeconds = Number(process.hrtime.bigint() - start) / 1e9;
+
+    const cloneStart = process.hrtime.bigint();
+    let clones = 0;
+    while (clones < options.nodes / 10) {
+        engine.state.clone();
+        clones++;
+    }
+    const cloneSeconds = Number(process.hrtime.bigint() - cloneStart) / 1e9;
+
+    const intact = fingerprint(engine) === before;
+    console.log(`make/unmake: ${(nodes / makeSeconds / 1e6).toFixed(2)}M nodes/sec ` +
+        `(${nodes} nodes${options.debug ? ', debug checks on' : ''})`);
+    console.log(`clone():     ${(clones / cloneSeconds / 1e6).toFixed(2)}M states/sec`);
+    console.log(`State restored exactly: ${intact ? 'yes' : 'NO'}`);
+}
@@ -207,20 +207,28 @@ function runTest(label, newFactory, baseFactory, games) {
 }
 
 // Run
-const GAMES = 2000;
-console.log('='.repeat(70));
-console.log('NASH PRICING COMPARISON: ' + GAMES + ' games each');
-console.log('='.repeat(70));
-
-const orig = createOriginalFactory();
-const results = [];
-results.push(runTest('ConvergenceNash vs Original', createConvergenceFactory(), orig, GAMES));
-results.push(runTest('AreaNash vs Original', createAreaFactory(), orig, GAMES));
-
-console.log('='.repeat(70));
-console.log('SUMMARY:');
-for (const r of results) {
-    console.log('  ' + r.label.padEnd(35) + r.rate + '%  Z=' + r.z);
+function main() {
+    const GAMES = 2000;
+    console.log('='.repeat(70));
+    console.log('NASH PRICING COMPARISON: ' + GAMES + ' games each');
+    console.log('='.repeat(70));
+
+    const orig = createOriginalFactory();
+    const results = [];
+    results.push(runTest('ConvergenceNash vs Original', createConvergenceFactory(), orig, GAMES));
+    results.push(runTest('AreaNash vs Original', createAreaFactory(), orig, GAMES));
+
+    console.log('='.repeat(70));
+    console.log('SUMMARY:');
+    for (const r of results) {
+        console.log('  ' + r.label.padEnd(35) + r.rate + '%  Z=' + r.z);
+    }
+    console.log('  ' + 'Expected (no improvement)'.padEnd(35) + '25.0%  Z=0.00');
+    console.log('='.repeat(70));
+}
+
+module.exports = { createConvergenceFactory, createAreaFactory, createOriginalFactory, runTest };
+
+if (require.main === module) {
+    main();
 }
-console.log('  ' + 'Expected (no improvement)'.padEnd(35) + '25.0%  Z=0.00');
-console.log('='.repeat(70));
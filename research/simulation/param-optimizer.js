@@ -0,0 +1,641 @@
+/**
+ * CMA-ES + Successive-Halving Parameter Optimizer
+ *
+ * Alternative to genetic-algorithm.js for the same 8 PARAMETERS, opponents
+ * and fitness (win rate of the tuned LeaderAwareAI over every opponent and
+ * seat). Two changes cut the game count:
+ *
+ *   CMA-ES      Covariance Matrix Adaptation Evolution Strategy. Samples
+ *               lambda candidates from a multivariate normal over the
+ *               parameter box (scaled to [0,1]^8), then moves the mean
+ *               toward the better half and learns the step size and
+ *               correlations between parameters. Far fewer evaluations than
+ *               a GA on smooth, noisy problems of this size.
+ *
+ *   Racing      Candidates of a generation are raced by successive halving
+ *               instead of each getting the same games. Every candidate
+ *               plays a first rung (default 100 games); the top 1/eta go on
+ *               to the next rung with twice the games, and so on. Weak
+ *               candidates are dropped after a few hundred games. Ranking is
+ *               by rung reached, then win rate, which is all CMA-ES needs.
+ *
+ * Games are played in blocks of 20: each of the 5 opponent types in each
+ * of the 4 seats. Block b of a generation uses the same seeds for every
+ * candidate (common random numbers), so candidates are compared on
+ * identical dice. Blocks run on a worker_threads pool (worker-pool.js).
+ *
+ * Results go to ga-results/optimizer-state.json (resumable) and
+ * ga-results/optimizer-summary.txt.
+ *
+ * Usage:
+ *   node param-optimizer.js                        # 30 generations
+ *   node param-optimizer.js --generations 10 --workers 8
+ *   node param-optimizer.js --budget 100000        # stop after this many games
+ *   node param-optimizer.js --resume
+ *   node param-optimizer.js --output /tmp/opt      # state elsewhere than ga-results/
+ *   node param-optimizer.js --validate 100         # blocks: CMA-ES vs GA best vs defaults
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { isMainThread, workerData } = require('worker_threads');
+
+const { PARAMETERS } = require('./genetic-algorithm.js');
+const { createRandom, deriveSeed, withSeed } = require('./seeded-random.js');
+const { WorkerPool, serveJobs } = require('./worker-pool.js');
+const { quietly } = require('./harness.js');
+
+const OPPONENTS = 5;
+const SEATS = 4;
+const BLOCK_GAMES = OPPONENTS * SEATS;
+
+const DEFAULTS = {
+    generations: 30,
+    lambda: 0,               // candidates per generation (0 = 4 + 3 ln n)
+    sigma: 0.3,              // initial step size, in units of the parameter range
+    rungs: [5, 10, 20, 40],  // cumulative blocks per racing rung
+    eta: 2,                  // keep the top 1/eta at each rung
+    budget: Infinity,        // stop after this many games
+    workers: os.cpus().length,
+    seed: 20240601,
+    maxTurns: 500,
+    outputDir: path.join(__dirname, 'ga-results')
+};
+
+// =============================================================================
+// LINEAR ALGEBRA
+// =============================================================================
+
+/**
+ * Eigendecomposition of a symmetric matrix by cyclic Jacobi rotations.
+ * @param {number[][]} A - symmetric n x n (not modified)
+ * @returns {{values: number[], vectors: number[][]}} A = V diag(values) V^T,
+ *          eigenvectors in the columns of V
+ */
+function eigenSymmetric(A) {
+    const n = A.length;
+    const a = A.map(row => row.slice());
+    const V = a.map((_, i) => a.map((__, j) => (i === j ? 1 : 0)));
+
+    for (let sweep = 0; sweep < 100; sweep++) {
+        let off = 0;
+        for (let p = 0; p < n; p++) {
+            for (let q = p + 1; q < n; q++) off += a[p][q] * a[p][q];
+        }
+        if (off < 1e-22) break;
+
+        for (let p = 0; p < n; p++) {
+            for (let q = p + 1; q < n; q++) {
+                if (Math.abs(a[p][q]) < 1e-300) continue;
+                const theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+                const t = Math.sign(theta || 1) / (Math.abs(theta) + Math.sqrt(theta * theta + 1));
+                const c = 1 / Math.sqrt(t * t + 1);
+                const s = t * c;
+
+                for (let k = 0; k < n; k++) {
+                    const akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (let k = 0; k < n; k++) {
+                    const apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (let k = 0; k < n; k++) {
+                    const vkp = V[k][p], vkq = V[k][q];
+                    V[k][p] = c * vkp - s * vkq;
+                    V[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    return { values: a.map((row, i) => row[i]), vectors: V };
+}
+
+// =============================================================================
+// CMA-ES
+// =============================================================================
+
+/**
+ * (mu/mu_w, lambda)-CMA-ES with rank-one and rank-mu covariance updates,
+ * following Hansen's tutorial. Maximizes: tell() takes candidates ranked
+ * best first. Solutions are kept inside [lower, upper] by clamping, and the
+ * clamped point is what the update sees.
+ */
+class CMAES {
+    constructor(mean, sigma, options = {}) {
+        const n = mean.length;
+        this.n = n;
+        this.mean = mean.slice();
+        this.sigma = sigma;
+        this.lower = options.lower !== undefined ? options.lower : -Infinity;
+        this.upper = options.upper !== undefined ? options.upper : Infinity;
+        this.random = options.random || Math.random;
+
+        this.lambda = options.lambda || 4 + Math.floor(3 * Math.log(n));
+        this.mu = Math.floor(this.lambda / 2);
+        const raw = [];
+        for (let i = 0; i < this.mu; i++) raw.push(Math.log(this.mu + 0.5) - Math.log(i + 1));
+        const sum = raw.reduce((s, w) => s + w, 0);
+        this.weights = raw.map(w => w / sum);
+        this.mueff = 1 / this.weights.reduce((s, w) => s + w * w, 0);
+
+        const mueff = this.mueff;
+        this.cc = (4 + mueff / n) / (n + 4 + 2 * mueff / n);
+        this.cs = (mueff + 2) / (n + mueff + 5);
+        this.c1 = 2 / ((n + 1.3) * (n + 1.3) + mueff);
+        this.cmu = Math.min(1 - this.c1, 2 * (mueff - 2 + 1 / mueff) / ((n + 2) * (n + 2) + mueff));
+        this.damps = 1 + 2 * Math.max(0, Math.sqrt((mueff - 1) / (n + 1)) - 1) + this.cs;
+        this.chiN = Math.sqrt(n) * (1 - 1 / (4 * n) + 1 / (21 * n * n));
+
+        this.pc = new Array(n).fill(0);
+        this.ps = new Array(n).fill(0);
+        this.C = mean.map((_, i) => mean.map((__, j) => (i === j ? 1 : 0)));
+        this.B = this.C.map(row => row.slice());
+        this.D = new Array(n).fill(1);
+        this.generation = 0;
+    }
+
+    gaussian() {
+        let u = 0, v = 0;
+        while (u === 0) u = this.random();
+        while (v === 0) v = this.random();
+        return Math.sqrt(-2 * Math.log(u)) * Math.cos(2 * Math.PI * v);
+    }
+
+    /** Sample lambda candidate points */
+    ask() {
+        const { n, B, D } = this;
+        const points = [];
+        for (let k = 0; k < this.lambda; k++) {
+            const z = [];
+            for (let i = 0; i < n; i++) z.push(D[i] * this.gaussian());
+            const x = new Array(n);
+            for (let i = 0; i < n; i++) {
+                let y = 0;
+                for (let j = 0; j < n; j++) y += B[i][j] * z[j];
+                x[i] = Math.min(this.upper, Math.max(this.lower, this.mean[i] + this.sigma * y));
+            }
+            points.push(x);
+        }
+        return points;
+    }
+
+    /**
+     * Update the distribution.
+     * @param {number[][]} ranked - the asked points, best first
+     */
+    tell(ranked) {
+        const { n, mu, weights, mueff, cs, cc, c1, cmu } = this;
+        const old = this.mean;
+        const sigma = this.sigma;
+
+        const ys = ranked.slice(0, mu).map(x => x.map((xi, i) => (xi - old[i]) / sigma));
+        const yw = new Array(n).fill(0);
+        for (let k = 0; k < mu; k++) {
+            for (let i = 0; i < n; i++) yw[i] += weights[k] * ys[k][i];
+        }
+        this.mean = old.map((m, i) => m + sigma * yw[i]);
+
+        // C^-1/2 yw = B D^-1 B^T yw
+        const bt = new Array(n).fill(0);
+        for (let j = 0; j < n; j++) {
+            for (let i = 0; i < n; i++) bt[j] += this.B[i][j] * yw[i];
+            bt[j] /= this.D[j];
+        }
+        const cinv = new Array(n).fill(0);
+        for (let i = 0; i < n; i++) {
+            for (let j = 0; j < n; j++) cinv[i] += this.B[i][j] * bt[j];
+        }
+
+        const csn = Math.sqrt(cs * (2 - cs) * mueff);
+        for (let i = 0; i < n; i++) this.ps[i] = (1 - cs) * this.ps[i] + csn * cinv[i];
+        const psNorm = Math.sqrt(this.ps.reduce((s, x) => s + x * x, 0));
+        this.generation++;
+        const hsig = psNorm / Math.sqrt(1 - Math.pow(1 - cs, 2 * this.generation)) / this.chiN <
+            1.4 + 2 / (n + 1) ? 1 : 0;
+
+        const ccn = Math.sqrt(cc * (2 - cc) * mueff);
+        for (let i = 0; i < n; i++) this.pc[i] = (1 - cc) * this.pc[i] + hsig * ccn * yw[i];
+
+        const keep = 1 - c1 - cmu + (1 - hsig) * c1 * cc * (2 - cc);
+        for (let i = 0; i < n; i++) {
+            for (let j = 0; j <= i; j++) {
+                let rankMu = 0;
+                for (let k = 0; k < mu; k++) rankMu += weights[k] * ys[k][i] * ys[k][j];
+                const c = keep * this.C[i][j] + c1 * this.pc[i] * this.pc[j] + cmu * rankMu;
+                this.C[i][j] = c;
+                this.C[j][i] = c;
+            }
+        }
+
+        this.sigma *= Math.exp((cs / this.damps) * (psNorm / this.chiN - 1));
+
+        const { values, vectors } = eigenSymmetric(this.C);
+        this.B = vectors;
+        this.D = values.map(v => Math.sqrt(Math.max(v, 1e-20)));
+    }
+
+    toJSON() {
+        const { n, mean, sigma, lambda, pc, ps, C, generation } = this;
+        return { n, mean, sigma, lambda, pc, ps, C, generation };
+    }
+
+    static fromJSON(saved, options = {}) {
+        const es = new CMAES(saved.mean, saved.sigma, { ...options, lambda: saved.lambda });
+        es.pc = saved.pc;
+        es.ps = saved.ps;
+        es.C = saved.C;
+        es.generation = saved.generation;
+        const { values, vectors } = eigenSymmetric(es.C);
+        es.B = vectors;
+        es.D = values.map(v => Math.sqrt(Math.max(v, 1e-20)));
+        return es;
+    }
+}
+
+// =============================================================================
+// SUCCESSIVE HALVING
+// =============================================================================
+
+/**
+ * Race candidates by successive halving.
+ * @param {number} count - number of candidates
+ * @param {function(number, number, number): Promise<{wins, games}>} evaluate -
+ *        (candidate, firstBlock, blocks) plays blocks [firstBlock, firstBlock + blocks)
+ * @param {Object} options - { rungs: cumulative blocks per rung, eta }
+ * @returns {Promise<Object[]>} per-candidate { index, wins, games, rung }, best first
+ */
+async function race(count, evaluate, options = {}) {
+    const rungs = options.rungs || DEFAULTS.rungs;
+    const eta = options.eta || DEFAULTS.eta;
+    const entries = [];
+    for (let i = 0; i < count; i++) entries.push({ index: i, wins: 0, games: 0, rung: -1 });
+
+    const rate = (e) => (e.games > 0 ? e.wins / e.games : 0);
+    const order = (a, b) => (b.rung - a.rung) || (rate(b) - rate(a)) || (a.index - b.index);
+
+    let alive = entries;
+    let done = 0;
+    for (let r = 0; r < rungs.length && alive.length > 0; r++) {
+        const blocks = rungs[r] - done;
+        const results = await Promise.all(alive.map(e => evaluate(e.index, done, blocks)));
+        alive.forEach((e, i) => {
+            e.wins += results[i].wins;
+            e.games += results[i].games;
+            e.rung = r;
+        });
+        done = rungs[r];
+
+        alive.sort(order);
+        if (r < rungs.length - 1) {
+            alive = alive.slice(0, Math.max(1, Math.ceil(alive.length / eta)));
+        }
+    }
+
+    return entries.sort(order);
+}
+
+// =============================================================================
+// EVALUATION POOL
+// =============================================================================
+
+/** Decode a point in [0,1]^n to a genome over PARAMETERS */
+function decode(x) {
+    const genome = {};
+    PARAMETERS.forEach((param, i) => {
+        const value = param.min + Math.min(1, Math.max(0, x[i])) * (param.max - param.min);
+        const factor = Math.pow(10, param.precision);
+        genome[param.name] = Math.round(value * factor) / factor;
+    });
+    return genome;
+}
+
+function encode(genome) {
+    return PARAMETERS.map(param => (genome[param.name] - param.min) / (param.max - param.min));
+}
+
+/**
+ * Play blocks of games for one genome. Block b, game j uses seed
+ * deriveSeed(seed, b * BLOCK_GAMES + j) whatever the genome.
+ */
+function playBlocks(ga, genome, seed, firstBlock, blocks, maxTurns) {
+    const { GameEngine } = require('./game-engine.js');
+    const custom = ga.createCustomAI(genome);
+    const opponents = ga.getOpponentFactories();
+    let wins = 0;
+    let games = 0;
+
+    for (let b = firstBlock; b < firstBlock + blocks; b++) {
+        for (let o = 0; o < OPPONENTS; o++) {
+            for (let seat = 0; seat < SEATS; seat++) {
+                const factories = [];
+                for (let i = 0; i < SEATS; i++) factories.push(i === seat ? custom : opponents[o]);
+                const result = withSeed(deriveSeed(seed, b * BLOCK_GAMES + o * SEATS + seat), () => {
+                    const engine = new GameEngine({ maxTurns, verbose: false });
+                    engine.newGame(SEATS, factories);
+                    return engine.runGame();
+                });
+                games++;
+                if (result.winner === seat) wins++;
+            }
+        }
+    }
+    return { wins, games };
+}
+
+function createGA(outputDir) {
+    const { GeneticAlgorithm } = require('./genetic-algorithm.js');
+    return quietly(() => new GeneticAlgorithm({ outputDir, verbose: false }));
+}
+
+function workerMain() {
+    const ga = createGA(workerData.outputDir);
+    serveJobs('blocks', (msg) => quietly(() =>
+        playBlocks(ga, msg.genome, msg.seed, msg.firstBlock, msg.blocks, workerData.maxTurns)));
+}
+
+/**
+ * Worker pool that plays blocks of games. Requests are split into
+ * single-block jobs and queued, so a rung of many candidates spreads
+ * evenly across workers.
+ */
+class EvaluationPool {
+    constructor(options = {}) {
+        this.pool = new WorkerPool(__filename, {
+            workers: options.workers || DEFAULTS.workers,
+            workerData: {
+                maxTurns: options.maxTurns || DEFAULTS.maxTurns,
+                outputDir: options.outputDir || DEFAULTS.outputDir
+            }
+        });
+        this.numWorkers = this.pool.size;
+        this.games = 0;
+    }
+
+    start() {
+        return this.pool.start();
+    }
+
+    /** @returns {Promise<{wins, games}>} totals over blocks [firstBlock, firstBlock + blocks) */
+    evaluate(genome, seed, firstBlock, blocks) {
+        const jobs = [];
+        for (let b = firstBlock; b < firstBlock + blocks; b++) {
+            jobs.push(this.pool.run({ type: 'blocks', genome, seed, firstBlock: b, blocks: 1 }).then(msg => {
+                this.games += msg.games;
+                return msg;
+            }));
+        }
+        return Promise.all(jobs).then(parts => parts.reduce(
+            (t, p) => ({ wins: t.wins + p.wins, games: t.games + p.games }), { wins: 0, games: 0 }));
+    }
+
+    stop() {
+        return this.pool.close();
+    }
+}
+
+// =============================================================================
+// OPTIMIZER
+// =============================================================================
+
+class ParameterOptimizer {
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS, ...options };
+        const start = encode(Object.fromEntries(PARAMETERS.map(p => [p.name, p.default])));
+        this.es = new CMAES(start, this.options.sigma, {
+            lower: 0,
+            upper: 1,
+            lambda: this.options.lambda || undefined
+        });
+        this.history = [];
+        this.games = 0;
+        this.best = null;
+        this.pool = null;
+    }
+
+    get statePath() {
+        return path.join(this.options.outputDir, 'optimizer-state.json');
+    }
+
+    /** Run one generation: ask, race, tell */
+    async step() {
+        const es = this.es;
+        const generation = es.generation;
+        // Sampling is seeded per generation, so a resumed run continues exactly
+        es.random = createRandom(deriveSeed(this.options.seed, 1000 + generation));
+        const points = es.ask();
+        const genomes = points.map(decode);
+        // Disjoint seeds per generation; shared by every candidate within it
+        const seed = deriveSeed(this.options.seed, generation);
+        const start = Date.now();
+        const gamesBefore = this.pool.games;
+
+        const ranking = await race(points.length,
+            (i, firstBlock, blocks) => this.pool.evaluate(genomes[i], seed, firstBlock, blocks),
+            this.options);
+        es.tell(ranking.map(e => points[e.index]));
+
+        const games = this.pool.games - gamesBefore;
+        this.games += games;
+        const top = ranking[0];
+        const entry = {
+            generation,
+            games,
+            totalGames: this.games,
+            bestRate: top.wins / top.games,
+            bestGames: top.games,
+            bestGenome: genomes[top.index],
+            meanGenome: decode(es.mean),
+            sigma: es.sigma,
+            time: (Date.now() - start) / 1000
+        };
+        this.history.push(entry);
+        this.best = entry;
+        return entry;
+    }
+
+    async run(resume = false) {
+        const opts = this.options;
+        if (resume) this.loadState();
+
+        this.pool = new EvaluationPool(opts);
+        await this.pool.start();
+
+        console.log(`CMA-ES: lambda ${this.es.lambda}, mu ${this.es.mu}, sigma ${this.es.sigma.toFixed(3)}; ` +
+            `racing rungs ${opts.rungs.map(b => b * BLOCK_GAMES).join('/')} games, eta ${opts.eta}; ` +
+            `${this.pool.numWorkers} workers`);
+
+        try {
+            while (this.es.generation < opts.generations && this.games < opts.budget) {
+                const e = await this.step();
+                console.log(`  Gen ${String(e.generation).padStart(3)}: best ${(e.bestRate * 100).toFixed(1)}% ` +
+                    `over ${e.bestGames} games, sigma ${e.sigma.toFixed(3)}, ` +
+                    `${e.games} games (${e.totalGames.toLocaleString()} total), ${e.time.toFixed(1)}s`);
+                this.saveState();
+            }
+        } finally {
+            await this.pool.stop();
+        }
+        return decode(this.es.mean);
+    }
+
+    saveState() {
+        fs.mkdirSync(this.options.outputDir, { recursive: true });
+        const { outputDir, ...options } = this.options;
+        fs.writeFileSync(this.statePath, JSON.stringify({
+            es: this.es.toJSON(),
+            games: this.games,
+            history: this.history,
+            options,
+            timestamp: new Date().toISOString()
+        }, null, 2));
+        fs.writeFileSync(path.join(outputDir, 'optimizer-summary.txt'), this.generateSummary());
+    }
+
+    loadState() {
+        if (!fs.existsSync(this.statePath)) {
+            console.log('No saved optimizer state found, starting fresh');
+            return false;
+        }
+        const saved = JSON.parse(fs.readFileSync(this.statePath, 'utf8'));
+        this.es = CMAES.fromJSON(saved.es, { lower: 0, upper: 1 });
+        this.games = saved.games;
+        this.history = saved.history;
+        this.best = this.history[this.history.length - 1] || null;
+        console.log(`Resumed at generation ${this.es.generation} (${this.games.toLocaleString()} games played)`);
+        return true;
+    }
+
+    generateSummary() {
+        const mean = decode(this.es.mean);
+        let summary = `
+CMA-ES PARAMETER OPTIMIZATION SUMMARY
+=====================================
+
+Generations Completed: ${this.es.generation}
+Games Played: ${this.games.toLocaleString()}
+Step Size (sigma): ${this.es.sigma.toFixed(4)}
+
+DISTRIBUTION MEAN (recommended):
+`;
+        for (const param of PARAMETERS) {
+            const value = mean[param.name];
+            const diff = value - param.default;
+            const diffStr = diff >= 0 ? `+${diff.toFixed(param.precision)}` : diff.toFixed(param.precision);
+            summary += `  ${param.name.padEnd(30)}: ${value.toFixed(param.precision).padStart(6)} (default: ${param.default}, ${diffStr})\n`;
+        }
+
+        summary += `\nRACE WINNERS:\n`;
+        for (const h of this.history.slice(-20)) {
+            summary += `  Gen ${h.generation.toString().padStart(3)}: ${(h.bestRate * 100).toFixed(1)}% over ${h.bestGames} games, ` +
+                `sigma=${h.sigma.toFixed(3)}\n`;
+        }
+        return summary;
+    }
+}
+
+module.exports = {
+    CMAES,
+    ParameterOptimizer,
+    EvaluationPool,
+    eigenSymmetric,
+    race,
+    decode,
+    encode,
+    playBlocks,
+    BLOCK_GAMES,
+    DEFAULTS
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+/**
+ * Head-to-head check on held-out seeds: the CMA-ES mean, the GA's best
+ * genome (ga-state.json) and the defaults, on the same blocks.
+ */
+async function validate(options, blocks) {
+    const contenders = [['defaults', Object.fromEntries(PARAMETERS.map(p => [p.name, p.default]))]];
+    const gaPath = path.join(options.outputDir, 'ga-state.json');
+    if (fs.existsSync(gaPath)) {
+        const gaState = JSON.parse(fs.readFileSync(gaPath, 'utf8'));
+        const gaGames = (gaState.history || []).length * gaState.options.populationSize * gaState.options.gamesPerEvaluation;
+        contenders.push([`GA best (~${gaGames.toLocaleString()} games)`, gaState.bestGenome]);
+    }
+    const statePath = path.join(options.outputDir, 'optimizer-state.json');
+    if (fs.existsSync(statePath)) {
+        const saved = JSON.parse(fs.readFileSync(statePath, 'utf8'));
+        contenders.push([`CMA-ES mean (${saved.games.toLocaleString()} games)`, decode(saved.es.mean)]);
+    }
+
+    const pool = new EvaluationPool(options);
+    await pool.start();
+    const seed = deriveSeed(options.seed, 0x7E57);
+    console.log(`Validating on ${blocks * BLOCK_GAMES} held-out games each (same seeds for all):`);
+    try {
+        const results = await Promise.all(contenders.map(([, genome]) => pool.evaluate(genome, seed, 0, blocks)));
+        contenders.forEach(([name], i) => {
+            const { wins, games } = results[i];
+            const p = wins / games;
+            const se = Math.sqrt(p * (1 - p) / games);
+            console.log(`  ${name.padEnd(36)} ${(p * 100).toFixed(1).padStart(5)}% +/- ${(se * 100).toFixed(1)}%`);
+        });
+    } finally {
+        await pool.stop();
+    }
+}
+
+async function main() {
+    const args = process.argv.slice(2);
+    const options = {};
+    let resume = false;
+    let validateBlocks = 0;
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--generations': options.generations = parseInt(args[++i], 10); break;
+            case '--lambda': options.lambda = parseInt(args[++i], 10); break;
+            case '--sigma': options.sigma = parseFloat(args[++i]); break;
+            case '--rungs': options.rungs = args[++i].split(',').map(Number); break;
+            case '--eta': options.eta = parseFloat(args[++i]); break;
+            case '--budget': options.budget = parseInt(args[++i], 10); break;
+            case '--workers': options.workers = parseInt(args[++i], 10); break;
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--output': options.outputDir = path.resolve(args[++i]); break;
+            case '--resume': case '-r': resume = true; break;
+            case '--validate': validateBlocks = parseInt(args[++i], 10); break;
+        }
+    }
+
+    console.log('Monopoly AI Parameter Optimizer (CMA-ES + successive halving)');
+    console.log('='.repeat(70));
+
+    if (validateBlocks > 0) {
+        await validate({ ...DEFAULTS, ...options }, validateBlocks);
+        return;
+    }
+
+    const optimizer = new ParameterOptimizer(options);
+    const mean = await optimizer.run(resume);
+
+    console.log(`\n${'='.repeat(70)}`);
+    console.log(`Games played: ${optimizer.games.toLocaleString()}`);
+    console.log('Distribution mean (recommended parameters):');
+    for (const param of PARAMETERS) console.log(`  ${param.name}: ${mean[param.name]}`);
+    console.log(`\nState saved to ${optimizer.statePath}`);
+}
+
+if (!isMainThread) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
@@ -10,6 +10,7 @@
 const { GameEngine, BOARD, COLOR_GROUPS } = require('./game-engine.js');
 const { StrategicAI } = require('./base-ai.js');
 const { TradingAI } = require('./trading-ai.js');
+const { withSeed, deriveSeed } = require('./seeded-random.js');
 
 // Load Markov engine
 let MarkovEngine, PropertyValuator;
@@ -116,9 +117,12 @@ class ParameterSweep {
     }
 
     /**
-     * Run games with specific configurations
+     * Run games with specific configurations.
+     * With options.seed, game i is played under deriveSeed(seed, firstGame + i),
+     * so the same game indices see the same dice whatever the configs.
      */
-    runComparison(config1, config2, numGames) {
+    runComparison(config1, config2, numGames, options = {}) {
+        const firstGame = options.firstGame || 0;
         const results = {
             config1Wins: 0,
             config2Wins: 0,
@@ -129,7 +133,8 @@ class ParameterSweep {
             avgHousesBuilt: 0
         };
 
-        for (let i = 0; i < numGames; i++) {
+        for (let g = 0; g < numGames; g++) {
+            const i = firstGame + g;
             const engine = new GameEngine({
                 maxTurns: this.maxTurns,
                 verbose: false
@@ -150,8 +155,11 @@ class ParameterSweep {
                     (p, e) => new ConfigurableTradingAI(p, e, markovEngine, valuator, config1)
                 ];
 
-            engine.newGame(4, factories);
-            const result = engine.runGame();
+            const play = () => {
+                engine.newGame(4, factories);
+                return engine.runGame();
+            };
+            const result = options.seed === undefined ? play() : withSeed(deriveSeed(options.seed, i), play);
 
             results.totalTurns += result.turns;
             results.avgHousesBuilt += result.stats.housesBought.reduce((a, b) => a + b, 0);
@@ -252,115 +260,123 @@ class ParameterSweep {
 // RUN SWEEP
 // =============================================================================
 
-console.log('='.repeat(60));
-console.log('TRADING PARAMETER SWEEP');
-console.log('='.repeat(60));
-
-const sweep = new ParameterSweep({
-    gamesPerConfig: 100,
-    maxTurns: 500
-});
-
-// Sweep 1: Cash Premium Multiplier
-// How much extra (per EPT point) should we offer above property value?
-console.log('\n>>> SWEEP 1: Cash Premium Multiplier');
-console.log('Higher = more willing to pay premium for monopoly completion');
-const premiumResults = sweep.sweepParameter(
-    'cashPremiumMultiplier',
-    [5, 10, 15, 20, 25],
-    { maxCashOffer: 0.5, acceptanceThreshold: -50, paybackLimit: 40 }
-);
-
-// Sweep 2: Max Cash Offer (fraction of money)
-// How much of our cash are we willing to spend on a trade?
-console.log('\n>>> SWEEP 2: Max Cash Offer Percentage');
-console.log('Higher = willing to spend more of our cash on trades');
-const cashOfferResults = sweep.sweepParameter(
-    'maxCashOffer',
-    [0.3, 0.5, 0.7, 0.9],
-    { cashPremiumMultiplier: 10, acceptanceThreshold: -50, paybackLimit: 40 }
-);
-
-// Sweep 3: Acceptance Threshold
-// How much are we willing to "lose" on a trade for mutual benefit?
-console.log('\n>>> SWEEP 3: Trade Acceptance Threshold');
-console.log('Lower (more negative) = more willing to accept unfavorable trades');
-const thresholdResults = sweep.sweepParameter(
-    'acceptanceThreshold',
-    [0, -50, -100, -150, -200],
-    { cashPremiumMultiplier: 10, maxCashOffer: 0.5, paybackLimit: 40 }
-);
-
-// Sweep 4: Payback Limit
-// How many turns of payback are acceptable?
-console.log('\n>>> SWEEP 4: Payback Turn Limit');
-console.log('Higher = willing to wait longer for ROI');
-const paybackResults = sweep.sweepParameter(
-    'paybackLimit',
-    [20, 30, 40, 50, 60],
-    { cashPremiumMultiplier: 10, maxCashOffer: 0.5, acceptanceThreshold: -50 }
-);
-
-// Summary
-console.log('\n' + '='.repeat(60));
-console.log('SWEEP SUMMARY');
-console.log('='.repeat(60));
-
-function findBest(results, paramName) {
-    // Find which value performed best against baseline
-    let bestValue = results[0].baseline;
-    let bestRate = 0.5;
-
-    for (const r of results) {
-        if (r.testRate > bestRate) {
-            bestRate = r.testRate;
-            bestValue = r.test;
+function main() {
+    console.log('='.repeat(60));
+    console.log('TRADING PARAMETER SWEEP');
+    console.log('='.repeat(60));
+
+    const sweep = new ParameterSweep({
+        gamesPerConfig: 100,
+        maxTurns: 500
+    });
+
+    // Sweep 1: Cash Premium Multiplier
+    // How much extra (per EPT point) should we offer above property value?
+    console.log('\n>>> SWEEP 1: Cash Premium Multiplier');
+    console.log('Higher = more willing to pay premium for monopoly completion');
+    const premiumResults = sweep.sweepParameter(
+        'cashPremiumMultiplier',
+        [5, 10, 15, 20, 25],
+        { maxCashOffer: 0.5, acceptanceThreshold: -50, paybackLimit: 40 }
+    );
+
+    // Sweep 2: Max Cash Offer (fraction of money)
+    // How much of our cash are we willing to spend on a trade?
+    console.log('\n>>> SWEEP 2: Max Cash Offer Percentage');
+    console.log('Higher = willing to spend more of our cash on trades');
+    const cashOfferResults = sweep.sweepParameter(
+        'maxCashOffer',
+        [0.3, 0.5, 0.7, 0.9],
+        { cashPremiumMultiplier: 10, acceptanceThreshold: -50, paybackLimit: 40 }
+    );
+
+    // Sweep 3: Acceptance Threshold
+    // How much are we willing to "lose" on a trade for mutual benefit?
+    console.log('\n>>> SWEEP 3: Trade Acceptance Threshold');
+    console.log('Lower (more negative) = more willing to accept unfavorable trades');
+    const thresholdResults = sweep.sweepParameter(
+        'acceptanceThreshold',
+        [0, -50, -100, -150, -200],
+        { cashPremiumMultiplier: 10, maxCashOffer: 0.5, paybackLimit: 40 }
+    );
+
+    // Sweep 4: Payback Limit
+    // How many turns of payback are acceptable?
+    console.log('\n>>> SWEEP 4: Payback Turn Limit');
+    console.log('Higher = willing to wait longer for ROI');
+    const paybackResults = sweep.sweepParameter(
+        'paybackLimit',
+        [20, 30, 40, 50, 60],
+        { cashPremiumMultiplier: 10, maxCashOffer: 0.5, acceptanceThreshold: -50 }
+    );
+
+    // Summary
+    console.log('\n' + '='.repeat(60));
+    console.log('SWEEP SUMMARY');
+    console.log('='.repeat(60));
+
+    function findBest(results, paramName) {
+        // Find which value performed best against baseline
+        let bestValue = results[0].baseline;
+        let bestRate = 0.5;
+
+        for (const r of results) {
+            if (r.testRate > bestRate) {
+                bestRate = r.testRate;
+                bestValue = r.test;
+            }
+        }
+
+        // If baseline was best
+        if (bestRate <= 0.5) {
+            bestValue = results[0].baseline;
+            bestRate = results[0].baselineRate;
         }
-    }
 
-    // If baseline was best
-    if (bestRate <= 0.5) {
-        bestValue = results[0].baseline;
-        bestRate = results[0].baselineRate;
+        return { value: bestValue, rate: bestRate };
     }
 
-    return { value: bestValue, rate: bestRate };
+    const bestPremium = findBest(premiumResults, 'cashPremiumMultiplier');
+    const bestCashOffer = findBest(cashOfferResults, 'maxCashOffer');
+    const bestThreshold = findBest(thresholdResults, 'acceptanceThreshold');
+    const bestPayback = findBest(paybackResults, 'paybackLimit');
+
+    console.log(`
+    Best Parameters Found:
+      Cash Premium Multiplier: ${bestPremium.value} (${(bestPremium.rate * 100).toFixed(1)}% win rate)
+      Max Cash Offer: ${bestCashOffer.value} (${(bestCashOffer.rate * 100).toFixed(1)}% win rate)
+      Acceptance Threshold: ${bestThreshold.value} (${(bestThreshold.rate * 100).toFixed(1)}% win rate)
+      Payback Limit: ${bestPayback.value} (${(bestPayback.rate * 100).toFixed(1)}% win rate)
+    `);
+
+    // Final head-to-head: Optimized vs Default
+    console.log('\n>>> FINAL: Optimized vs Default Configuration');
+    const optimizedConfig = {
+        cashPremiumMultiplier: bestPremium.value,
+        maxCashOffer: bestCashOffer.value,
+        acceptanceThreshold: bestThreshold.value,
+        paybackLimit: bestPayback.value
+    };
+
+    const defaultConfig = {
+        cashPremiumMultiplier: 10,
+        maxCashOffer: 0.5,
+        acceptanceThreshold: -50,
+        paybackLimit: 40
+    };
+
+    console.log(`Optimized: ${JSON.stringify(optimizedConfig)}`);
+    console.log(`Default: ${JSON.stringify(defaultConfig)}`);
+
+    sweep.headToHead(optimizedConfig, defaultConfig, 200, 'Optimized', 'Default');
+
+    console.log('\n' + '='.repeat(60));
+    console.log('SWEEP COMPLETE');
+    console.log('='.repeat(60));
 }
 
-const bestPremium = findBest(premiumResults, 'cashPremiumMultiplier');
-const bestCashOffer = findBest(cashOfferResults, 'maxCashOffer');
-const bestThreshold = findBest(thresholdResults, 'acceptanceThreshold');
-const bestPayback = findBest(paybackResults, 'paybackLimit');
-
-console.log(`
-Best Parameters Found:
-  Cash Premium Multiplier: ${bestPremium.value} (${(bestPremium.rate * 100).toFixed(1)}% win rate)
-  Max Cash Offer: ${bestCashOffer.value} (${(bestCashOffer.rate * 100).toFixed(1)}% win rate)
-  Acceptance Threshold: ${bestThreshold.value} (${(bestThreshold.rate * 100).toFixed(1)}% win rate)
-  Payback Limit: ${bestPayback.value} (${(bestPayback.rate * 100).toFixed(1)}% win rate)
-`);
-
-// Final head-to-head: Optimized vs Default
-console.log('\n>>> FINAL: Optimized vs Default Configuration');
-const optimizedConfig = {
-    cashPremiumMultiplier: bestPremium.value,
-    maxCashOffer: bestCashOffer.value,
-    acceptanceThreshold: bestThreshold.value,
-    paybackLimit: bestPayback.value
-};
-
-const defaultConfig = {
-    cashPremiumMultiplier: 10,
-    maxCashOffer: 0.5,
-    acceptanceThreshold: -50,
-    paybackLimit: 40
-};
-
-console.log(`Optimized: ${JSON.stringify(optimizedConfig)}`);
-console.log(`Default: ${JSON.stringify(defaultConfig)}`);
-
-sweep.headToHead(optimizedConfig, defaultConfig, 200, 'Optimized', 'Default');
-
-console.log('\n' + '='.repeat(60));
-console.log('SWEEP COMPLETE');
-console.log('='.repeat(60));
+module.exports = { ConfigurableTradingAI, ParameterSweep };
+
+if (require.main === module) {
+    main();
+}
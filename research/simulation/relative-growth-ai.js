@@ -97,6 +97,11 @@ class RelativeGrowthAI extends TradingAI {
      * Returns map of playerId -> { propertyEPT, relativeEPT, netGrowth }
      */
     calculateRelativeEPTs(state) {
+        // The live game state has running sums maintained by the engine
+        if (this.engine && this.engine.getEPTTracker && state === this.engine.state) {
+            return this.engine.getEPTTracker(this.probs).relativeEPTs();
+        }
+
         const activePlayers = state.players.filter(p => !p.bankrupt);
         const numPlayers = activePlayers.length;
         const opponents = numPlayers - 1;
@@ -133,51 +138,19 @@ class RelativeGrowthAI extends TradingAI {
      * Returns projected position value (NPV of income stream)
      */
     simulateGrowthCurve(group, startingCash, opponents, propertyStates, playerId) {
-        const squares = COLOR_GROUPS[group].squares;
-        const houseCost = BOARD[squares[0]].housePrice;
-        const costPerLevel = houseCost * squares.length;
-
-        // Clone property states for simulation
-        const simStates = {};
-        for (const sq of squares) {
-            simStates[sq] = {
-                owner: playerId,
-                houses: propertyStates[sq]?.houses || 0
-            };
-        }
-
-        let cash = startingCash;
-        let totalNPV = 0;
-
-        for (let t = 1; t <= this.projectionHorizon; t++) {
-            // Calculate current EPT at current development level
-            const currentHouses = simStates[squares[0]].houses;
-            let ept = 0;
-            for (const sq of squares) {
-                const prob = this.probs ? this.probs[sq] : 0.025;
-                const rent = currentHouses === 0
-                    ? BOARD[sq].rent[0] * 2  // Monopoly bonus
-                    : BOARD[sq].rent[currentHouses];
-                ept += prob * rent * opponents;
-            }
-
-            // Add discounted EPT to NPV
-            const discountFactor = 1 / Math.pow(1 + this.discountRate, t);
-            totalNPV += ept * discountFactor;
-
-            // Accumulate cash
-            cash += ept + DICE_EPT;  // Property income + dice income
-
-            // Build houses if possible
-            while (currentHouses < 5 && cash >= costPerLevel) {
-                cash -= costPerLevel;
-                for (const sq of squares) {
-                    simStates[sq].houses++;
-                }
-            }
-        }
+        return this.simulateGrowthCurves(group, [startingCash], opponents, propertyStates)[0];
+    }
 
-        return totalNPV;
+    /**
+     * simulateGrowthCurve for many starting cash values in one batch
+     * @returns {Float64Array} NPV per starting cash
+     */
+    simulateGrowthCurves(group, startingCashes, opponents, propertyStates) {
+        const startHouses = propertyStates[COLOR_GROUPS[group].squares[0]]?.houses || 0;
+        return this.getProjector().growthNPV(
+            group, startHouses, opponents, startingCashes,
+            this.projectionHorizon, this.discountRate
+        );
     }
 
     /**
@@ -196,202 +169,27 @@ class RelativeGrowthAI extends TradingAI {
      * #3 (trajectory output). See bilateral-trade-valuation.md.
      */
     simulateBilateralGrowth(myState, theirState, propertyStates, numOtherOpponents) {
-        const horizon = this.projectionHorizon;  // 62 turns
-        const getProb = (idx) => (this.probs && this.probs[idx]) || 0.025;
-
-        // Build initial development state for both players
-        const initPlayer = (pState) => {
-            const groups = [];
-            for (const groupName of pState.groups) {
-                if (!COLOR_GROUPS[groupName]) continue;
-                const squares = COLOR_GROUPS[groupName].squares;
-                const houseCost = BOARD[squares[0]].housePrice;
-                const houses = squares.map(sq =>
-                    propertyStates[sq]?.houses || 0
-                );
-                groups.push({ name: groupName, squares, houseCost, houses });
-            }
-            // Count owned, unmortgaged railroads and utilities
-            let rrCount = 0, utilCount = 0;
-            for (const rrPos of [5, 15, 25, 35]) {
-                if (propertyStates[rrPos]?.owner === pState.id &&
-                    !propertyStates[rrPos]?.mortgaged) rrCount++;
-            }
-            for (const utilPos of [12, 28]) {
-                if (propertyStates[utilPos]?.owner === pState.id &&
-                    !propertyStates[utilPos]?.mortgaged) utilCount++;
-            }
-            return { cash: pState.cash, groups, id: pState.id, rrCount, utilCount };
-        };
-
-        const me = initPlayer(myState);
-        const them = initPlayer(theirState);
-
-        // Opponent count for EPT: each player faces the other + non-modeled players
-        const myOpponents = 1 + numOtherOpponents;
-        const theirOpponents = 1 + numOtherOpponents;
-
-        // Helper: compute total EPT for a player at current development
-        const computeEPT = (player, opponents) => {
-            let totalEPT = 0;
-            for (const g of player.groups) {
-                for (let i = 0; i < g.squares.length; i++) {
-                    const sq = g.squares[i];
-                    const h = g.houses[i];
-                    const prob = getProb(sq);
-                    const rent = h === 0
-                        ? BOARD[sq].rent[0] * 2  // monopoly, no houses
-                        : BOARD[sq].rent[h];
-                    totalEPT += prob * rent * opponents;
-                }
-            }
-            // Railroad EPT (steady income, no development)
-            if (player.rrCount > 0) {
-                const rrRent = RAILROAD_RENT[player.rrCount];
-                for (const rrPos of [5, 15, 25, 35]) {
-                    if (propertyStates[rrPos]?.owner === player.id &&
-                        !propertyStates[rrPos]?.mortgaged) {
-                        totalEPT += getProb(rrPos) * rrRent * opponents;
-                    }
-                }
-            }
-            // Utility EPT (average dice roll = 7)
-            if (player.utilCount > 0) {
-                const utilRent = UTILITY_MULTIPLIER[player.utilCount] * 7;
-                for (const utilPos of [12, 28]) {
-                    if (propertyStates[utilPos]?.owner === player.id &&
-                        !propertyStates[utilPos]?.mortgaged) {
-                        totalEPT += getProb(utilPos) * utilRent * opponents;
-                    }
-                }
-            }
-            return totalEPT;
-        };
-
-        // Helper: build best available house (highest marginal ROI, even building)
-        const tryBuild = (player) => {
-            let bestROI = 0;
-            let bestGroup = null;
-            let bestSqIdx = -1;
-
-            for (const g of player.groups) {
-                const minH = Math.min(...g.houses);
-                for (let i = 0; i < g.squares.length; i++) {
-                    if (g.houses[i] >= 5) continue;
-                    if (g.houses[i] > minH) continue;  // even building
-                    if (player.cash < g.houseCost) continue;
-
-                    const sq = g.squares[i];
-                    const prob = getProb(sq);
-                    const curRent = g.houses[i] === 0
-                        ? BOARD[sq].rent[0] * 2
-                        : BOARD[sq].rent[g.houses[i]];
-                    const newRent = BOARD[sq].rent[g.houses[i] + 1];
-                    const marginalEPT = prob * (newRent - curRent);
-                    const roi = marginalEPT / g.houseCost;
-
-                    if (roi > bestROI) {
-                        bestROI = roi;
-                        bestGroup = g;
-                        bestSqIdx = i;
-                    }
-                }
-            }
-
-            if (bestGroup && player.cash >= bestGroup.houseCost) {
-                player.cash -= bestGroup.houseCost;
-                bestGroup.houses[bestSqIdx]++;
-                return true;
-            }
-            return false;
-        };
-
-        // Helper: sell worst house (lowest marginal ROI, even-selling)
-        const trySellHouse = (player) => {
-            let worstROI = Infinity;
-            let worstGroup = null;
-            let worstSqIdx = -1;
-
-            for (const g of player.groups) {
-                const maxH = Math.max(...g.houses);
-                for (let i = 0; i < g.squares.length; i++) {
-                    if (g.houses[i] <= 0) continue;
-                    if (g.houses[i] < maxH) continue;  // even-selling
-
-                    const sq = g.squares[i];
-                    const prob = getProb(sq);
-                    const curRent = BOARD[sq].rent[g.houses[i]];
-                    const prevRent = g.houses[i] === 1
-                        ? BOARD[sq].rent[0] * 2
-                        : BOARD[sq].rent[g.houses[i] - 1];
-                    const marginalEPT = prob * (curRent - prevRent);
-                    const roi = marginalEPT / g.houseCost;
-
-                    if (roi < worstROI) {
-                        worstROI = roi;
-                        worstGroup = g;
-                        worstSqIdx = i;
-                    }
-                }
-            }
-
-            if (worstGroup) {
-                player.cash += Math.floor(worstGroup.houseCost / 2);  // 50% sale
-                worstGroup.houses[worstSqIdx]--;
-                return true;
-            }
-            return false;
-        };
-
-        // Helper: compute position (tangible value, not NPV)
-        const computePosition = (player) => {
-            let pos = player.cash;
-            for (const g of player.groups) {
-                for (let i = 0; i < g.squares.length; i++) {
-                    pos += BOARD[g.squares[i]].price;
-                    pos += g.houses[i] * g.houseCost;
-                }
-            }
-            // Railroad and utility property values
-            for (const rrPos of [5, 15, 25, 35]) {
-                if (propertyStates[rrPos]?.owner === player.id) pos += 200;
-            }
-            for (const utilPos of [12, 28]) {
-                if (propertyStates[utilPos]?.owner === player.id) pos += 150;
-            }
-            return pos;
-        };
-
-        const myTrajectory = [computePosition(me)];
-        const theirTrajectory = [computePosition(them)];
-
-        for (let t = 1; t <= horizon; t++) {
-            // Income phase: both players earn and pay rent simultaneously
-            const myEPT = computeEPT(me, myOpponents);
-            const theirEPT = computeEPT(them, theirOpponents);
-
-            me.cash += DICE_EPT + myEPT - theirEPT / myOpponents;
-            them.cash += DICE_EPT + theirEPT - myEPT / theirOpponents;
-
-            // Liquidation: sell houses at 50% when cash negative
-            if (me.cash < 0) {
-                while (me.cash < 0 && trySellHouse(me)) {}
-                me.cash = Math.max(0, me.cash);  // mortgage buffer
-            }
-            if (them.cash < 0) {
-                while (them.cash < 0 && trySellHouse(them)) {}
-                them.cash = Math.max(0, them.cash);  // mortgage buffer
-            }
-
-            // Build phase: each player builds greedily
-            while (tryBuild(me)) {}
-            while (tryBuild(them)) {}
-
-            myTrajectory.push(computePosition(me));
-            theirTrajectory.push(computePosition(them));
-        }
+        const { my, their } = this.simulateBilateralGrowthBatch(
+            myState, theirState, propertyStates, numOtherOpponents,
+            [myState.cash], [theirState.cash]
+        );
+        return { myTrajectory: Array.from(my), theirTrajectory: Array.from(their) };
+    }
 
-        return { myTrajectory, theirTrajectory };
+    /**
+     * simulateBilateralGrowth for many starting-cash pairs with the same
+     * holdings. Sides are compiled once; cash comes from the arrays, not
+     * from myState/theirState.
+     * @returns {{my: Float64Array, their: Float64Array, stride: number}}
+     */
+    simulateBilateralGrowthBatch(myState, theirState, propertyStates, numOtherOpponents, myCashes, theirCashes) {
+        const projector = this.getProjector();
+        const opponents = 1 + numOtherOpponents;
+        return projector.projectBilateral(
+            projector.compileSide(myState, propertyStates, opponents),
+            projector.compileSide(theirState, propertyStates, opponents),
+            myCashes, theirCashes, this.projectionHorizon, opponents
+        );
     }
 
     /**
@@ -567,37 +365,43 @@ class RelativeGrowthAI extends TradingAI {
         const searchMin = Math.max(-maxCash, -500);
         const searchMax = Math.min(maxCash, myCash);
 
+        // Every candidate cash level, projected in one batch
+        const candidates = [];
+        const myCashes = [];
+        const theirCashes = [];
         for (let cash = searchMin; cash <= searchMax; cash += step) {
             const myCashAfter = myCash - cash;
             const theirCashAfter = theirCash + cash;
             if (myCashAfter < 0 || theirCashAfter < 0) continue;
+            candidates.push(cash);
+            myCashes.push(myCashAfter);
+            theirCashes.push(theirCashAfter);
+        }
 
-            const { myTrajectory, theirTrajectory } =
-                this.simulateBilateralGrowth(
-                    { groups: myGroups, cash: myCashAfter,
-                      id: this.player.id },
-                    { groups: theirGroups, cash: theirCashAfter,
-                      id: opponentId },
-                    postTradePS, numOtherOpponents
-                );
+        const { my, their, stride } = this.simulateBilateralGrowthBatch(
+            { groups: myGroups, id: this.player.id },
+            { groups: theirGroups, id: opponentId },
+            postTradePS, numOtherOpponents, myCashes, theirCashes
+        );
 
+        for (let k = 0; k < candidates.length; k++) {
             // Convergence-point Nash: find the turn where trajectories
             // are closest, then use the signed gap at that point.
             // Nash price = cash where the gap at convergence is zero.
             let minGap = Infinity;
             let convergenceGap = 0;
-            for (let t = 0; t < myTrajectory.length; t++) {
-                const gap = Math.abs(myTrajectory[t] - theirTrajectory[t]);
+            for (let t = k * stride; t < (k + 1) * stride; t++) {
+                const gap = Math.abs(my[t] - their[t]);
                 if (gap < minGap) {
                     minGap = gap;
-                    convergenceGap = myTrajectory[t] - theirTrajectory[t];
+                    convergenceGap = my[t] - their[t];
                 }
             }
 
             const gapMagnitude = Math.abs(convergenceGap);
             if (gapMagnitude < minAreaDiff) {
                 minAreaDiff = gapMagnitude;
-                bestCash = cash;
+                bestCash = candidates[k];
             }
         }
 
@@ -625,17 +429,20 @@ class RelativeGrowthAI extends TradingAI {
         const baseValue = Array.from(properties).reduce((sum, p) =>
             sum + (BOARD[p].price || 0), 0);
 
+        const offers = [];
         for (let offer = baseValue; offer <= myCash * 0.7; offer += 50) {
-            const cashAfter = myCash - offer;
-            const npv = this.simulateGrowthCurve(
-                group,
-                cashAfter,
-                opponents,
-                state.propertyStates,
-                this.player.id
-            );
+            offers.push(offer);
+        }
+        const npvs = this.simulateGrowthCurves(
+            group,
+            offers.map(offer => myCash - offer),
+            opponents,
+            state.propertyStates
+        );
 
-            const profit = npv - offer;
+        for (let k = 0; k < offers.length; k++) {
+            const offer = offers[k];
+            const profit = npvs[k] - offer;
             if (profit > maxProfit) {
                 maxProfit = profit;
                 bestOffer = offer;
@@ -766,4 +573,4 @@ class RelativeGrowthAI extends TradingAI {
     }
 }
 
-module.exports = { RelativeGrowthAI };
+module.exports = { RelativeGrowthAI, DICE_EPT };
@@ -0,0 +1,265 @@
+/**
+ * Rent-Flow Matrix
+ *
+ * Maintains the pairwise expected transfer matrix
+ *
+ *   F[i][j] = expected dollars player i pays player j per round
+ *           = sum over squares s owned by j of P_i(s) * rent(s)
+ *
+ * where P_i is player i's landing distribution for one turn and rent(s) is
+ * exactly what engine.calculateRent charges (mortgages, railroad counts,
+ * monopoly doubling, houses; utilities at the average roll of 7).
+ *
+ * Row sums are what a player expects to pay, column sums what they expect
+ * to collect, and netDrift(i) = collected - paid. Because every dollar paid
+ * is a dollar received, net drift sums to zero across active players -
+ * the README's "relative EPT is zero-sum" observation, made pairwise.
+ *
+ * F is updated incrementally through GameEngine.propertyChanged(): a change
+ * to one square re-prices only its rent unit (see ept-tracker.js) and
+ * adjusts one column entry per player. Entries are kept in fixed point so
+ * they never drift over a long game.
+ *
+ * By default every player uses the steady-state landing probabilities.
+ * conditionOnPositions() switches each row to the one-turn distribution
+ * from that player's current square, for short-horizon cash forecasts.
+ *
+ * Usage:
+ *   const flow = engine.getRentFlow(probs);
+ *   flow.flow(i, j);        // expected $ i -> j per round
+ *   flow.netDrift(i);       // expected net rent cash per round
+ *   node rent-flow.js --seed 7 --turns 40
+ */
+
+'use strict';
+
+const { BOARD } = require('./game-engine.js');
+const { RENT_UNIT } = require('./ept-tracker.js');
+
+const SCALE = 1e9;
+const BOARD_SIZE = 40;
+const JAIL = 10;
+
+class RentFlowMatrix {
+    /**
+     * @param {GameEngine} engine - rents come from engine.calculateRent
+     * @param {number[]} probs - steady-state landing probability per square
+     */
+    constructor(engine, probs) {
+        this.engine = engine;
+        this.state = engine.state;
+        this.probs = probs;
+        this.knownProbs = new WeakSet([probs]);
+        this.n = this.state.players.length;
+
+        // Landing distribution per player (row-major n x 40)
+        this.landing = new Float64Array(this.n * BOARD_SIZE);
+        for (let i = 0; i < this.n; i++) {
+            this.landing.set(probs, i * BOARD_SIZE);
+        }
+
+        // Rent currently booked for each square and who collects it
+        this.owner = new Int8Array(BOARD_SIZE).fill(-1);
+        this.rent = new Float64Array(BOARD_SIZE);
+
+        // F in fixed point, row-major n x n
+        this.F = new Float64Array(this.n * this.n);
+
+        this.rebuild();
+    }
+
+    /**
+     * Recompute F from the state
+     */
+    rebuild() {
+        this.owner.fill(-1);
+        this.rent.fill(0);
+        this.F.fill(0);
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            if (BOARD[sq].price) this.book(sq);
+        }
+        return this;
+    }
+
+    /**
+     * Re-price the rent unit containing `position`
+     */
+    update(position) {
+        const unit = RENT_UNIT[position];
+        for (let k = 0; k < unit.length; k++) {
+            this.book(unit[k]);
+        }
+    }
+
+    /**
+     * Move one square's expected rent from its booked owner/rent to the
+     * current ones: one column entry per paying player.
+     */
+    book(sq) {
+        const propState = this.state.propertyStates[sq];
+        const owner = propState && propState.owner !== null && propState.owner !== undefined
+            ? propState.owner : -1;
+        const rent = owner >= 0 ? this.engine.calculateRent(sq, 7) : 0;
+
+        const oldOwner = this.owner[sq];
+        const oldRent = this.rent[sq];
+        if (owner === oldOwner && rent === oldRent) return;
+
+        const n = this.n;
+        for (let i = 0; i < n; i++) {
+            const p = this.landing[i * BOARD_SIZE + sq];
+            if (oldOwner >= 0 && oldOwner !== i) {
+                this.F[i * n + oldOwner] -= Math.round(p * oldRent * SCALE);
+            }
+            if (owner >= 0 && owner !== i) {
+                this.F[i * n + owner] += Math.round(p * rent * SCALE);
+            }
+        }
+
+        this.owner[sq] = owner;
+        this.rent[sq] = rent;
+    }
+
+    /**
+     * True if `probs` holds the steady-state values this matrix was built
+     * with (compared by value once per array, as EPTTracker.matches()).
+     */
+    matches(probs) {
+        if (this.knownProbs.has(probs)) return true;
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            if (probs[sq] !== this.probs[sq]) return false;
+        }
+        this.knownProbs.add(probs);
+        return true;
+    }
+
+    /**
+     * Replace player i's landing distribution and recompute their row.
+     * The row is one owner-masked dot product of landing x rent per owner.
+     */
+    setLandingVector(i, vector) {
+        const n = this.n;
+        const base = i * BOARD_SIZE;
+        this.landing.set(vector, base);
+        this.F.fill(0, i * n, i * n + n);
+
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            const owner = this.owner[sq];
+            if (owner >= 0 && owner !== i) {
+                this.F[i * n + owner] += Math.round(this.landing[base + sq] * this.rent[sq] * SCALE);
+            }
+        }
+    }
+
+    /**
+     * Use each player's next-turn landing distribution instead of the
+     * steady state. `matrix` is MarkovEngine.getTransitionMatrix() (40 x 41,
+     * column 40 = sent to jail, which pays no rent).
+     */
+    conditionOnPositions(matrix) {
+        for (const player of this.state.players) {
+            // Jail is approximated by the Just Visiting row
+            const from = player.inJail ? JAIL : player.position;
+            this.setLandingVector(player.id, matrix[from].slice(0, BOARD_SIZE));
+        }
+    }
+
+    /** Revert every row to the steady-state probabilities */
+    useSteadyState() {
+        for (let i = 0; i < this.n; i++) {
+            this.setLandingVector(i, this.probs);
+        }
+    }
+
+    // =========================================================================
+    // READERS
+    // =========================================================================
+
+    /** Expected dollars i pays j per round (0 if either is bankrupt) */
+    flow(i, j) {
+        const players = this.state.players;
+        if (players[i].bankrupt || players[j].bankrupt) return 0;
+        return this.F[i * this.n + j] / SCALE;
+    }
+
+    /** Expected rent player i pays per round */
+    paid(i) {
+        let total = 0;
+        for (let j = 0; j < this.n; j++) total += this.flow(i, j);
+        return total;
+    }
+
+    /** Expected rent player j collects per round */
+    received(j) {
+        let total = 0;
+        for (let i = 0; i < this.n; i++) total += this.flow(i, j);
+        return total;
+    }
+
+    /** Expected net rent cash per round (received - paid) */
+    netDrift(i) {
+        return this.received(i) - this.paid(i);
+    }
+
+    /** Dense copy of F in dollars, bankrupt players zeroed */
+    matrix() {
+        const rows = [];
+        for (let i = 0; i < this.n; i++) {
+            const row = [];
+            for (let j = 0; j < this.n; j++) row.push(this.flow(i, j));
+            rows.push(row);
+        }
+        return rows;
+    }
+}
+
+module.exports = { RentFlowMatrix };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const { GameEngine } = require('./game-engine.js');
+    const { createRunner } = require('./harness.js');
+    const { withSeed } = require('./seeded-random.js');
+
+    const args = process.argv.slice(2);
+    const options = { seed: 7, turns: 40, conditioned: false };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--seed': options.seed = parseInt(args[++i], 10); break;
+            case '--turns': options.turns = parseInt(args[++i], 10); break;
+            case '--conditioned': options.conditioned = true; break;
+        }
+    }
+
+    const runner = createRunner({ maxTurns: 500 });
+
+    const lineup = ['strategic', 'optimal', 'relative', 'growth'];
+    const engine = withSeed(options.seed, () => {
+        const e = new GameEngine({ maxTurns: 500 });
+        e.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+        while (!e.state.isGameOver() && e.state.turn < options.turns) e.executeTurn();
+        return e;
+    });
+
+    const flow = engine.getRentFlow(runner.markovEngine.getAllProbabilities('stay'));
+    if (options.conditioned) {
+        flow.conditionOnPositions(runner.markovEngine.getTransitionMatrix());
+    }
+
+    const pad = (s, w) => String(s).padStart(w);
+    console.log(`Rent flow after ${engine.state.turn} turns (seed ${options.seed}, ` +
+        `${options.conditioned ? 'next-turn' : 'steady-state'} landing)\n`);
+    console.log('  payer \\ payee ' + lineup.map(t => pad(t, 10)).join('') + pad('paid', 10));
+    const matrix = flow.matrix();
+    for (let i = 0; i < flow.n; i++) {
+        const row = matrix[i].map(v => pad(v.toFixed(2), 10)).join('');
+        console.log('  ' + lineup[i].padEnd(13) + row + pad(flow.paid(i).toFixed(2), 10));
+    }
+    console.log('  ' + 'received'.padEnd(13) +
+        lineup.map((_, j) => pad(flow.received(j).toFixed(2), 10)).join(''));
+    console.log('  ' + 'net drift'.padEnd(13) +
+        lineup.map((_, j) => pad(flow.netDrift(j).toFixed(2), 10)).join(''));
+}
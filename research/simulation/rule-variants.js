@@ -0,0 +1,383 @@
+/**
+ * Rule Variants
+ *
+ * House rules as engine subclasses instead of option flags. Each rule is a
+ * mixin that overrides only the engine methods it changes; a variant is
+ * the class the mixins compose to, built once and cached. Standard games
+ * never see a rule check, and every variant engine is its own class with
+ * its own (monomorphic) hot paths.
+ *
+ * Rules:
+ *   freeParking   Taxes, fines and card fees go into a pot; landing on
+ *                 Free Parking collects it
+ *   noAuction     A property the lander declines stays with the bank
+ *   doubleGo      Landing exactly on GO (or the Advance to GO card) pays
+ *                 the salary twice
+ *   unevenBuild   No even building or even selling rule
+ *   speedDie      Third die: 1-3 is added to the move, Mr. Monopoly
+ *                 continues to the next unowned property (else the next
+ *                 one that charges rent), the bus moves one white die or
+ *                 both, triples go anywhere and end the turn. Used from
+ *                 the first turn and not in jail.
+ *
+ * Variant names join rules with '+' ('freeParking+doubleGo'); 'standard'
+ * is the plain engine. variantDice() names the MarkovEngine dice
+ * configuration whose landing probabilities match the variant. Any
+ * GameEngine subclass can be the base, e.g. variantClass('speedDie',
+ * AuctionGameEngine), unless a rule contradicts it: noAuction is rejected
+ * over a base that auctions every square. Rules that change the turn or
+ * the auction also override AsyncGameEngine's awaited versions
+ * (handleNormalTurnAsync, runAuctionAsync); bases without them never
+ * call those.
+ *
+ * Usage:
+ *   const { createEngine, variantClass } = require('./rule-variants.js');
+ *   const engine = createEngine('freeParking+speedDie', { maxTurns: 500 });
+ *   new SimulationRunner({ rules: 'speedDie' })
+ *   node rule-variants.js --games 200 --seed 1    # game length and seat wins per variant
+ */
+
+'use strict';
+
+const { GameEngine, BOARD, SQUARE_TYPES } = require('./game-engine.js');
+
+const BOARD_SIZE = BOARD.length;
+const GO_SALARY = 200;
+
+// =============================================================================
+// RULE MIXINS
+// =============================================================================
+
+const freeParking = Base => class extends Base {
+    newGame(playerCount, aiFactories) {
+        super.newGame(playerCount, aiFactories);
+        this.state.freeParkingPot = 0;
+    }
+
+    snapshot() {
+        return { ...super.snapshot(), freeParkingPot: this.state.freeParkingPot };
+    }
+
+    restore(snapshot, aiFactories) {
+        super.restore(snapshot, aiFactories);
+        this.state.freeParkingPot = snapshot.freeParkingPot || 0;
+    }
+
+    payBank(player, amount) {
+        // Only what the player actually had reaches the pot
+        this.state.freeParkingPot += Math.max(0, Math.min(amount, player.money));
+        super.payBank(player, amount);
+    }
+
+    handleLanding(player, position, diceRoll) {
+        if (BOARD[position].type === SQUARE_TYPES.FREE_PARKING && this.state.freeParkingPot > 0) {
+            const pot = this.state.freeParkingPot;
+            this.state.freeParkingPot = 0;
+            player.money += pot;
+            this.log(`${player.name} collected $${pot} from Free Parking`);
+        }
+        return super.handleLanding(player, position, diceRoll);
+    }
+};
+
+/** True for bases that skip the buy decision and auction every square */
+const auctionsEverySquare = Base => typeof Base.prototype.runTrackedAuction === 'function';
+
+const noAuction = Base => class extends Base {
+    runAuction(position) {
+        this.log(`${BOARD[position].name} stays with the bank`);
+    }
+
+    async runAuctionAsync(position) {
+        this.runAuction(position);
+    }
+};
+
+const doubleGo = Base => class extends Base {
+    handleLanding(player, position, diceRoll) {
+        if (position === 0) {
+            player.money += GO_SALARY;
+            this.log(`${player.name} landed on GO and collected another $${GO_SALARY}`);
+        }
+        return super.handleLanding(player, position, diceRoll);
+    }
+
+    advanceToGo(player) {
+        super.advanceToGo(player);
+        player.money += GO_SALARY;
+    }
+};
+
+const unevenBuild = Base => class extends Base {
+    isEvenBuild() {
+        return true;
+    }
+};
+
+const MR_MONOPOLY = 'monopoly';
+const BUS = 'bus';
+// Faces 1-3, two Mr. Monopoly faces, one bus
+const SPEED_FACES = [1, 2, 3, MR_MONOPOLY, MR_MONOPOLY, BUS];
+
+const speedDie = Base => class extends Base {
+    rollSpeedDie() {
+        return SPEED_FACES[Math.floor(Math.random() * 6)];
+    }
+
+    /** Next purchasable square ahead that is unowned, else one owned by an opponent */
+    mrMonopolyTarget(player) {
+        let rentTarget = null;
+        for (let k = 1; k < BOARD_SIZE; k++) {
+            const sq = (player.position + k) % BOARD_SIZE;
+            const ps = this.state.propertyStates[sq];
+            if (!ps) continue;
+            if (ps.owner === null) return sq;
+            if (rentTarget === null && ps.owner !== player.id && !ps.mortgaged) rentTarget = sq;
+        }
+        return rentTarget;
+    }
+
+    /** Bus: move one white die or both, whichever costs the least rent */
+    busMove(player, roll) {
+        let best = roll.sum;
+        let bestRent = Infinity;
+        for (const spaces of [roll.sum, roll.d1, roll.d2]) {
+            const sq = (player.position + spaces) % BOARD_SIZE;
+            const ps = this.state.propertyStates[sq];
+            const rent = ps && ps.owner !== null && ps.owner !== player.id ? this.calculateRent(sq, spaces) : 0;
+            if (rent < bestRent) { bestRent = rent; best = spaces; }
+        }
+        return best;
+    }
+
+    /** Triples: the nearest unowned property ahead, else GO */
+    triplesTarget(player) {
+        for (let k = 1; k < BOARD_SIZE; k++) {
+            const sq = (player.position + k) % BOARD_SIZE;
+            const ps = this.state.propertyStates[sq];
+            if (ps && ps.owner === null) return sq;
+        }
+        return 0;
+    }
+
+    /** Roll the white dice and the speed die together */
+    rollSpeedThrow(player) {
+        const roll = this.rollDice();
+        const speed = this.rollSpeedDie();
+        this.log(`${player.name} rolled ${roll.d1} + ${roll.d2}, speed die ${
+            speed === MR_MONOPOLY ? 'Mr. Monopoly' : speed === BUS ? 'bus' : speed}`);
+        return { roll, speed, triples: roll.isDoubles && speed === roll.d1 };
+    }
+
+    /** Spaces the white dice and the speed die move together */
+    speedSpaces(player, roll, speed) {
+        return speed === BUS ? this.busMove(player, roll)
+            : speed === MR_MONOPOLY ? roll.sum : roll.sum + speed;
+    }
+
+    handleNormalTurn(player) {
+        let doublesCount = 0;
+
+        while (true) {
+            const { roll, speed, triples } = this.rollSpeedThrow(player);
+
+            if (roll.isDoubles) {
+                doublesCount++;
+
+                if (doublesCount === 3) {
+                    this.sendToJail(player);
+                    return;
+                }
+            }
+
+            if (triples) {
+                const target = this.triplesTarget(player);
+                this.log(`${player.name} rolled triples and moves to ${BOARD[target].name}`);
+                this.movePlayer(player, (target - player.position + BOARD_SIZE) % BOARD_SIZE);
+                this.handleLanding(player, player.position, roll.sum);
+                return;
+            }
+
+            this.movePlayer(player, this.speedSpaces(player, roll, speed));
+            let result = this.handleLanding(player, player.position, roll.sum);
+            if (player.bankrupt) return;
+
+            if (speed === MR_MONOPOLY && !result.endTurn && !player.inJail) {
+                const target = this.mrMonopolyTarget(player);
+                if (target !== null) {
+                    this.log(`Mr. Monopoly sends ${player.name} on to ${BOARD[target].name}`);
+                    this.movePlayer(player, (target - player.position + BOARD_SIZE) % BOARD_SIZE);
+                    result = this.handleLanding(player, target, roll.sum);
+                    if (player.bankrupt) return;
+                }
+            }
+
+            if (result.endTurn || !roll.isDoubles) {
+                return;
+            }
+        }
+    }
+
+    /** AsyncGameEngine's turn: the same moves, with purchases awaited */
+    async handleNormalTurnAsync(player) {
+        let doublesCount = 0;
+
+        while (true) {
+            const { roll, speed, triples } = this.rollSpeedThrow(player);
+
+            if (roll.isDoubles) {
+                doublesCount++;
+                if (doublesCount === 3) {
+                    this.sendToJail(player);
+                    return;
+                }
+            }
+
+            if (triples) {
+                const target = this.triplesTarget(player);
+                this.log(`${player.name} rolled triples and moves to ${BOARD[target].name}`);
+                this.movePlayer(player, (target - player.position + BOARD_SIZE) % BOARD_SIZE);
+                await this.landAsync(player, player.position, roll.sum);
+                return;
+            }
+
+            this.movePlayer(player, this.speedSpaces(player, roll, speed));
+            let result = await this.landAsync(player, player.position, roll.sum);
+            if (player.bankrupt) return;
+
+            if (speed === MR_MONOPOLY && !result.endTurn && !player.inJail) {
+                const target = this.mrMonopolyTarget(player);
+                if (target !== null) {
+                    this.log(`Mr. Monopoly sends ${player.name} on to ${BOARD[target].name}`);
+                    this.movePlayer(player, (target - player.position + BOARD_SIZE) % BOARD_SIZE);
+                    result = await this.landAsync(player, target, roll.sum);
+                    if (player.bankrupt) return;
+                }
+            }
+
+            if (result.endTurn || !roll.isDoubles) return;
+        }
+    }
+};
+
+// =============================================================================
+// REGISTRY
+// =============================================================================
+
+const RULES = {
+    freeParking: { mixin: freeParking, description: 'Taxes and fees fund a Free Parking jackpot' },
+    noAuction: { mixin: noAuction, description: 'Declined properties are not auctioned', rejects: auctionsEverySquare },
+    doubleGo: { mixin: doubleGo, description: 'Landing on GO pays $400' },
+    unevenBuild: { mixin: unevenBuild, description: 'No even building rule' },
+    speedDie: { mixin: speedDie, description: 'Mega Edition speed die', dice: 'speed' }
+};
+
+// Composed classes per base, keyed by canonical name
+const classCache = new Map();
+
+/** Rule names in a variant ('a+b'), sorted and checked; [] for 'standard' */
+function parseVariant(name) {
+    if (!name || name === 'standard') return [];
+    const rules = [...new Set(name.split('+'))].sort();
+    for (const rule of rules) {
+        if (!RULES[rule]) {
+            throw new Error(`Unknown rule '${rule}' (known: ${Object.keys(RULES).join(', ')})`);
+        }
+    }
+    return rules;
+}
+
+/** Engine class for a variant over `Base` (GameEngine itself for 'standard') */
+function variantClass(name, Base = GameEngine) {
+    const rules = parseVariant(name);
+    if (rules.length === 0) return Base;
+
+    let byName = classCache.get(Base);
+    if (!byName) classCache.set(Base, byName = new Map());
+    const key = rules.join('+');
+    if (!byName.has(key)) {
+        for (const rule of rules) {
+            if (RULES[rule].rejects && RULES[rule].rejects(Base)) {
+                throw new Error(`Rule '${rule}' does not apply to ${Base.name}`);
+            }
+        }
+        const Variant = rules.reduce((Cls, rule) => RULES[rule].mixin(Cls), Base);
+        Object.defineProperty(Variant, 'name', { value: `${Base.name}[${key}]` });
+        byName.set(key, Variant);
+    }
+    return byName.get(key);
+}
+
+/** Markov engine dice configuration for a variant's landing probabilities */
+function variantDice(name) {
+    const rule = parseVariant(name).find(r => RULES[r].dice);
+    return rule ? RULES[rule].dice : 'classic';
+}
+
+function createEngine(name, options = {}, Base = GameEngine) {
+    const Engine = variantClass(name, Base);
+    return new Engine(options);
+}
+
+/** Every single-rule variant plus 'standard' */
+function listVariants() {
+    return ['standard', ...Object.keys(RULES)];
+}
+
+module.exports = {
+    RULES,
+    parseVariant,
+    variantClass,
+    variantDice,
+    createEngine,
+    listVariants,
+    SPEED_FACES
+};
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+function main() {
+    const args = process.argv.slice(2);
+    let games = 100;
+    let seed = 1;
+    let variants = listVariants();
+    let lineup = ['relative', 'growth', 'strategic', 'trading'];
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--games': games = parseInt(args[++i], 10); break;
+            case '--seed': seed = parseInt(args[++i], 10); break;
+            case '--variants': variants = args[++i].split(','); break;
+            case '--lineup': lineup = args[++i].split(','); break;
+        }
+    }
+
+    const { SeatSchedule } = require('./seat-schedule.js');
+    const { withSeed } = require('./seeded-random.js');
+    const { createRunner } = require('./harness.js');
+
+    console.log(`Rule variants: ${lineup.join(', ')}, ${games} games each (Latin seating, seed ${seed})\n`);
+    console.log(`${'Variant'.padEnd(26)} ${'Turns'.padStart(6)} ${'Timeouts'.padStart(9)}   Wins by entry`);
+
+    for (const name of variants) {
+        const runner = createRunner({ maxTurns: 500, rules: name });
+        const schedule = new SeatSchedule(lineup.length, { mode: 'latin', seed });
+        const wins = lineup.map(() => 0);
+        let turns = 0, timeouts = 0;
+        const start = Date.now();
+        for (let g = 0; g < games; g++) {
+            const { order, seed: gameSeed } = schedule.game(g);
+            const result = withSeed(gameSeed, () => runner.runSingleGame(order.map(e => lineup[e])));
+            turns += result.turns;
+            if (result.winner === null) timeouts++;
+            else wins[order[result.winner]]++;
+        }
+        console.log(`${name.padEnd(26)} ${(turns / games).toFixed(1).padStart(6)} ${String(timeouts).padStart(9)}   ` +
+            `[${wins.join(', ')}]  ${((Date.now() - start) / 1000).toFixed(1)}s`);
+    }
+}
+
+if (require.main === module) {
+    main();
+}
@@ -0,0 +1,246 @@
+/**
+ * Scripted Stand-in Game Server
+ *
+ * A local TCP server that plays remote seats for AsyncGameEngine tests and
+ * load runs. It speaks newline-delimited JSON:
+ *
+ *   request  {"id": 7, "type": "decideBid", "game": 3, "seat": 1, "position": 24,
+ *             "highBid": 120, "state": {...}}
+ *   reply    {"id": 7, "value": 130}
+ *
+ * Each seat answers from a named policy, or from a fixed script of answers
+ * (consumed in order per game and seat) before falling back to the policy.
+ * Optional latency simulates a real network opponent.
+ *
+ * Usage:
+ *   node scripted-server.js --port 7070 --policy cautious --latency 5
+ */
+
+'use strict';
+
+const net = require('net');
+const { BOARD } = require('./game-engine.js');
+
+// =============================================================================
+// POLICIES
+// =============================================================================
+
+const POLICIES = {
+    /** Buys with a $200 cushion, bids up to 80% of face value, sits in jail */
+    cautious(msg) {
+        const me = msg.state.players[msg.seat];
+        switch (msg.type) {
+            case 'decideBuy':
+                return me.money - BOARD[msg.position].price >= 200;
+            case 'decideBid': {
+                const limit = Math.min(Math.floor(BOARD[msg.position].price * 0.8), me.money - 200);
+                return limit > msg.highBid ? Math.min(msg.highBid + 10, limit) : 0;
+            }
+            case 'decideJail':
+                return false;
+        }
+        return null;
+    },
+
+    /** Buys whatever it can afford, bids up to 120% of face value, leaves jail */
+    aggressive(msg) {
+        const me = msg.state.players[msg.seat];
+        switch (msg.type) {
+            case 'decideBuy':
+                return me.money >= BOARD[msg.position].price;
+            case 'decideBid': {
+                const limit = Math.min(Math.floor(BOARD[msg.position].price * 1.2), me.money - 50);
+                return limit > msg.highBid ? Math.min(msg.highBid + 10, limit) : 0;
+            }
+            case 'decideJail':
+                return true;
+        }
+        return null;
+    },
+
+    /** Never buys, never bids */
+    passive(msg) {
+        return msg.type === 'decideBid' ? 0 : false;
+    }
+};
+
+// =============================================================================
+// SERVER
+// =============================================================================
+
+class ScriptedServer {
+    /**
+     * @param {Object} options
+     *   policy   - default policy name
+     *   seats    - { seat: policyName } overrides
+     *   script   - { seat: [answers...] } replayed in order per game before the policy
+     *   latency  - [min, max] ms added to every reply (or a single number)
+     */
+    constructor(options = {}) {
+        this.options = {
+            policy: 'cautious',
+            seats: {},
+            script: {},
+            latency: 0,
+            ...options
+        };
+        this.server = null;
+        this.scriptCursor = new Map();   // "game:seat" -> next script index
+        this.stats = { requests: 0, scripted: 0, connections: 0 };
+    }
+
+    answer(msg) {
+        this.stats.requests++;
+
+        const script = this.options.script[msg.seat];
+        if (script) {
+            const key = `${msg.game}:${msg.seat}`;
+            const cursor = this.scriptCursor.get(key) || 0;
+            if (cursor < script.length) {
+                this.scriptCursor.set(key, cursor + 1);
+                this.stats.scripted++;
+                return script[cursor];
+            }
+        }
+
+        const policyName = this.options.seats[msg.seat] || this.options.policy;
+        const policy = POLICIES[policyName];
+        if (!policy) throw new Error(`Unknown policy: ${policyName}`);
+        return policy(msg);
+    }
+
+    delay() {
+        const latency = this.options.latency;
+        if (!latency) return 0;
+        if (Array.isArray(latency)) {
+            return latency[0] + Math.random() * (latency[1] - latency[0]);
+        }
+        return latency;
+    }
+
+    handleConnection(socket) {
+        this.stats.connections++;
+        let buffer = '';
+
+        socket.setNoDelay(true);
+        socket.on('data', (chunk) => {
+            buffer += chunk;
+            let newline;
+            while ((newline = buffer.indexOf('\n')) >= 0) {
+                const line = buffer.slice(0, newline);
+                buffer = buffer.slice(newline + 1);
+                if (!line) continue;
+
+                const msg = JSON.parse(line);
+                const reply = JSON.stringify({ id: msg.id, value: this.answer(msg) }) + '\n';
+                const wait = this.delay();
+                if (wait > 0) {
+                    setTimeout(() => socket.write(reply), wait);
+                } else {
+                    socket.write(reply);
+                }
+            }
+        });
+        socket.on('error', () => {});
+    }
+
+    /**
+     * Start listening. Port 0 picks a free port.
+     * @returns {Promise<number>} the bound port
+     */
+    listen(port = 0, host = '127.0.0.1') {
+        return new Promise((resolve, reject) => {
+            this.server = net.createServer(socket => this.handleConnection(socket));
+            this.server.once('error', reject);
+            this.server.listen(port, host, () => resolve(this.server.address().port));
+        });
+    }
+
+    close() {
+        return new Promise(resolve => this.server ? this.server.close(() => resolve()) : resolve());
+    }
+}
+
+// =============================================================================
+// CLIENT TRANSPORT
+// =============================================================================
+
+/**
+ * One TCP connection shared by every RemoteSource in the process.
+ * Requests are matched to replies by id, so many games can wait at once.
+ */
+class SocketTransport {
+    constructor() {
+        this.socket = null;
+        this.nextId = 1;
+        this.pending = new Map();
+        this.buffer = '';
+    }
+
+    connect(port, host = '127.0.0.1') {
+        return new Promise((resolve, reject) => {
+            this.socket = net.createConnection({ port, host }, resolve);
+            this.socket.setNoDelay(true);
+            this.socket.once('error', reject);
+            this.socket.on('data', chunk => this.onData(chunk));
+            this.socket.on('close', () => {
+                for (const { reject: fail } of this.pending.values()) {
+                    fail(new Error('Connection closed'));
+                }
+                this.pending.clear();
+            });
+        });
+    }
+
+    onData(chunk) {
+        this.buffer += chunk;
+        let newline;
+        while ((newline = this.buffer.indexOf('\n')) >= 0) {
+            const line = this.buffer.slice(0, newline);
+            this.buffer = this.buffer.slice(newline + 1);
+            if (!line) continue;
+
+            const reply = JSON.parse(line);
+            const waiter = this.pending.get(reply.id);
+            if (waiter) {
+                this.pending.delete(reply.id);
+                waiter.resolve(reply);
+            }
+        }
+    }
+
+    request(message) {
+        const id = this.nextId++;
+        return new Promise((resolve, reject) => {
+            this.pending.set(id, { resolve, reject });
+            this.socket.write(JSON.stringify({ id, ...message }) + '\n');
+        });
+    }
+
+    close() {
+        if (this.socket) this.socket.end();
+    }
+}
+
+module.exports = { ScriptedServer, SocketTransport, POLICIES };
+
+// =============================================================================
+// CLI ENTRY POINT
+// =============================================================================
+
+if (require.main === module) {
+    const args = process.argv.slice(2);
+    const options = { port: 7070 };
+    for (let i = 0; i < args.length; i++) {
+        switch (args[i]) {
+            case '--port': options.port = parseInt(args[++i], 10); break;
+            case '--policy': options.policy = args[++i]; break;
+            case '--latency': options.latency = parseFloat(args[++i]); break;
+        }
+    }
+
+    const server = new ScriptedServer(options);
+    server.listen(options.port).then(port => {
+        console.log(`Scripted server listening on 127.0.0.1:${port} (policy: ${server.options.policy})`);
+    });
+}
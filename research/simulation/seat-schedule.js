@@ -0,0 +1,157 @@
+/**
+ * Seat-Balanced Game Schedules
+ *
+ * seat-analysis.js shows that seat order biases results. A runner that
+ * always seats a lineup in the same order folds that bias into every
+ * AI's win rate. A SeatSchedule instead plays games in blocks, where
+ * every lineup entry sits in every seat exactly once per block:
+ *
+ *   cyclic  n games per block - rotations of the lineup. Each entry keeps
+ *           the same neighbours.
+ *   latin   Williams balanced Latin square: n games per block (2n when n
+ *           is odd). Each entry also directly follows every other entry
+ *           equally often.
+ *   fixed   1 game per block, lineup order as given (old behaviour).
+ *
+ * With a seed, every game in block b uses seed deriveSeed(seed, b).
+ * The permutations of a block therefore share their dice stream (common
+ * random numbers): seat bias cancels within each complete block, and
+ * so does most of the luck of the roll. SeatStats reports per-seat win
+ * rates as a by-product, plus each entry's standard error measured
+ * across blocks.
+ *
+ * Usage:
+ *   const schedule = new SeatSchedule(4, { mode: 'latin', seed: 42 });
+ *   const { order, seed } = schedule.game(i);       // order[seat] = lineup index
+ *   const seated = order.map(p => aiTypes[p]);
+ */
+
+'use strict';
+
+const { deriveSeed } = require('./seeded-random.js');
+
+const SEATING_MODES = ['fixed', 'cyclic', 'latin'];
+
+/**
+ * Williams design rows for n treatments: a Latin square (mirrored for odd n)
+ * in which every ordered pair appears in adjacent columns equally often.
+ */
+function williamsSquare(n) {
+    const first = [0];
+    for (let lo = 1, hi = n - 1; first.length < n;) {
+        first.push(lo++);
+        if (first.length < n) first.push(hi--);
+    }
+    const rows = [];
+    for (let r = 0; r < n; r++) rows.push(first.map(v => (v + r) % n));
+    if (n % 2 === 1) {
+        for (let r = 0; r < n; r++) rows.push(rows[r].slice().reverse());
+    }
+    return rows;
+}
+
+function cyclicRotations(n) {
+    return Array.from({ length: n }, (_, r) => Array.from({ length: n }, (_, k) => (k + r) % n));
+}
+
+class SeatSchedule {
+    /**
+     * @param {number} numPlayers
+     * @param {Object} options - { mode: 'fixed'|'cyclic'|'latin', seed }
+     */
+    constructor(numPlayers, options = {}) {
+        this.mode = options.mode || 'cyclic';
+        this.seed = options.seed;
+        if (!SEATING_MODES.includes(this.mode)) {
+            throw new Error(`Unknown seating mode: ${this.mode} (expected ${SEATING_MODES.join(', ')})`);
+        }
+        switch (this.mode) {
+            case 'fixed': this.block = [Array.from({ length: numPlayers }, (_, k) => k)]; break;
+            case 'cyclic': this.block = cyclicRotations(numPlayers); break;
+            case 'latin': this.block = williamsSquare(numPlayers); break;
+        }
+    }
+
+    get blockSize() {
+        return this.block.length;
+    }
+
+    /**
+     * Seating for game i.
+     * @returns {{order: number[], block: number, seed: number|undefined}}
+     */
+    game(i) {
+        const block = Math.floor(i / this.block.length);
+        return {
+            order: this.block[i % this.block.length],
+            block,
+            seed: this.seed === undefined ? undefined : deriveSeed(this.seed, block)
+        };
+    }
+}
+
+/**
+ * Per-seat and per-entry win statistics for a scheduled run.
+ */
+class SeatStats {
+    constructor(numPlayers, blockSize) {
+        this.numPlayers = numPlayers;
+        this.blockSize = blockSize;
+        this.seatGames = 0;
+        this.seatWins = new Array(numPlayers).fill(0);
+        this.blockWins = [];
+    }
+
+    /**
+     * @param {number[]} order - order[seat] = lineup index
+     * @param {number|null} winnerSeat
+     * @param {number} block
+     */
+    record(order, winnerSeat, block) {
+        this.seatGames++;
+        if (!this.blockWins[block]) this.blockWins[block] = { games: 0, wins: new Array(this.numPlayers).fill(0) };
+        const b = this.blockWins[block];
+        b.games++;
+        if (winnerSeat !== null && winnerSeat !== undefined) {
+            this.seatWins[winnerSeat]++;
+            b.wins[order[winnerSeat]]++;
+        }
+    }
+
+    /**
+     * Win rate per lineup entry over complete blocks, with the standard
+     * error of the block means (NaN with fewer than two blocks).
+     */
+    entrySummary() {
+        const blocks = this.blockWins.filter(b => b && b.games === this.blockSize);
+        return Array.from({ length: this.numPlayers }, (_, p) => {
+            const rates = blocks.map(b => b.wins[p] / b.games);
+            const mean = rates.reduce((s, r) => s + r, 0) / Math.max(1, rates.length);
+            const variance = rates.length > 1
+                ? rates.reduce((s, r) => s + (r - mean) * (r - mean), 0) / (rates.length - 1)
+                : NaN;
+            return { rate: mean, se: Math.sqrt(variance / rates.length), blocks: rates.length };
+        });
+    }
+
+    print(aiTypes, mode) {
+        console.log(`\nSEATING (${mode}, ${this.blockSize} games per block):`);
+        console.log('-'.repeat(40));
+        for (let s = 0; s < this.numPlayers; s++) {
+            const rate = this.seatWins[s] / Math.max(1, this.seatGames);
+            const se = Math.sqrt(rate * (1 - rate) / Math.max(1, this.seatGames));
+            console.log(`  Seat ${s + 1}: ${this.seatWins[s]} wins (${(rate * 100).toFixed(1)}% +/- ${(se * 100).toFixed(1)}%)`);
+        }
+        if (this.blockSize > 1) {
+            const entries = this.entrySummary();
+            const binomial = (r) => Math.sqrt(r * (1 - r) / Math.max(1, entries[0].blocks * this.blockSize));
+            console.log(`  By player over ${entries[0].blocks} complete blocks (block SE vs independent-game SE):`);
+            entries.forEach((e, p) => {
+                console.log(`    Player ${p + 1} (${aiTypes[p]}): ${(e.rate * 100).toFixed(1)}% ` +
+                    `+/- ${(e.se * 100).toFixed(1)}% (vs ${(binomial(e.rate) * 100).toFixed(1)}%)`);
+            });
+        }
+    }
+}
+
+module.exports = { SeatSchedule, SeatStats, williamsSquare, SEATING_MODES };
@@ -0,0 +1,75 @@
+/**
+ * Seeded Random Number Generation
+ *
+ * The engine and every AI draw randomness from Math.random(), so the
+ * only way to make a game reproducible without touching the AIs is to
+ * swap Math.random() for a seeded generator while the game runs.
+ *
+ * Used by the benchmarks and tournament tools that need fixed seeds.
+ */
+
+'use strict';
+
+/**
+ * Mulberry32 - small, fast 32-bit PRNG with good statistical quality
+ * for simulation work. Returns a function with the Math.random() contract.
+ *
+ * @param {number} seed - 32-bit integer seed
+ * @returns {function(): number} Generator returning floats in [0, 1)
+ */
+function createRandom(seed) {
+    let a = seed >>> 0;
+    return function random() {
+        a = (a + 0x6D2B79F5) >>> 0;
+        let t = a;
+        t = Math.imul(t ^ (t >>> 15), t | 1);
+        t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+}
+
+/**
+ * Derive a well-mixed 32-bit seed from a base seed and a stream index
+ * (e.g. one stream per game in a tournament).
+ */
+function deriveSeed(baseSeed, index) {
+    let h = (baseSeed ^ Math.imul(index + 1, 0x9E3779B1)) >>> 0;
+    h = Math.imul(h ^ (h >>> 16), 0x85EBCA6B) >>> 0;
+    h = Math.imul(h ^ (h >>> 13), 0xC2B2AE35) >>> 0;
+    return (h ^ (h >>> 16)) >>> 0;
+}
+
+/**
+ * Run fn with Math.random() replaced by a seeded generator.
+ * The original Math.random() is always restored, even if fn throws.
+ *
+ * @param {number} seed - Seed for this run
+ * @param {function} fn - Work to run under the seeded generator
+ * @returns {*} Whatever fn returns
+ */
+function withSeed(seed, fn) {
+    const original = Math.random;
+    Math.random = createRandom(seed);
+    try {
+        return fn();
+    } finally {
+        Math.random = original;
+    }
+}
+
+/**
+ * Async form of withSeed: keeps the seeded generator installed until the
+ * returned promise settles. Only meaningful when nothing else drawing from
+ * Math.random() runs in the meantime (e.g. one game at a time).
+ */
+async function withSeedAsync(seed, fn) {
+    const original = Math.random;
+    Math.random = createRandom(seed);
+    try {
+        return await fn();
+    } finally {
+        Math.random = original;
+    }
+}
+
+module.exports = { createRandom, deriveSeed, withSeed, withSeedAsync };
@@ -547,6 +547,7 @@ class InstrumentedGameEngine extends GameEngine {
             highBidder.money -= highBid;
             highBidder.properties.add(position);
             this.state.propertyStates[position].owner = highBidder.id;
+            this.propertyChanged(position);
             this.log(`${highBidder.name} won auction for ${square.name} at $${highBid}`);
         }
 
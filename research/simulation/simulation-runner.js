@@ -15,9 +15,11 @@ const { CompetitiveTradingAI } = require('./competitive-trading-ai.js');
 const { GrowthTradingAI } = require('./growth-trading-ai.js');
 const { LeaderAwareAI } = require('./leader-aware-ai.js');
 const { RelativeGrowthAI } = require('./relative-growth-ai.js');
+const { SeatSchedule, SeatStats } = require('./seat-schedule.js');
+const { withSeed } = require('./seeded-random.js');
 
 // Enhanced Relative AI variants (auction improvements)
-let EnhancedRelativeAI, EnhancedRelativeOptimal, EnhancedRelative5, EnhancedRelative10, EnhancedRelative15, EnhancedRelativeNoDebt, EnhancedRelativeSmartBlock;
+let EnhancedRelativeAI, EnhancedRelativeOptimal, EnhancedRelative5, EnhancedRelative10, EnhancedRelative15, EnhancedRelativeNoDebt, EnhancedRelativeSmartBlock, EnhancedRelativeMDPJail;
 try {
     const enhancedModule = require('./enhanced-relative-ai.js');
     EnhancedRelativeAI = enhancedModule.EnhancedRelativeAI;
@@ -27,6 +29,7 @@ try {
     EnhancedRelative15 = enhancedModule.EnhancedRelative15;
     EnhancedRelativeNoDebt = enhancedModule.EnhancedRelativeNoDebt;
     EnhancedRelativeSmartBlock = enhancedModule.EnhancedRelativeSmartBlock;
+    EnhancedRelativeMDPJail = enhancedModule.EnhancedRelativeMDPJail;
 } catch (e) {
     console.log('Note: Enhanced Relative AIs not available');
 }
@@ -44,6 +47,22 @@ try {
     console.log('Note: Strategic Trade AI not available');
 }
 
+// Equilibrium-table bidder (auction-equilibrium.js)
+let EquilibriumBidderAI;
+try {
+    EquilibriumBidderAI = require('./equilibrium-bidder-ai.js').EquilibriumBidderAI;
+} catch (e) {
+    console.log('Note: Equilibrium bidder AI not available');
+}
+
+// House-supply strategist (house-bank.js)
+let HouseStarverAI;
+try {
+    HouseStarverAI = require('./house-starver-ai.js').HouseStarverAI;
+} catch (e) {
+    console.log('Note: House starver AI not available');
+}
+
 // Premium trading AI variants
 let PremiumTrader5, PremiumTrader10, PremiumTrader20;
 try {
@@ -88,6 +107,8 @@ class SimulationRunner {
             maxTurns: options.maxTurns || 500,
             verbose: options.verbose || false,
             progressInterval: options.progressInterval || 10,
+            seating: options.seating || 'fixed',   // 'fixed', 'cyclic' or 'latin' (see seat-schedule.js)
+            seed: options.seed,                    // seeds each seating block (common random numbers)
             ...options
         };
 
@@ -97,7 +118,9 @@ class SimulationRunner {
 
         if (MarkovEngine) {
             console.log('Initializing Markov engine...');
-            this.markovEngine = new MarkovEngine();
+            // Speed-die variants value squares by their own landing probabilities
+            const dice = this.options.rules ? require('./rule-variants.js').variantDice(this.options.rules) : 'classic';
+            this.markovEngine = new MarkovEngine({ dice });
             this.markovEngine.initialize();
 
             if (PropertyValuator) {
@@ -207,6 +230,18 @@ class SimulationRunner {
                     return EnhancedRelativeSmartBlock ?
                         new EnhancedRelativeSmartBlock(player, engine, self.markovEngine, self.valuator) :
                         new RelativeGrowthAI(player, engine, self.markovEngine, self.valuator);
+                case 'equilibrium':
+                    return EquilibriumBidderAI ?
+                        new EquilibriumBidderAI(player, engine, self.markovEngine, self.valuator) :
+                        new RelativeGrowthAI(player, engine, self.markovEngine, self.valuator);
+                case 'starver':
+                    return HouseStarverAI ?
+                        new HouseStarverAI(player, engine, self.markovEngine, self.valuator) :
+                        new RelativeGrowthAI(player, engine, self.markovEngine, self.valuator);
+                case 'mdpjail':
+                    return EnhancedRelativeMDPJail ?
+                        new EnhancedRelativeMDPJail(player, engine, self.markovEngine, self.valuator) :
+                        new RelativeGrowthAI(player, engine, self.markovEngine, self.valuator);
                 // Strategic Trade AI variants (trade quality filtering)
                 case 'strategic':
                 case 'strategic-trade':
@@ -234,9 +269,14 @@ class SimulationRunner {
      * Run a single game
      */
     runSingleGame(aiTypes, gameOptions = {}) {
-        const engine = new GameEngine({
+        // options.rules picks a house-rule variant (see rule-variants.js)
+        const Engine = this.options.rules
+            ? require('./rule-variants.js').variantClass(this.options.rules) : GameEngine;
+        const engine = new Engine({
             maxTurns: this.options.maxTurns,
             verbose: this.options.verbose,
+            adjudicate: this.options.adjudicate,
+            houseAuctions: this.options.houseAuctions,
             ...gameOptions
         });
 
@@ -247,7 +287,10 @@ class SimulationRunner {
     }
 
     /**
-     * Run multiple games and collect statistics
+     * Run multiple games and collect statistics. Wins, and each entry of
+     * gameResults (winner; seatWinner and order keep the seating), are
+     * indexed by position in aiTypes; with options.seating the seats each
+     * entry takes follow a SeatSchedule.
      */
     runSimulation(aiTypes, numGames = null) {
         numGames = numGames || this.options.games;
@@ -255,29 +298,43 @@ class SimulationRunner {
         console.log(`\nRunning ${numGames} games with AI types: ${aiTypes.join(', ')}`);
         console.log('='.repeat(60));
 
+        const schedule = new SeatSchedule(aiTypes.length, { mode: this.options.seating, seed: this.options.seed });
+        const seatStats = new SeatStats(aiTypes.length, schedule.blockSize);
+
         const results = {
             games: numGames,
             aiTypes,
-            wins: new Array(aiTypes.length).fill(0),
+            wins: new Array(aiTypes.length).fill(0),             // every decided game
             totalTurns: 0,
             avgTurns: 0,
             timeouts: 0,
+            adjudicated: 0,
+            adjudicatedWins: new Array(aiTypes.length).fill(0),  // the part of wins the tablebase decided
             gameResults: []
         };
 
         const startTime = Date.now();
 
         for (let i = 0; i < numGames; i++) {
-            const gameResult = this.runSingleGame(aiTypes);
-
-            if (gameResult.winner !== null) {
-                results.wins[gameResult.winner]++;
+            const { order, block, seed } = schedule.game(i);
+            const play = () => this.runSingleGame(order.map(p => aiTypes[p]));
+            const gameResult = seed === undefined ? play() : withSeed(seed, play);
+            const winner = gameResult.winner !== null ? order[gameResult.winner] : null;
+            seatStats.record(order, gameResult.winner, block);
+
+            if (winner !== null) {
+                results.wins[winner]++;
             } else {
                 results.timeouts++;
             }
+            if (gameResult.adjudicated) {
+                results.adjudicated++;
+                if (winner !== null) results.adjudicatedWins[winner]++;
+            }
 
             results.totalTurns += gameResult.turns;
-            results.gameResults.push(gameResult);
+            // Per-game records use the same lineup-entry indexing as wins
+            results.gameResults.push({ ...gameResult, winner, seatWinner: gameResult.winner, order });
 
             // Progress update
             if ((i + 1) % this.options.progressInterval === 0) {
@@ -290,8 +347,15 @@ class SimulationRunner {
         const totalTime = (Date.now() - startTime) / 1000;
         results.avgTurns = results.totalTurns / numGames;
         results.timeSeconds = totalTime;
+        results.seating = {
+            mode: schedule.mode,
+            blockSize: schedule.blockSize,
+            seatWins: seatStats.seatWins,
+            entries: seatStats.entrySummary()
+        };
 
         this.printResults(results);
+        if (schedule.mode !== 'fixed') seatStats.print(aiTypes, schedule.mode);
 
         return results;
     }
@@ -308,6 +372,10 @@ class SimulationRunner {
         console.log(`Time: ${results.timeSeconds.toFixed(1)} seconds`);
         console.log(`Average turns per game: ${results.avgTurns.toFixed(1)}`);
         console.log(`Timeouts (no winner): ${results.timeouts}`);
+        if (results.adjudicated) {
+            console.log(`Adjudicated early: ${results.adjudicated} ` +
+                `(wins by lineup entry: ${results.adjudicatedWins.join(', ')})`);
+        }
 
         // Game length distribution
         const gameLengths = results.gameResults.map(r => r.turns).sort((a, b) => a - b);
@@ -322,12 +390,16 @@ class SimulationRunner {
             console.log(`Std deviation: ${stdDev.toFixed(1)} turns`);
         }
 
-        console.log('\nWIN RATES:');
+        // wins counts adjudicated games too; split them out whenever there were any
+        console.log(results.adjudicated ? '\nWIN RATES (wins = played out + adjudicated):' : '\nWIN RATES:');
         console.log('-'.repeat(40));
 
         for (let i = 0; i < results.aiTypes.length; i++) {
             const winRate = (results.wins[i] / results.games * 100).toFixed(1);
-            console.log(`  Player ${i + 1} (${results.aiTypes[i]}): ${results.wins[i]} wins (${winRate}%)`);
+            const adjudicated = results.adjudicatedWins[i];
+            const split = results.adjudicated ?
+                ` = ${results.wins[i] - adjudicated} played out + ${adjudicated} adjudicated` : '';
+            console.log(`  Player ${i + 1} (${results.aiTypes[i]}): ${results.wins[i]} wins (${winRate}%)${split}`);
         }
 
         // Additional statistics
@@ -0,0 +1,196 @@
+/**
+ * Packed State View
+ *
+ * A flat, typed-array mirror of GameState for code that scans the board
+ * on every decision (valuation, rent flow, tablebases). The view owns its
+ * buffers and is refreshed in place with sync(), so reading it allocates
+ * nothing - unlike GameState.clone(), which rebuilds every player and
+ * round-trips propertyStates through JSON.
+ *
+ * Board constants (price, rent ladder, group membership) are packed once
+ * at module load and shared by every view.
+ *
+ * Usage:
+ *   const view = engine.getStateView();   // synced to engine.state
+ *   view.owner[24], view.houses[24], view.money[playerId]
+ *   view.rent(24, 7)                      // same result as engine.calculateRent
+ */
+
+'use strict';
+
+const {
+    BOARD,
+    BOARD_SIZE,
+    COLOR_GROUPS,
+    RAILROAD_RENT,
+    UTILITY_MULTIPLIER,
+    SQUARE_TYPES
+} = require('./game-engine.js');
+
+// =============================================================================
+// PACKED BOARD CONSTANTS
+// =============================================================================
+
+const KIND_NONE = 0;
+const KIND_PROPERTY = 1;
+const KIND_RAILROAD = 2;
+const KIND_UTILITY = 3;
+
+const GROUP_NAMES = Object.keys(COLOR_GROUPS);
+const RAILROAD_SQUARES = [5, 15, 25, 35];
+const UTILITY_SQUARES = [12, 28];
+
+const SQUARE_KIND = new Uint8Array(BOARD_SIZE);
+const SQUARE_GROUP = new Int8Array(BOARD_SIZE).fill(-1);
+const PRICE = new Float64Array(BOARD_SIZE);
+const HOUSE_PRICE = new Float64Array(BOARD_SIZE);
+const RENT = new Float64Array(BOARD_SIZE * 6);      // rent[sq * 6 + houses]
+
+for (let sq = 0; sq < BOARD_SIZE; sq++) {
+    const square = BOARD[sq];
+    if (square.type === SQUARE_TYPES.PROPERTY) SQUARE_KIND[sq] = KIND_PROPERTY;
+    else if (square.type === SQUARE_TYPES.RAILROAD) SQUARE_KIND[sq] = KIND_RAILROAD;
+    else if (square.type === SQUARE_TYPES.UTILITY) SQUARE_KIND[sq] = KIND_UTILITY;
+
+    PRICE[sq] = square.price || 0;
+    HOUSE_PRICE[sq] = square.housePrice || 0;
+    if (square.group) SQUARE_GROUP[sq] = GROUP_NAMES.indexOf(square.group);
+    if (square.rent) {
+        for (let h = 0; h < 6; h++) RENT[sq * 6 + h] = square.rent[h];
+    }
+}
+
+const GROUP_SQUARES = GROUP_NAMES.map(name => Int8Array.from(COLOR_GROUPS[name].squares));
+
+// =============================================================================
+// STATE VIEW
+// =============================================================================
+
+const FLAG_IN_JAIL = 1;
+const FLAG_BANKRUPT = 2;
+
+class StateView {
+    constructor(playerCount = 4) {
+        this.playerCount = playerCount;
+
+        // Per-square (index = board position)
+        this.owner = new Int8Array(BOARD_SIZE).fill(-1);
+        this.houses = new Uint8Array(BOARD_SIZE);
+        this.mortgaged = new Uint8Array(BOARD_SIZE);
+
+        // Per-player (index = player id)
+        this.money = new Float64Array(playerCount);
+        this.position = new Uint8Array(playerCount);
+        this.jailTurns = new Uint8Array(playerCount);
+        this.flags = new Uint8Array(playerCount);
+        this.railroadCount = new Uint8Array(playerCount);
+        this.utilityCount = new Uint8Array(playerCount);
+
+        // Per-group monopoly owner (-1 = none)
+        this.monopolyOwner = new Int8Array(GROUP_NAMES.length).fill(-1);
+
+        this.turn = 0;
+        this.currentPlayer = 0;
+        this.housesAvailable = 32;
+        this.hotelsAvailable = 12;
+    }
+
+    /**
+     * Refresh every buffer from a GameState in place. No allocation.
+     *
+     * @param {GameState} state
+     * @returns {StateView} this
+     */
+    sync(state) {
+        const props = state.propertyStates;
+
+        for (let sq = 0; sq < BOARD_SIZE; sq++) {
+            const ps = props[sq];
+            if (ps === undefined) continue;
+            this.owner[sq] = ps.owner === null ? -1 : ps.owner;
+            this.houses[sq] = ps.houses;
+            this.mortgaged[sq] = ps.mortgaged ? 1 : 0;
+        }
+
+        for (let i = 0; i < this.playerCount; i++) {
+            const p = state.players[i];
+            this.money[i] = p.money;
+            this.position[i] = p.position;
+            this.jailTurns[i] = p.jailTurns;
+            this.flags[i] = (p.inJail ? FLAG_IN_JAIL : 0) | (p.bankrupt ? FLAG_BANKRUPT : 0);
+            this.railroadCount[i] = 0;
+            this.utilityCount[i] = 0;
+        }
+
+        for (const sq of RAILROAD_SQUARES) {
+            if (this.owner[sq] >= 0) this.railroadCount[this.owner[sq]]++;
+        }
+        for (const sq of UTILITY_SQUARES) {
+            if (this.owner[sq] >= 0) this.utilityCount[this.owner[sq]]++;
+        }
+
+        for (let g = 0; g < GROUP_SQUARES.length; g++) {
+            const squares = GROUP_SQUARES[g];
+            const first = this.owner[squares[0]];
+            let owner = first;
+            for (let k = 1; k < squares.length; k++) {
+                if (this.owner[squares[k]] !== first) {
+                    owner = -1;
+                    break;
+                }
+            }
+            this.monopolyOwner[g] = owner;
+        }
+
+        this.turn = state.turn;
+        this.currentPlayer = state.currentPlayerIndex;
+        this.housesAvailable = state.housesAvailable;
+        this.hotelsAvailable = state.hotelsAvailable;
+        return this;
+    }
+
+    inJail(playerId) {
+        return (this.flags[playerId] & FLAG_IN_JAIL) !== 0;
+    }
+
+    isBankrupt(playerId) {
+        return (this.flags[playerId] & FLAG_BANKRUPT) !== 0;
+    }
+
+    /**
+     * Rent due on landing at a square; mirrors GameEngine.calculateRent
+     */
+    rent(sq, diceRoll = 7) {
+        const owner = this.owner[sq];
+        if (owner < 0 || this.mortgaged[sq]) return 0;
+
+        switch (SQUARE_KIND[sq]) {
+            case KIND_RAILROAD:
+                return RAILROAD_RENT[this.railroadCount[owner]];
+            case KIND_UTILITY:
+                return UTILITY_MULTIPLIER[this.utilityCount[owner]] * diceRoll;
+            case KIND_PROPERTY: {
+                const h = this.houses[sq];
+                if (h > 0) return RENT[sq * 6 + h];
+                const base = RENT[sq * 6];
+                return this.monopolyOwner[SQUARE_GROUP[sq]] === owner ? base * 2 : base;
+            }
+        }
+        return 0;
+    }
+}
+
+module.exports = {
+    StateView,
+    SQUARE_KIND,
+    SQUARE_GROUP,
+    GROUP_NAMES,
+    GROUP_SQUARES,
+    PRICE,
+    HOUSE_PRICE,
+    RENT,
+    KIND_NONE,
+    KIND_PROPERTY,
+    KIND_RAILROAD,
+    KIND_UTILITY
+};
@@ -0,0 +1,78 @@
+/**
+ * Test game adjudication
+ */
+
+'use strict';
+
+const { GameEngine, COLOR_GROUPS } = require('./game-engine.js');
+const { Adjudicator } = require('./adjudicator.js');
+const { withSeed } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const check = createCheck();
+
+    const play = (seed, adjudicate) => withSeed(seed, () => quietly(() => {
+        const engine = new GameEngine({ maxTurns: 300, adjudicate });
+        engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+        return engine.runGame();
+    }));
+
+    header('TESTING GAME ADJUDICATION');
+
+    // Test 1: Shadow mode records a verdict without changing the game
+    console.log('\n--- TEST 1: Shadow mode ---');
+    {
+        let same = 0;
+        let verdicts = 0;
+        for (let seed = 1; seed <= 10; seed++) {
+            const plain = play(seed);
+            const shadow = play(seed, { shadow: true });
+            if (plain.winner === shadow.winner && plain.turns === shadow.turns &&
+                plain.adjudicated === undefined && shadow.adjudicated === false) same++;
+            if (shadow.adjudication) verdicts++;
+        }
+        check(same === 10, `10 games identical with shadow adjudication (${verdicts} verdicts)`,
+            `${10 - same} games changed`);
+    }
+
+    // Test 2: A confident estimator stops the game at the first checkpoint
+    console.log('\n--- TEST 2: Stop at verdict ---');
+    {
+        const estimator = (engine) => engine.state.players.map(p => p.id === 2 ? 0.99 : 0.0033);
+        const result = play(3, { estimator, every: 10, minTurn: 20 });
+        check(result.adjudicated && result.winner === 2 && result.turns === 20 &&
+            result.adjudication.reason === 'confidence',
+            'Adjudicated for player 2 at round 20',
+            `adjudicated=${result.adjudicated} winner=${result.winner} turns=${result.turns}`);
+    }
+
+    // Test 3: Table estimate is a distribution and sees a lopsided board
+    console.log('\n--- TEST 3: Tablebase estimate ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(3, []);
+        for (const group of ['green', 'darkBlue']) {
+            for (const sq of COLOR_GROUPS[group].squares) {
+                engine.state.propertyStates[sq].owner = 1;
+                engine.state.propertyStates[sq].houses = 5;
+                engine.state.players[1].properties.add(sq);
+            }
+        }
+        engine.state.players[0].money = 300;
+        engine.state.players[2].money = 300;
+
+        const p = new Adjudicator(engine).estimate();
+        const total = p.reduce((s, x) => s + x, 0);
+        check(Math.abs(total - 1) < 1e-9 && p[1] > 0.95,
+            `Sums to 1; hotel owner P(win) = ${p[1].toFixed(3)}`,
+            `Estimate ${p.map(x => x.toFixed(3)).join(', ')}`);
+    }
+
+    summary(check, 'ALL ADJUDICATION TESTS PASSED');
+}
+
+main();
@@ -0,0 +1,173 @@
+/**
+ * Test the async engine against the synchronous engine and a scripted server
+ */
+
+'use strict';
+
+const { GameEngine } = require('./game-engine.js');
+const { AsyncGameEngine, RemoteSource, runConcurrentGames } = require('./async-game-engine.js');
+const { ScriptedServer, SocketTransport } = require('./scripted-server.js');
+const { withSeed, withSeedAsync } = require('./seeded-random.js');
+const { createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+async function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const check = createCheck();
+
+    header('TESTING ASYNC GAME ENGINE');
+
+    // Test 1: Local AIs under a fixed seed play the same game as GameEngine
+    console.log('\n--- TEST 1: Parity with synchronous engine ---');
+    {
+        let mismatches = 0;
+        const games = 20;
+        for (let seed = 1; seed <= games; seed++) {
+            const sync = withSeed(seed, () => {
+                const engine = new GameEngine({ maxTurns: 300 });
+                engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+                return engine.runGame();
+            });
+            const async = await withSeedAsync(seed, () => {
+                const engine = new AsyncGameEngine({ maxTurns: 300, yieldEvery: 0 });
+                engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+                return engine.runGameAsync();
+            });
+
+            const same = sync.winner === async.winner &&
+                sync.turns === async.turns &&
+                sync.finalState.players.every((p, i) => p.money === async.finalState.players[i].money);
+            if (!same) {
+                mismatches++;
+                console.log(`  seed ${seed}: sync winner ${sync.winner} @${sync.turns}, ` +
+                    `async winner ${async.winner} @${async.turns}`);
+            }
+        }
+        check(mismatches === 0,
+            `${games}/${games} seeded games identical`,
+            `${mismatches}/${games} games differ`);
+    }
+
+    const server = new ScriptedServer({ policy: 'cautious', seats: { 3: 'passive' }, latency: [1, 4] });
+    const port = await server.listen(0);
+    const transport = new SocketTransport();
+    await transport.connect(port);
+
+    // Test 2: A passive remote seat never buys or wins an auction
+    console.log('\n--- TEST 2: Scripted passive remote seat ---');
+    {
+        const engine = new AsyncGameEngine({ maxTurns: 100 });
+        engine.newGame(4, [
+            runner.createAIFactory('strategic'),
+            runner.createAIFactory('relative'),
+            runner.createAIFactory('growth'),
+            new RemoteSource(transport, 'passive-game', 3)
+        ]);
+        await engine.runGameAsync();
+
+        const remote = engine.state.players[3];
+        check(remote.properties.size === 0 && server.stats.requests > 0,
+            `Remote seat answered ${server.stats.requests} requests and owns nothing`,
+            `Passive seat owns ${remote.properties.size} properties`);
+    }
+
+    // Test 3: Scripted answers are replayed in order before the policy
+    console.log('\n--- TEST 3: Script replay ---');
+    {
+        const scripted = new ScriptedServer({ policy: 'passive', script: { 0: [true] } });
+        const scriptedPort = await scripted.listen(0);
+        const conn = new SocketTransport();
+        await conn.connect(scriptedPort);
+
+        const engine = new AsyncGameEngine({ maxTurns: 30 });
+        engine.newGame(2, [new RemoteSource(conn, 'script-game', 0), null]);
+        await engine.runGameAsync();
+
+        const bought = engine.state.stats.propertiesBought[0];
+        check(scripted.stats.scripted === 1 && bought === 1,
+            'First scripted "buy" used, then policy took over',
+            `scripted=${scripted.stats.scripted}, bought=${bought}`);
+        conn.close();
+        await scripted.close();
+    }
+
+    // Test 4: Many concurrent games sharing one connection
+    console.log('\n--- TEST 4: 100 concurrent games with a remote seat each ---');
+    {
+        const before = server.stats.requests;
+        let inFlight = 0;
+        let maxInFlight = 0;
+
+        const start = Date.now();
+        const results = await runConcurrentGames(100, (index) => {
+            const engine = new AsyncGameEngine({ maxTurns: 100 });
+            engine.newGame(4, [
+                runner.createAIFactory('strategic'),
+                runner.createAIFactory('relative'),
+                new RemoteSource(transport, index, 2),
+                runner.createAIFactory('growth')
+            ]);
+            const run = engine.runGameAsync.bind(engine);
+            engine.runGameAsync = async () => {
+                maxInFlight = Math.max(maxInFlight, ++inFlight);
+                try {
+                    return await run();
+                } finally {
+                    inFlight--;
+                }
+            };
+            return engine;
+        });
+        const elapsed = (Date.now() - start) / 1000;
+
+        const finished = results.filter(r => r && r.turns > 0).length;
+        const remoteRequests = server.stats.requests - before;
+        console.log(`  ${finished} games in ${elapsed.toFixed(1)}s, ${remoteRequests} remote decisions, ` +
+            `up to ${maxInFlight} games in flight`);
+        check(finished === 100 && maxInFlight > 1,
+            'All games completed while interleaved',
+            'Concurrent run incomplete');
+    }
+
+    transport.close();
+    await server.close();
+
+    // Test 5: Auctions go through the shared resolver in both engines
+    console.log('\n--- TEST 5: Auction parity with published rules ---');
+    {
+        // Limits $120 / $180 / $150 in $10 steps; an awaited seat bids $200 once
+        const limits = [120, 180, 150];
+        let asked = 0;
+        const ruleAI = limit => () => ({
+            decideBid: () => { asked++; return 0; },
+            getReservationBid: () => ({ limit, step: 10, clamp: false })
+        });
+        const auction = async (Engine, remote) => {
+            const engine = new Engine({ yieldEvery: 0 });
+            const seats = limits.map(ruleAI);
+            if (remote) seats.push({ decideBid: (position, highBid) => Promise.resolve(highBid < 200 ? 200 : 0) });
+            engine.newGame(seats.length, seats);
+            await withSeedAsync(5, () => (engine.runAuctionAsync ? engine.runAuctionAsync(39) : engine.runAuction(39)));
+            const owner = engine.state.propertyStates[39].owner;
+            return { owner, paid: owner === null ? 0 : 1500 - engine.state.players[owner].money };
+        };
+        const sync = await auction(GameEngine, false);
+        const async = await auction(AsyncGameEngine, false);
+        const syncAsked = asked;
+        const remote = await auction(AsyncGameEngine, true);
+        check(sync.owner === 1 && async.owner === sync.owner && async.paid === sync.paid && asked === 0 &&
+            remote.owner === 3 && remote.paid === 200,
+            `Both engines sell Boardwalk to the $180 limit for $${sync.paid} without asking decideBid; ` +
+            'a promised $200 bid wins',
+            `Sync ${sync.owner}@${sync.paid}, async ${async.owner}@${async.paid}, ` +
+            `remote ${remote.owner}@${remote.paid}, decideBid asked ${syncAsked}/${asked}`);
+    }
+
+    summary(check, 'ALL ASYNC ENGINE TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exit(1);
+});
@@ -0,0 +1,91 @@
+/**
+ * Test the auction equilibrium solver and lookup table
+ */
+
+'use strict';
+
+const {
+    AuctionEquilibrium, solvePattern, solveAll, solveParallel, enumeratePatterns, ownershipCounts,
+    landingProbabilities
+} = require('./auction-equilibrium.js');
+const { BOARD } = require('./game-engine.js');
+const { createCheck, header, summary } = require('./harness.js');
+
+async function main() {
+    const check = createCheck();
+
+    header('TESTING AUCTION EQUILIBRIUM');
+
+    const probs = landingProbabilities();
+    // theta of type k, recovered from the stored values (median type has theta 1)
+    const theta = (role, k, price) => (role.values[k] - price / 2) / (role.values[3] - price / 2);
+
+    // Test 1: Symmetric auctions - bid value plus the rent you'd pay the winner
+    console.log('\n--- TEST 1: Symmetric auctions ---');
+    {
+        let worst = 0, eps = 0;
+        for (const position of [1, 5, 24, 39]) {
+            const entry = solvePattern(position, [0, 0, 0, 0], probs);
+            const [role] = entry.roles;
+            for (let k = 1; k < 6; k++) {
+                const target = role.values[k] + theta(role, k, BOARD[position].price) * role.externality;
+                worst = Math.max(worst, Math.abs(role.bids[k] - target) / entry.step);
+            }
+            eps = Math.max(eps, entry.exploitability);
+        }
+        check(worst <= 3 && eps < 5,
+            `Limits within ${worst.toFixed(1)} steps of value + externality; exploitability <= $${eps}`,
+            `Off by ${worst.toFixed(1)} steps, exploitability $${eps}`);
+    }
+
+    // Test 2: Blockers free-ride on each other against a completer
+    console.log('\n--- TEST 2: Completer vs blockers ---');
+    {
+        const entry = solvePattern(39, [1, 0, 0, 0], probs);
+        const [completer, blocker] = entry.roles;
+        const price = BOARD[39].price;
+        const shaded = blocker.bids.every((b, k) =>
+            b < blocker.values[k] + theta(blocker, k, price) * completer.externality - entry.step);
+        const median = blocker.bids[3];
+        check(completer.count === 1 && shaded && median < completer.bids[3] && entry.exploitability < 5,
+            `Boardwalk: blockers stop short of value + $${completer.externality} (median $${median}), ` +
+            `completer limit $${completer.bids[3]}`,
+            `Blockers [${blocker.bids}], completer [${completer.bids}], eps $${entry.exploitability}`);
+    }
+
+    // Test 3: Table lookup from live game ownership
+    console.log('\n--- TEST 3: Lookup ---');
+    {
+        const table = AuctionEquilibrium.build({ probabilities: probs, squares: [39], iterations: 100 });
+        const state = {
+            players: [0, 1, 2, 3].map(id => ({ id, bankrupt: id === 3 })),
+            propertyStates: { 37: { owner: 2 }, 39: { owner: null } }
+        };
+        const { mine, others } = ownershipCounts(39, state, 2);
+        const completer = table.bid(39, mine, others);
+        const blocker = table.bid(39, ...Object.values(ownershipCounts(39, state, 0)));
+        check(Object.keys(table.entries).length === enumeratePatterns(39, 4).length &&
+            mine === 1 && others.join() === '0,0' && completer === table.entries['39:1,0,0'].roles[0].bids[3] &&
+            blocker !== null && table.bid(39, 0, [0, 0, 0, 0]) === null,
+            `Player 2 holds Park Place vs 2 live blockers: limit $${completer} (blockers $${blocker})`,
+            `Counts ${mine} / [${others}], limits ${completer} / ${blocker}`);
+    }
+
+    // Test 4: Worker pool gives the same table as the inline solver
+    console.log('\n--- TEST 4: Pool vs inline ---');
+    {
+        const options = { squares: [1, 12, 28], iterations: 60 };
+        const inline = solveAll(probs, options);
+        const pooled = await solveParallel(probs, { ...options, workers: 2 });
+        check(JSON.stringify(inline) === JSON.stringify(pooled),
+            `${Object.keys(pooled).length} patterns identical from 2 workers`,
+            'Pool and inline tables differ');
+    }
+
+    summary(check, 'ALL AUCTION EQUILIBRIUM TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
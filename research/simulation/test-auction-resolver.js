@@ -0,0 +1,170 @@
+/**
+ * Test the closed-form auction resolver against round-by-round bidding
+ */
+
+'use strict';
+
+const { resolveAuction, applyRule } = require('./auction-resolver.js');
+const { BOARD } = require('./game-engine.js');
+const { createRandom, withSeed } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+/** The engine's original runAuction() loop, kept verbatim as the reference */
+function referenceAuction(bidders, position) {
+    const square = BOARD[position];
+    let highBid = 0;
+    let highBidder = null;
+    const bids = [];
+    const stillBidding = new Set(bidders.map(p => p.id));
+    let rounds = 0;
+    const maxRounds = 100;
+
+    while (stillBidding.size > 1 && rounds < maxRounds) {
+        rounds++;
+        let anyBidThisRound = false;
+        for (const player of bidders) {
+            if (!stillBidding.has(player.id)) continue;
+            let bid = 0;
+            if (player.ai && player.ai.decideBid) {
+                bid = player.ai.decideBid(position, highBid, null);
+            } else {
+                const maxBid = Math.min(player.money - 50, square.price);
+                if (maxBid > highBid) bid = highBid + 10;
+            }
+            if (bid > highBid && bid <= player.money) {
+                highBid = bid;
+                highBidder = player;
+                anyBidThisRound = true;
+                bids.push(`${player.id}:${bid}@${rounds}`);
+            } else {
+                stillBidding.delete(player.id);
+            }
+        }
+        if (!anyBidThisRound && highBidder) break;
+    }
+    return { winner: highBidder ? highBidder.id : null, price: highBid, bids };
+}
+
+/** Random bidder: threshold (clamped or not), random-increment, or no AI */
+function randomBidder(id, random, counter) {
+    const player = { id, name: `P${id}`, money: Math.floor(random() * 2500) };
+    const kind = random();
+    if (kind < 0.1) return player;
+    if (kind < 0.25) {
+        // RandomAI-style: consumes Math.random(), must stay interactive
+        player.ai = {
+            decideBid: (pos, h) => {
+                counter.calls++;
+                if (Math.random() > 0.7) return 0;
+                return h + Math.floor(Math.random() * 20) + 1;
+            }
+        };
+        return player;
+    }
+    const rule = {
+        limit: random() < 0.3 ? random() * 3000 : Math.floor(random() * 300) * 10,
+        step: 10,
+        clamp: kind < 0.7
+    };
+    player.ai = {
+        decideBid: (pos, h) => { counter.calls++; return applyRule(rule, h); },
+        getReservationBid: () => rule
+    };
+    return player;
+}
+
+const check = createCheck();
+
+header('TESTING AUCTION RESOLVER');
+
+// Test 1: Identical winner, price and bid log on random auctions
+console.log('\n--- TEST 1: Random auctions vs reference loop ---');
+{
+    const random = createRandom(71);
+    const counter = { calls: 0 };
+    let mismatches = 0, referenceCalls = 0, resolverCalls = 0, capped = 0;
+    const auctions = 20000;
+    for (let a = 0; a < auctions; a++) {
+        const n = 2 + Math.floor(random() * 3);
+        const bidders = Array.from({ length: n }, (_, id) => randomBidder(id, random, counter));
+        const position = [1, 3, 6, 11, 24, 39][a % 6];
+        const seed = Math.floor(random() * 1e9);
+
+        counter.calls = 0;
+        const ref = withSeed(seed, () => referenceAuction(bidders, position));
+        referenceCalls += counter.calls;
+
+        counter.calls = 0;
+        const bids = [];
+        const got = withSeed(seed, () => resolveAuction(bidders, position, null,
+            { onBid: (p, bid, round) => bids.push(`${p.id}:${bid}@${round}`) }));
+        resolverCalls += counter.calls;
+        if (got.rounds === 100) capped++;
+
+        const winner = got.winner ? got.winner.id : null;
+        if (winner !== ref.winner || got.price !== ref.price || bids.join() !== ref.bids.join()) mismatches++;
+    }
+    check(mismatches === 0,
+        `${auctions} auctions identical (${capped} hit maxRounds); decideBid calls ${referenceCalls} -> ${resolverCalls}`,
+        `${mismatches} auctions differ`);
+}
+
+// Test 2: Published rules match decideBid() for the real AIs in a live game
+console.log('\n--- TEST 2: Real AI rules ---');
+{
+    const { GameEngine } = require('./game-engine.js');
+    const runner = createRunner({ maxTurns: 500 });
+    const types = ['simple', 'strategic', 'growth', 'leader', 'relative', 'optimal', 'random'];
+    const engine = new GameEngine({ maxTurns: 40 });
+    withSeed(12, () => {
+        engine.newGame(types.length, types.map(t => runner.createAIFactory(t)));
+        engine.runGame();
+    });
+    const published = [];
+    let mismatches = 0;
+    for (const player of engine.state.players) {
+        for (const position of [1, 6, 11, 16, 21, 26, 31, 37, 39]) {
+            const rule = player.ai.getReservationBid(position, engine.state);
+            if (!rule) continue;
+            if (!published.includes(player.ai.name)) published.push(player.ai.name);
+            for (let h = 0; h <= 700; h += 1.5) {
+                if (applyRule(rule, h) !== player.ai.decideBid(position, h, engine.state)) mismatches++;
+            }
+        }
+    }
+    check(mismatches === 0 && published.length === 4,
+        `Rules match decideBid() for ${published.join(', ')}; ` +
+        'strategic, optimal (mortgage while bidding) and random stay interactive',
+        `${mismatches} mismatches; published by ${published.join(', ')}`);
+}
+
+// Test 3: Whole auction-only games are unchanged
+console.log('\n--- TEST 3: Auction-only games ---');
+{
+    const { AuctionGameEngine, AuctionSimulationRunner } = require('./auction-game-engine.js');
+    const runner = quietly(() => new AuctionSimulationRunner({ maxTurns: 500 }));
+    const lineup = ['relative', 'growth', 'leader', 'trading'];
+    const play = (interactive) => {
+        const start = Date.now();
+        const outcomes = [];
+        let auctions = 0;
+        for (let g = 0; g < 6; g++) {
+            const result = withSeed(1000 + g, () => {
+                const engine = new AuctionGameEngine({ maxTurns: 500, interactiveAuctions: interactive });
+                engine.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+                return engine.runGame();
+            });
+            auctions += result.auctionAnalytics.auctions.length;
+            outcomes.push(JSON.stringify([result.winner, result.turns, result.auctionAnalytics.auctions]));
+        }
+        return { outcomes, auctions, ms: Date.now() - start };
+    };
+    const interactive = quietly(() => play(true));
+    const closed = quietly(() => play(false));
+    const same = interactive.outcomes.every((o, i) => o === closed.outcomes[i]);
+    check(same && closed.auctions > 0,
+        `6 seeded games, ${closed.auctions} auctions identical bid for bid (${interactive.ms} ms -> ${closed.ms} ms)`,
+        'Game outcomes differ between interactive and closed-form auctions');
+}
+
+summary(check, 'ALL AUCTION RESOLVER TESTS PASSED');
@@ -0,0 +1,99 @@
+/**
+ * Test counterfactual branch-and-compare
+ */
+
+'use strict';
+
+const { GameEngine, COLOR_GROUPS } = require('./game-engine.js');
+const { recordDecisions, branchAndCompare, runPool } = require('./counterfactual.js');
+const { withSeed } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+async function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const factories = LINEUP.map(t => runner.createAIFactory(t));
+    const check = createCheck();
+
+    header('TESTING COUNTERFACTUAL BRANCH-AND-COMPARE');
+
+    // Test 1: Snapshot survives structured cloning and restores exactly
+    console.log('\n--- TEST 1: Snapshot round trip ---');
+    {
+        const engine = withSeed(7, () => quietly(() => {
+            const e = new GameEngine({ maxTurns: 300 });
+            e.newGame(4, factories);
+            for (let i = 0; i < 120 && !e.state.isGameOver(); i++) e.executeTurn();
+            return e;
+        }));
+        const snap = engine.snapshot();
+        const restored = new GameEngine();
+        quietly(() => restored.restore(structuredClone(snap), factories));
+        check(JSON.stringify(restored.snapshot()) === JSON.stringify(snap) &&
+            restored.state.players.every(p => p.ai && p.ai.player === p),
+            `Turn ${snap.turn} state restored with fresh AIs`,
+            'Restored state differs from the snapshot');
+    }
+
+    // Test 2: Common random numbers - a no-op alternative gives zero delta
+    console.log('\n--- TEST 2: Paired rollouts cancel ---');
+    const [decision] = recordDecisions(runner, { games: 1, seed: 3, lineup: LINEUP, maxTurns: 300 });
+    {
+        const noop = {
+            ...decision,
+            kind: 'trade',
+            proposer: (decision.player + 1) % LINEUP.length,
+            trade: { fromProperties: [], toProperties: [], fromCash: 0 }
+        };
+        const result = quietly(() => branchAndCompare(noop, factories, { rollouts: 6, maxTurns: 300 }));
+        check(result.delta === 0 && result.se === 0 && result.take === result.skip,
+            `Identical branches: delta 0 over 6 pairs (P(win) ${result.take.toFixed(2)})`,
+            `delta ${result.delta}, se ${result.se}`);
+    }
+
+    // Test 3: A free monopoly is worth taking
+    console.log('\n--- TEST 3: Clear-cut trade ---');
+    {
+        const engine = new GameEngine({ maxTurns: 300 });
+        quietly(() => engine.newGame(4, factories));
+        const [a, b] = COLOR_GROUPS.orange.squares;
+        const c = COLOR_GROUPS.orange.squares[2];
+        for (const [sq, owner] of [[a, 1], [b, 1], [c, 0]]) {
+            engine.state.propertyStates[sq].owner = owner;
+            engine.state.players[owner].properties.add(sq);
+        }
+        const gift = {
+            kind: 'trade',
+            player: 1,
+            proposer: 0,
+            trade: { fromProperties: [c], toProperties: [], fromCash: 0 },
+            taken: false,
+            seed: 11,
+            snapshot: engine.snapshot()
+        };
+        const result = quietly(() => branchAndCompare(gift, factories, { rollouts: 16, maxTurns: 300 }));
+        check(result.delta > 2 * result.se && result.delta > 0.2,
+            `Completing orange for free: delta +${(result.delta * 100).toFixed(0)}% +/- ${(result.se * 100).toFixed(0)}%`,
+            `delta ${result.delta.toFixed(3)}, se ${result.se.toFixed(3)}`);
+    }
+
+    // Test 4: Worker pool reproduces the in-process numbers
+    console.log('\n--- TEST 4: Worker pool ---');
+    {
+        const decisions = recordDecisions(runner, { games: 1, seed: 5, lineup: LINEUP, maxTurns: 300 }).slice(0, 3);
+        const options = { rollouts: 3, maxTurns: 300, lineup: LINEUP, workers: 2 };
+        const pooled = await runPool(decisions, options);
+        const inline = decisions.map(d => quietly(() => branchAndCompare(d, factories, options)));
+        check(JSON.stringify(pooled) === JSON.stringify(inline),
+            `${decisions.length} decisions match across 2 workers`,
+            'Pool results differ from in-process results');
+    }
+
+    summary(check, 'ALL COUNTERFACTUAL TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
@@ -0,0 +1,85 @@
+/**
+ * Test the design-of-experiments parameter sweep
+ */
+
+'use strict';
+
+const { latinHypercube, sobol, ResponseSurface, runDesign, defaultConfig, toConfig } = require('./design-sweep.js');
+const { createRandom } = require('./seeded-random.js');
+const { quietly, createCheck, header, summary } = require('./harness.js');
+
+async function main() {
+    const check = createCheck();
+
+    header('TESTING DESIGN-OF-EXPERIMENTS SWEEP');
+
+    // Test 1: Latin hypercube puts exactly one point in each stratum per axis
+    console.log('\n--- TEST 1: Latin hypercube ---');
+    {
+        const n = 25;
+        const points = latinHypercube(n, 4, createRandom(7));
+        const stratified = [0, 1, 2, 3].every(j =>
+            new Set(points.map(p => Math.floor(p[j] * n))).size === n);
+        check(stratified && points.every(p => p.every(v => v >= 0 && v < 1)),
+            `${n} points, one per stratum on all 4 axes`, 'Strata not covered exactly once');
+    }
+
+    // Test 2: Sobol matches the reference sequence
+    console.log('\n--- TEST 2: Sobol sequence ---');
+    {
+        const points = sobol(8, 3);
+        const expected = [[0.5, 0.5, 0.5], [0.75, 0.25, 0.25], [0.25, 0.75, 0.75], [0.375, 0.375, 0.625],
+            [0.875, 0.875, 0.125], [0.625, 0.125, 0.875], [0.125, 0.625, 0.375], [0.1875, 0.3125, 0.9375]];
+        const match = expected.every((e, i) => e.every((v, j) => points[i][j] === v));
+        check(match, 'First 8 points match Joe-Kuo reference values',
+            `Got ${JSON.stringify(points)}`);
+    }
+
+    // Test 3: Quadratic fit recovers a known surface and its constrained optimum
+    console.log('\n--- TEST 3: Response surface ---');
+    {
+        const random = createRandom(3);
+        // y = 0.5 + 0.1 x0 - 0.2 x0^2 + 0.05 x1 + 0.08 x0 x2 - 0.1 x2^2 + 0.03 x3 (+ noise)
+        const truth = (x) => 0.5 + 0.1 * x[0] - 0.2 * x[0] * x[0] + 0.05 * x[1]
+            + 0.08 * x[0] * x[2] - 0.1 * x[2] * x[2] + 0.03 * x[3];
+        const X = latinHypercube(60, 4, random).map(u => u.map(v => 2 * v - 1));
+        const y = X.map(x => truth(x) + 0.005 * (random() - 0.5));
+        const surface = new ResponseSurface(X, y);
+        const beta = (label) => surface.beta[surface.terms.findIndex(t => t.label === label)];
+        const recovered = Math.abs(beta('x0') - 0.1) < 0.005 && Math.abs(beta('x0^2') + 0.2) < 0.005 &&
+            Math.abs(beta('x0*x2') - 0.08) < 0.005 && Math.abs(beta('x1*x3')) < 0.005;
+        check(recovered && surface.r2 > 0.99,
+            `Coefficients recovered, R^2 = ${surface.r2.toFixed(4)}`,
+            `x0=${beta('x0')}, x0^2=${beta('x0^2')}, x0*x2=${beta('x0*x2')}, R^2=${surface.r2}`);
+
+        // Analytic optimum: x1 = x3 = 1; solve 0.1 - 0.4 x0 + 0.08 x2 = 0, 0.08 x0 - 0.2 x2 = 0
+        const best = surface.maximize(X);
+        const x0 = 0.1 / (0.4 - 0.08 * 0.08 / 0.2);
+        const x2 = 0.08 * x0 / 0.2;
+        const err = Math.max(Math.abs(best.x[0] - x0), Math.abs(best.x[1] - 1),
+            Math.abs(best.x[2] - x2), Math.abs(best.x[3] - 1));
+        check(err < 0.03, `Optimum found to within ${err.toFixed(4)} (x1, x3 on the upper bound)`,
+            `Optimum ${best.x.map(v => v.toFixed(3))} vs [${x0.toFixed(3)}, 1, ${x2.toFixed(3)}, 1]`);
+    }
+
+    // Test 4: Pool chunks play the same seeded games as one inline comparison
+    console.log('\n--- TEST 4: Worker pool ---');
+    {
+        const { ParameterSweep } = quietly(() => require('./parameter-sweep.js'));
+        const config = toConfig([0.8, 0.2, 0.6, 0.4]);
+        const sweep = quietly(() => new ParameterSweep({ maxTurns: 500 }));
+        const inline = quietly(() => sweep.runComparison(config, defaultConfig(), 6, { seed: 42 }));
+        const [pooled] = await runDesign([config], defaultConfig(), { games: 6, chunk: 2, workers: 2, seed: 42 });
+        check(pooled.wins === inline.config1Wins && pooled.losses === inline.config2Wins &&
+            pooled.turns === inline.totalTurns,
+            `6 games in 3 chunks: ${pooled.wins}-${pooled.losses}, ${pooled.turns} turns both ways`,
+            `Pool ${JSON.stringify(pooled)}, inline ${inline.config1Wins}-${inline.config2Wins}/${inline.totalTurns}`);
+    }
+
+    summary(check, 'ALL DESIGN SWEEP TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
@@ -0,0 +1,93 @@
+/**
+ * Test Markov chains for other dice configurations (speed die)
+ */
+
+'use strict';
+
+const MonopolyMarkov = require('../../ai/markov-engine.js');
+const { createEngine } = require('./rule-variants.js');
+const { withSeed } = require('./seeded-random.js');
+const { quietly, createCheck, header, summary } = require('./harness.js');
+
+const check = createCheck();
+
+header('TESTING DICE CONFIGURATIONS');
+
+const { buildTransitionMatrix, buildConfiguredTransitions, buildExtendedTransitionMatrix,
+    computeSteadyState, computeSteadyStateSparse, toSparse, MarkovEngine } = MonopolyMarkov;
+
+// Test 1: The generic builder reproduces the hand-unrolled classic chain
+console.log('\n--- TEST 1: Classic dice, generic builder ---');
+{
+    const classic = buildTransitionMatrix();
+    const generic = buildConfiguredTransitions({ dice: 2, sides: 6 });
+    let diff = 0;
+    classic.forEach((row, i) => row.forEach((p, j) => { diff = Math.max(diff, Math.abs(p - generic[i][j])); }));
+    const T = buildExtendedTransitionMatrix('stay');
+    const dense = quietly(() => computeSteadyState(T));
+    const sparse = quietly(() => computeSteadyStateSparse(toSparse(T)));
+    check(diff < 1e-12 && dense.every((p, i) => p === sparse[i]),
+        `2d6 from the generic builder within ${diff.toExponential(1)}; sparse steady state identical to dense`,
+        `Max difference ${diff}, sparse ${sparse.slice(0, 3)} vs dense ${dense.slice(0, 3)}`);
+}
+
+// Test 2: Other configurations are stochastic
+console.log('\n--- TEST 2: Stochastic rows ---');
+{
+    let worst = 0;
+    for (const dice of ['speed', { dice: 3, sides: 6 }, { dice: 2, sides: 8, maxDoubles: 2 }]) {
+        for (const strategy of ['stay', 'leave']) {
+            for (const row of buildExtendedTransitionMatrix(strategy, dice)) {
+                worst = Math.max(worst, Math.abs(row.reduce((a, b) => a + b, 0) - 1));
+            }
+        }
+    }
+    check(worst < 1e-12,
+        `Speed die, 3d6 and 2d8 (jail on 2nd doubles): every row sums to 1 (within ${worst.toExponential(1)})`,
+        `A row sums to 1 +/- ${worst}`);
+}
+
+// Test 3: The speed die moves probability onto property squares
+console.log('\n--- TEST 3: Speed die landing probabilities ---');
+{
+    const [classic, speed] = quietly(() => [new MarkovEngine(), new MarkovEngine({ dice: 'speed' })]
+        .map(engine => engine.getAllProbabilities()));
+    const chance = [7, 22, 36].reduce((s, sq) => s + speed[sq] - classic[sq], 0);
+    const sum = speed.reduce((a, b) => a + b, 0);
+    check(Math.abs(sum - 1) < 1e-12 && speed[30] === 0 && chance < 0 && speed[10] < classic[10],
+        `Chance squares ${(chance * 100).toFixed(2)} pts (Mr. Monopoly moves on), jail ` +
+        `${(classic[10] * 100).toFixed(2)}% -> ${(speed[10] * 100).toFixed(2)}%`,
+        `Sum ${sum}, Go To Jail ${speed[30]}, Chance change ${chance}`);
+}
+
+// Test 4: The chain matches the speed-die engine on a fully owned board
+console.log('\n--- TEST 4: Chain vs simulated speed-die turns ---');
+{
+    const pi = quietly(() => computeSteadyStateSparse(toSparse(buildExtendedTransitionMatrix('stay', 'speed'))));
+    const turns = 60000;
+    const counts = new Array(43).fill(0);
+    withSeed(11, () => {
+        const engine = createEngine('speedDie');
+        engine.newGame(2);
+        const [p0, p1] = engine.state.players;
+        // Player 1 owns everything and charges nothing: Mr. Monopoly and the bus behave as the chain assumes
+        for (const [sq, ps] of Object.entries(engine.state.propertyStates)) {
+            ps.owner = 1;
+            p1.properties.add(Number(sq));
+        }
+        engine.calculateRent = () => 0;
+        for (let t = 0; t < turns; t++) {
+            p0.money = p1.money = 1e9;
+            counts[p0.inJail ? 40 + p0.jailTurns : p0.position]++;
+            engine.executeTurn();
+            engine.executeTurn();
+        }
+    });
+    let worst = 0;
+    counts.forEach((c, i) => { worst = Math.max(worst, Math.abs(c / turns - pi[i]) / Math.sqrt(pi[i] / turns + 1e-12)); });
+    check(worst < 4.5,
+        `${turns} simulated turns agree with the chain in all 43 states (worst ${worst.toFixed(1)} sigma)`,
+        `A state is ${worst.toFixed(1)} sigma from the chain`);
+}
+
+summary(check, 'ALL DICE CONFIGURATION TESTS PASSED');
@@ -0,0 +1,106 @@
+/**
+ * Test the heads-up endgame tablebase on a small solved table
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { GameEngine } = require('./game-engine.js');
+const { EndgameTablebase } = require('./endgame-tablebase.js');
+const { createCheck, header, summary } = require('./harness.js');
+
+// Small table so the test solves it in well under a second
+const SMALL = {
+    hitCenters: [0.05, 0.2],
+    rentCenters: [50, 300, 1200],
+    cashStep: 250,
+    cashBuckets: 9
+};
+
+function main() {
+    const check = createCheck();
+
+    header('TESTING ENDGAME TABLEBASE');
+
+    const tb = EndgameTablebase.build(SMALL);
+    const P = tb.profileCount;
+    const top = (SMALL.cashBuckets - 1) * SMALL.cashStep;
+
+    // Test 1: Solver converged everywhere
+    console.log('\n--- TEST 1: Convergence ---');
+    check(tb.stats.unconverged === 0,
+        `${tb.stats.pairs} pairs converged (max ${tb.stats.maxSweeps} sweeps)`,
+        `${tb.stats.unconverged} pairs did not converge`);
+
+    // Test 2: Nobody can win without rent, so it's a coin flip
+    console.log('\n--- TEST 2: No rent on either side ---');
+    check(Math.abs(tb.value(0, 0, 500, 1500) - 0.5) < 1e-3,
+        'P(win) = 0.5 when neither side collects rent',
+        `P(win) = ${tb.value(0, 0, 500, 1500)}`);
+
+    // Test 3: More money never hurts, a stronger opponent never helps
+    console.log('\n--- TEST 3: Monotonicity ---');
+    {
+        let violations = 0;
+        for (let a = 0; a < P; a++) {
+            for (let b = 0; b < P; b++) {
+                for (let cash = 0; cash < top; cash += 50) {
+                    if (tb.value(a, b, cash + 50, 1000) < tb.value(a, b, cash, 1000) - 1e-3) violations++;
+                    if (tb.value(a, b, 1000, cash + 50) > tb.value(a, b, 1000, cash) + 1e-3) violations++;
+                }
+            }
+        }
+        check(violations === 0, 'Win probability rises with my cash and falls with theirs',
+            `${violations} monotonicity violations`);
+
+        const weak = tb.profileIndex(0.05, 50);
+        const strong = tb.profileIndex(0.2, 1200);
+        check(tb.value(strong, weak, 1000, 1000) > 0.9 && tb.value(weak, strong, 1000, 1000) < 0.1,
+            'Hotels beat a cheap group at equal cash',
+            `strong ${tb.value(strong, weak, 1000, 1000)}, weak ${tb.value(weak, strong, 1000, 1000)}`);
+    }
+
+    // Test 4: Save/load round trip
+    console.log('\n--- TEST 4: File round trip ---');
+    {
+        const file = path.join(os.tmpdir(), `tablebase-test-${process.pid}.bin`);
+        tb.save(file);
+        const loaded = EndgameTablebase.load(file);
+        fs.unlinkSync(file);
+
+        const same = loaded.values.length === tb.values.length &&
+            loaded.values.every((v, k) => v === tb.values[k]) &&
+            loaded.params.cashStep === SMALL.cashStep &&
+            loaded.params.rentCenters.join() === SMALL.rentCenters.join();
+        check(same, `${loaded.values.length} entries and parameters restored`,
+            'Loaded table differs from saved table');
+    }
+
+    // Test 5: Probing a live engine
+    console.log('\n--- TEST 5: Probing ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(4, []);
+        check(tb.probe(engine, 0, null) === null, 'No probe with four players left',
+            'Probe answered a four-player game');
+
+        engine.state.players[2].bankrupt = true;
+        engine.state.players[3].bankrupt = true;
+        for (const sq of [37, 39]) {
+            engine.state.propertyStates[sq].owner = 0;
+            engine.state.propertyStates[sq].houses = 5;
+            engine.state.players[0].properties.add(sq);
+        }
+        const p0 = tb.probe(engine, 0, null);
+        const p1 = tb.probe(engine, 1, null);
+        check(p0 > 0.75 && Math.abs(p0 + p1 - 1) < 1e-9,
+            `Boardwalk/Park Place hotels: P(win) ${p0.toFixed(3)} vs ${p1.toFixed(3)}`,
+            `Unexpected probes ${p0}, ${p1}`);
+    }
+
+    summary(check, 'ALL TABLEBASE TESTS PASSED');
+}
+
+main();
@@ -0,0 +1,132 @@
+/**
+ * Test the incremental EPT tracker against full recomputation
+ */
+
+'use strict';
+
+const { GameEngine } = require('./game-engine.js');
+const { RelativeGrowthAI } = require('./relative-growth-ai.js');
+const { CompetitiveTradingAI } = require('./competitive-trading-ai.js');
+const { EPTTracker } = require('./ept-tracker.js');
+const { withSeed } = require('./seeded-random.js');
+const { createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['relative', 'growth', 'competitive', 'strategic'];
+const TOLERANCE = 1e-6;
+
+/** Full recomputation, bypassing the tracker */
+function recompute(ai, method, ...args) {
+    const engine = ai.engine;
+    ai.engine = null;
+    try {
+        return ai[method](...args);
+    } finally {
+        ai.engine = engine;
+    }
+}
+
+function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const check = createCheck();
+
+    header('TESTING INCREMENTAL EPT TRACKER');
+
+    // Test 1: Running sums match full recomputation after every turn
+    console.log('\n--- TEST 1: Tracker vs full recomputation ---');
+    {
+        let checks = 0;
+        let worst = 0;
+        for (let seed = 1; seed <= 20; seed++) {
+            withSeed(seed, () => {
+                const engine = new GameEngine({ maxTurns: 300 });
+                engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+
+                const relative = engine.state.players[0].ai;
+                const competitive = engine.state.players[2].ai;
+                const tracker = engine.getEPTTracker(relative.probs);
+
+                while (!engine.state.isGameOver() && engine.state.turn < engine.options.maxTurns) {
+                    engine.executeTurn();
+
+                    const full = recompute(relative, 'calculateRelativeEPTs', engine.state);
+                    for (const [id, data] of full) {
+                        const fast = tracker.relativeEPTs().get(id);
+                        worst = Math.max(worst,
+                            Math.abs(fast.propertyEPT - data.propertyEPT),
+                            Math.abs(fast.relativeEPT - data.relativeEPT));
+                        checks++;
+                    }
+                    for (const player of engine.state.players) {
+                        if (player.bankrupt) continue;
+                        const street = recompute(competitive, 'calculatePlayerEPT', player, engine.state);
+                        worst = Math.max(worst, Math.abs(tracker.streetEPT(player.id) - street));
+                        checks++;
+                    }
+                }
+            });
+        }
+
+        check(worst < TOLERANCE,
+            `${checks} checks, max error ${worst.toExponential(2)}`,
+            `Max error ${worst} over ${checks} checks`);
+    }
+
+    // Test 2: A tracker built mid-game agrees with one kept up to date
+    console.log('\n--- TEST 2: Rebuild matches running sums ---');
+    {
+        const engine = withSeed(7, () => {
+            const e = new GameEngine({ maxTurns: 300 });
+            e.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+            e.getEPTTracker(e.state.players[0].ai.probs);
+            for (let i = 0; i < 120 && !e.state.isGameOver(); i++) e.executeTurn();
+            return e;
+        });
+        const running = engine.eptTracker;
+        const fresh = new running.constructor(engine.state, running.probs);
+
+        const same = engine.state.players.every(p =>
+            running.incomeSum[p.id] === fresh.incomeSum[p.id] &&
+            running.streetSum[p.id] === fresh.streetSum[p.id]
+        );
+        check(same,
+            'Fixed-point sums identical after 120 turns',
+            'Running sums drifted from a fresh rebuild');
+    }
+
+    // Test 3: Every AI's private probability copy shares one tracker
+    console.log('\n--- TEST 3: Tracker shared across AIs ---');
+    {
+        const engine = new GameEngine({ maxTurns: 50 });
+        engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+        const ais = engine.state.players.map(p => p.ai)
+            .filter(ai => ai instanceof RelativeGrowthAI || ai instanceof CompetitiveTradingAI);
+        const trackers = new Set(ais.map(ai => engine.getEPTTracker(ai.probs)));
+
+        check(ais.length === 3 && trackers.size === 1,
+            `${ais.length} AIs read the same tracker`,
+            `${trackers.size} trackers for ${ais.length} AIs`);
+    }
+
+    // Test 4: A square solved at probability 0 books nothing in either sum
+    console.log('\n--- TEST 4: Zero landing probability ---');
+    {
+        const engine = new GameEngine({ maxTurns: 50 });
+        engine.newGame(2, LINEUP.slice(0, 2).map(t => runner.createAIFactory(t)));
+        const probs = new Array(40).fill(0.025);
+        probs[39] = 0;
+        for (const sq of [37, 39]) {
+            engine.state.propertyStates[sq].owner = 0;
+            engine.state.players[0].properties.add(sq);
+        }
+        const tracker = new EPTTracker(engine.state, probs);
+        const parkPlace = Math.round(0.025 * 70 * 1e9) / 1e9;
+        check(tracker.income[39] === 0 && tracker.street[39] === 0 &&
+            Math.abs(tracker.streetEPT(0) - parkPlace) < TOLERANCE,
+            'Boardwalk at probability 0 adds no income and no street EPT',
+            `Boardwalk income ${tracker.income[39]}, street ${tracker.street[39]}, street EPT ${tracker.streetEPT(0)}`);
+    }
+
+    summary(check, 'ALL EPT TRACKER TESTS PASSED');
+}
+
+main();
@@ -0,0 +1,75 @@
+/**
+ * Test the island-model genetic algorithm
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { IslandGA, IslandCoordinator } = require('./ga-islands.js');
+const { GeneticAlgorithm } = require('./genetic-algorithm.js');
+const { quietly, createCheck, header, summary } = require('./harness.js');
+
+async function main() {
+    const check = createCheck();
+    const outputDir = fs.mkdtempSync(path.join(os.tmpdir(), 'ga-islands-test-'));
+
+    header('TESTING ISLAND-MODEL GA');
+
+    // Test 1: Migrants replace the worst individuals and keep their fitness
+    console.log('\n--- TEST 1: Emigrate / immigrate ---');
+    {
+        const island = quietly(() => new IslandGA(0, { outputDir, populationSize: 5 }));
+        island.population = [0.1, 0.4, 0.2, 0.3, 0.05].map((fitness, i) => ({
+            genome: { ...island.createDefaultGenome(), projectionHorizon: 40 + i }, fitness, wins: 0, games: 0
+        }));
+        const out = island.emigrants(2);
+        const migrants = [{ genome: { ...out[0].genome, projectionHorizon: 70 }, fitness: 0.5 },
+            { genome: { ...out[1].genome, projectionHorizon: 71 }, fitness: 0.15 }];
+        island.immigrate(migrants);
+        const fitness = island.population.map(ind => ind.fitness);
+        check(out.map(m => m.fitness).join() === '0.4,0.3' &&
+            fitness.join() === '0.5,0.4,0.3,0.2,0.15' && island.population[0].genome.projectionHorizon === 70,
+            'Best two sent; worst two replaced, ranked by carried fitness',
+            `Sent ${out.map(m => m.fitness)}, population ${fitness}`);
+    }
+
+    // Test 2: Two islands exchange migrants and checkpoint in ga-state.json format
+    console.log('\n--- TEST 2: Two-island run ---');
+    const options = {
+        islands: 2, populationSize: 4, generations: 2, gamesPerEvaluation: 4,
+        migrationInterval: 1, migrants: 1, saveInterval: 1, outputDir
+    };
+    {
+        const result = await quietly(() => new IslandCoordinator(options).run());
+        check(result.migrations === 4 && result.history.length === 2,
+            `2 generations, ${result.migrations} migrants relayed`,
+            `${result.history.length} generations, ${result.migrations} migrants`);
+
+        const ga = quietly(() => new GeneticAlgorithm({ outputDir }));
+        const loaded = quietly(() => ga.loadState());
+        const islandState = JSON.parse(fs.readFileSync(path.join(outputDir, 'island-1', 'ga-state.json'), 'utf8'));
+        check(loaded && ga.population.length === 8 && islandState.population.length === 4,
+            'Merged checkpoint loads in GeneticAlgorithm (8 individuals); islands keep their own',
+            `Loaded ${loaded}, ${ga.population.length} merged, ${islandState.population.length} on island 1`);
+    }
+
+    // Test 3: Resume picks up where each island stopped
+    console.log('\n--- TEST 3: Resume ---');
+    {
+        const result = await quietly(() => new IslandCoordinator({ ...options, generations: 4, resume: true }).run());
+        const gens = result.history.map(h => h.generation);
+        check(gens.join() === '3', 'Resumed islands ran only generation 3',
+            `Generations run: ${gens.join(', ')}`);
+    }
+
+    fs.rmSync(outputDir, { recursive: true, force: true });
+
+    summary(check, 'ALL ISLAND GA TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
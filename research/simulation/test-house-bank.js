@@ -0,0 +1,128 @@
+/**
+ * Test bank house inventory: contention, last-houses auctions and supply strategy
+ */
+
+'use strict';
+
+const { GameEngine, COLOR_GROUPS } = require('./game-engine.js');
+const { unitDemand, contention, denialValue, shouldHoldAtFour } = require('./house-bank.js');
+const { getCachedEngines } = require('./cached-engines.js');
+const { withSeed } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+/** Three-player engine; holdings maps player id -> { group: houses per square } */
+function setup(holdings, money, options = {}) {
+    const engine = new GameEngine(options);
+    engine.newGame(3, []);
+    const state = engine.state;
+    let built = 0;
+    for (const [id, groups] of Object.entries(holdings)) {
+        const player = state.players[id];
+        player.money = money[id];
+        for (const [group, houses] of Object.entries(groups)) {
+            for (const sq of COLOR_GROUPS[group].squares) {
+                player.properties.add(sq);
+                state.propertyStates[sq].owner = player.id;
+                state.propertyStates[sq].houses = houses;
+                built += houses;
+            }
+        }
+    }
+    state.housesAvailable = 32 - built;
+    return engine;
+}
+
+const check = createCheck();
+
+header('TESTING HOUSE BANK');
+
+const { markovEngine } = quietly(() => getCachedEngines());
+const probs = markovEngine.getAllProbabilities();
+
+// Test 1: Demand and contention
+console.log('\n--- TEST 1: Demand and contention ---');
+{
+    const engine = setup({ 0: { orange: 0 }, 1: { green: 0 } }, [1000, 500, 1500]);
+    const state = engine.state;
+    const demand = [0, 1, 2].map(id => unitDemand(state, state.players[id], 'house'));
+    const plenty = contention(state, 'house').contended;
+    state.housesAvailable = 8;
+    const short = contention(state, 'house');
+    check(demand.join() === '10,2,0' && !plenty && short.contended && !contention(state, 'hotel').contended,
+        'Orange owner can place 10 houses, green owner 2: contended with 8 left in the bank, not with 32',
+        `Demand [${demand}], contended ${plenty} / ${short.contended}`);
+}
+
+// Test 2: The last houses go to the highest bidder, not the first to ask
+console.log('\n--- TEST 2: Last-houses auction ---');
+{
+    const play = (houseAuctions) => {
+        const engine = setup({ 0: { orange: 0 }, 1: { green: 0 } }, [1000, 500, 1500], { houseAuctions });
+        const [p0, p1] = engine.state.players;
+        p0.ai = { getHouseBidLimit: () => 300 };
+        p1.ai = { getHouseBidLimit: () => 450 };
+        engine.state.housesAvailable = 2;
+        const built = engine.buildHouse(p0, 16);
+        return { built, engine, p0, p1 };
+    };
+    const off = play(false);
+    const on = play(true);
+    const ps = on.engine.state.propertyStates;
+    const stats = on.engine.state.stats;
+    check(off.built && off.p0.money === 900 &&
+        !on.built && ps[16].houses === 0 && ps[34].houses === 1 && on.p1.money === 500 - 310 &&
+        on.engine.state.housesAvailable === 1 && stats.houseAuctions === 1 && stats.housePremiums === 110,
+        'Seat order: orange builds at $100; auction: green outbids ($450 vs $300) and pays $310 for Pennsylvania Ave',
+        `Off: built ${off.built}; on: built ${on.built}, p1 $${on.p1.money}, premiums ${stats.housePremiums}`);
+}
+
+// Test 3: Holding at four houses when the released houses would feed an opponent
+console.log('\n--- TEST 3: Supply strategy ---');
+{
+    const engine = setup({ 0: { darkBlue: 4 }, 1: { orange: 2 } }, [500, 2000, 500]);
+    const state = engine.state;
+    const me = state.players[0];
+    state.housesAvailable = 0;
+    const holdShort = shouldHoldAtFour(state, me, 39, probs);
+    const denyShort = denialValue(state, me, probs);
+    state.housesAvailable = 2;
+    const denyTwo = denialValue(state, me, probs);
+    state.housesAvailable = 10;
+    const holdPlenty = shouldHoldAtFour(state, me, 39, probs);
+    const denyPlenty = denialValue(state, me, probs);
+    check(holdShort && !holdPlenty && denyShort === 0 && denyTwo > 0 && denyPlenty === 0,
+        `Empty bank: hold Boardwalk at 4 houses; 2 left: a house denies orange $${denyTwo.toFixed(2)}/turn; 10 left: build the hotel`,
+        `Hold ${holdShort}/${holdPlenty}, denial ${denyShort}/${denyTwo}/${denyPlenty}`);
+}
+
+// Test 4: Whole games keep the bank's inventory consistent
+console.log('\n--- TEST 4: Bank invariant in play ---');
+{
+    const runner = createRunner({ maxTurns: 500 });
+    const lineup = ['starver', 'relative', 'starver', 'growth'];
+    let violations = 0, auctions = 0, turns = 0;
+    for (let g = 0; g < 6; g++) {
+        withSeed(12 + g, () => {
+            const engine = new GameEngine({ maxTurns: 500, houseAuctions: true });
+            engine.newGame(4, lineup.map(t => runner.createAIFactory(t)));
+            const executeTurn = engine.executeTurn.bind(engine);
+            engine.executeTurn = () => {
+                const result = executeTurn();
+                const ps = Object.values(engine.state.propertyStates);
+                const houses = ps.reduce((s, p) => s + (p.houses < 5 ? p.houses : 0), 0);
+                const hotels = ps.filter(p => p.houses === 5).length;
+                if (engine.state.housesAvailable + houses !== 32 || engine.state.hotelsAvailable + hotels !== 12 ||
+                    engine.state.housesAvailable < 0) violations++;
+                turns++;
+                return result;
+            };
+            quietly(() => engine.runGame());
+            auctions += engine.state.stats.houseAuctions || 0;
+        });
+    }
+    check(violations === 0 && auctions > 0,
+        `6 games, ${turns} turns: 32 houses / 12 hotels accounted for after every turn; ${auctions} house auctions`,
+        `${violations} inventory violations, ${auctions} auctions`);
+}
+
+summary(check, 'ALL HOUSE BANK TESTS PASSED');
@@ -0,0 +1,127 @@
+/**
+ * Test the MDP jail policy
+ */
+
+'use strict';
+
+const { GameEngine, COLOR_GROUPS } = require('./game-engine.js');
+const { JailPolicy } = require('./jail-policy.js');
+const { createCheck, header, summary } = require('./harness.js');
+
+/** Give player `owner` hotels on every color group */
+function developEverything(engine, owner) {
+    for (const group of Object.values(COLOR_GROUPS)) {
+        for (const sq of group.squares) {
+            engine.state.propertyStates[sq].owner = owner;
+            engine.state.propertyStates[sq].houses = 5;
+            engine.state.players[owner].properties.add(sq);
+            engine.propertyChanged(sq);
+        }
+    }
+}
+
+function main() {
+    const check = createCheck();
+
+    header('TESTING MDP JAIL POLICY');
+
+    // Test 1: Fresh board - leave to buy, unless bail can't be paid
+    console.log('\n--- TEST 1: Unowned board ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(4, []);
+        const policy = new JailPolicy(engine, 0, null);
+        check(policy.shouldLeave(1500, 0) && policy.shouldLeave(500, 1),
+            'Pays to leave while properties are for sale',
+            'Rolls on an unowned board');
+        check(!policy.shouldLeave(0, 0), 'Rolls when broke', 'Pays bail with no cash');
+    }
+
+    // Test 2: Opponent hotels everywhere - stay put
+    console.log('\n--- TEST 2: Developed opponents ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        developEverything(engine, 1);
+        const policy = new JailPolicy(engine, 0, null);
+        let pays = 0;
+        for (let cash = 0; cash <= 2000; cash += 100) {
+            for (let turn = 0; turn < 3; turn++) if (policy.shouldLeave(cash, turn)) pays++;
+        }
+        check(pays === 0, 'Rolls at every cash level and jail turn',
+            `Pays to leave in ${pays} cells`);
+    }
+
+    // Test 3: Policy iteration finds the best of all eight jail policies
+    console.log('\n--- TEST 3: Policy iteration vs exhaustive search ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(3, []);
+        for (const sq of COLOR_GROUPS.orange.squares) {
+            engine.state.propertyStates[sq].owner = 1;
+            engine.state.propertyStates[sq].houses = 3;
+        }
+        engine.state.propertyStates[5].owner = 2;
+        engine.state.propertyStates[25].owner = 2;
+        const policy = new JailPolicy(engine, 0, null);
+        policy.refresh();
+
+        let mismatches = 0;
+        for (const cash of [0, 40, 150, 400, 900, 2000]) {
+            const { policy: found } = policy.iterate(policy.landingValues(cash), cash);
+            const reward = policy.rewards(policy.landingValues(cash), cash);
+
+            const best = { value: -Infinity, code: null };
+            for (let code = 0; code < 8; code++) {
+                const p = [code & 1, (code >> 1) & 1, (code >> 2) & 1];
+                const V = policy.evaluate(p, reward, policy.params.discount);
+                // Optimal policies maximize every state at once; compare on turn 1
+                if (V[40] > best.value + 1e-9) {
+                    best.value = V[40];
+                    best.code = p.join('');
+                }
+            }
+            if (best.code !== found.join('')) mismatches++;
+        }
+        check(mismatches === 0, 'Matches the best of 8 policies at 6 cash levels',
+            `${mismatches} cash levels disagree`);
+    }
+
+    // Test 4: Table is only re-solved when the board moves materially
+    console.log('\n--- TEST 4: Refresh on material change ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        const policy = new JailPolicy(engine, 0, null);
+        policy.shouldLeave(1000, 0);
+        policy.shouldLeave(800, 1);
+        const afterFirst = policy.solves;
+
+        engine.state.propertyStates[1].owner = 1;       // Mediterranean: tiny change
+        engine.propertyChanged(1);
+        policy.shouldLeave(1000, 0);
+        const afterSmall = policy.solves;
+
+        developEverything(engine, 1);
+        policy.shouldLeave(1000, 0);
+        check(afterFirst === 1 && afterSmall === 1 && policy.solves === 2,
+            'One solve up front, none for Mediterranean, one for hotels',
+            `Solve counts ${afterFirst}, ${afterSmall}, ${policy.solves}`);
+    }
+
+    // Test 5: The speed die's transitions change the third-turn decision
+    console.log('\n--- TEST 5: Dice configuration ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        const classic = new JailPolicy(engine, 0, null);
+        const speed = new JailPolicy(engine, 0, null, { dice: 'speed' });
+        check(!classic.shouldLeave(500, 2) && speed.shouldLeave(500, 2) && speed.shouldLeave(500, 0),
+            'Speed-die transitions are solved separately from classic ones',
+            `Third turn at $500: classic ${classic.shouldLeave(500, 2)}, speed ${speed.shouldLeave(500, 2)}`);
+    }
+
+    summary(check, 'ALL JAIL POLICY TESTS PASSED');
+}
+
+main();
@@ -0,0 +1,117 @@
+/**
+ * Test the empirical meta-game solver
+ */
+
+'use strict';
+
+const {
+    enumerateLineups, opponentProfiles, seatOrder, PayoffTable, solveEquilibria, allocate, GamePool
+} = require('./meta-game.js');
+const { withSeed, deriveSeed } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+/**
+ * Fill a table with exact payoffs from a per-player function
+ * f(s, lineup), by writing the sums directly (as if from many games).
+ */
+function syntheticTable(k, f, games = 400) {
+    const table = new PayoffTable(k);
+    for (const e of table.entries.values()) {
+        e.games = games;
+        for (let s = 0; s < k; s++) {
+            if (!e.lineup.includes(s)) continue;
+            const p = f(s, e.lineup);
+            e.sum[s] = p * games;
+            e.sumSq[s] = p * p * games + 0.01 * games;
+        }
+    }
+    return table;
+}
+
+async function main() {
+    const check = createCheck();
+
+    header('TESTING META-GAME SOLVER');
+
+    // Test 1: Lineup enumeration and seat rotation
+    console.log('\n--- TEST 1: Lineups ---');
+    {
+        const lineups = enumerateLineups(4);
+        const x = [0.1, 0.2, 0.3, 0.4];
+        const total = opponentProfiles(4).reduce((sum, p) =>
+            sum + p.coef * p.counts.reduce((q, c, s) => q * Math.pow(x[s], c), 1), 0);
+        const seats = [0, 1, 2, 3].map(j => seatOrder([0, 0, 1, 2], j));
+        const balanced = [0, 1, 2, 3].every(seat => seats.filter(o => o[seat] === 0).length === 2);
+        check(lineups.length === 35 && Math.abs(total - 1) < 1e-12 && balanced,
+            '35 lineups for 4 AIs; opponent probabilities sum to 1; rotations balance seats',
+            `${lineups.length} lineups, total ${total}, balanced ${balanced}`);
+    }
+
+    // Test 2: Solver finds the uniform mix of a cyclic game and a dominant strategy
+    console.log('\n--- TEST 2: Equilibria ---');
+    {
+        // Rock-paper-scissors: each opponent you beat moves 0.06 of win share to you
+        const beats = (a, b) => (a - b + 3) % 3 === 1;
+        const rps = syntheticTable(3, (s, lineup) => {
+            const others = lineup.slice();
+            others.splice(others.indexOf(s), 1);
+            return 0.25 + others.reduce((d, t) => d + (beats(s, t) ? 0.06 : beats(t, s) ? -0.06 : 0), 0);
+        });
+        const [cyclic] = solveEquilibria(rps);
+        const uniform = cyclic.mix.every(v => Math.abs(v - 1 / 3) < 0.02);
+
+        // Strategy 1 takes 0.1 from every other player at the table
+        const dominant = syntheticTable(3, (s, lineup) => {
+            const n1 = lineup.filter(t => t === 1).length;
+            return s === 1 ? (0.25 * n1 + 0.1 * (4 - n1)) / n1 : 0.15;
+        });
+        const [pure] = solveEquilibria(dominant);
+        check(uniform && cyclic.regret < 1e-3 && pure.mix[1] === 1 && pure.regret < 1e-9,
+            `Cyclic game -> [${cyclic.mix.map(v => v.toFixed(3))}]; dominant -> pure strategy 1`,
+            `Cyclic [${cyclic.mix}] regret ${cyclic.regret}; dominant [${pure.mix}]`);
+    }
+
+    // Test 3: Allocation follows the equilibrium
+    console.log('\n--- TEST 3: Adaptive allocation ---');
+    {
+        const table = syntheticTable(3, () => 0.25, 8);
+        const plan = allocate(table, [0, 1, 0], 400, 0);
+        const used = [...plan].filter(([, games]) => games > 0).map(([key]) => key);
+        // Against 3 copies of strategy 1 only the deviation lineups matter
+        check(used.sort().join(' ') === '0,1,1,1 1,1,1,2' && [...plan.values()].every(g => g % 4 === 0),
+            `Pure equilibrium: games only to ${used.join(' and ')}, in whole rotations`,
+            `Plan ${JSON.stringify([...plan])}`);
+    }
+
+    // Test 4: Pool games replay inline with the same seeds and seats
+    console.log('\n--- TEST 4: Game pool ---');
+    {
+        const strategies = ['simple', 'growth'];
+        const lineup = [0, 0, 1, 1];
+        const pool = new GamePool(strategies, { workers: 2 });
+        await pool.start();
+        const pooled = await pool.play(lineup, 7, 4, 6);
+        await pool.stop();
+
+        const { GameEngine } = require('./game-engine.js');
+        const runner = createRunner({ maxTurns: 500 });
+        const inline = quietly(() => [4, 5, 6, 7, 8, 9].map(j => {
+            const seats = seatOrder(lineup, j);
+            const result = withSeed(deriveSeed(7, j), () => {
+                const engine = new GameEngine({ maxTurns: 500 });
+                engine.newGame(4, seats.map(s => runner.createAIFactory(strategies[s])));
+                return engine.runGame();
+            });
+            return result.winner === null ? -1 : seats[result.winner];
+        }));
+        check(pooled.join() === inline.join(), `Games 4-9 winners [${pooled}] both ways`,
+            `Pool [${pooled}], inline [${inline}]`);
+    }
+
+    summary(check, 'ALL META-GAME TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
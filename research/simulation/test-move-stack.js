@@ -0,0 +1,173 @@
+/**
+ * Test make/unmake on the move stack
+ */
+
+'use strict';
+
+const { GameEngine, BOARD, COLOR_GROUPS } = require('./game-engine.js');
+const { MoveStack, fingerprint } = require('./move-stack.js');
+const { withSeed, createRandom } = require('./seeded-random.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+/** One random action for the current position of the walk */
+function randomAction(stack, random) {
+    const state = stack.state;
+    const player = state.getCurrentPlayer();
+    const die = () => 1 + Math.floor(random() * 6);
+    const mine = [...player.properties];
+    const pick = (list) => list[Math.floor(random() * list.length)];
+
+    switch (Math.floor(random() * 7)) {
+        case 0: {
+            const landing = stack.makeRoll(die(), die());
+            if (landing.card) stack.makeCard(landing.card, Math.floor(random() * 16), die() + die());
+            else if (landing.unowned) stack.makeBuy(landing.position);
+            return;
+        }
+        case 1: return mine.length ? stack.makeBuild(pick(mine)) : stack.makeEndTurn();
+        case 2: return mine.length ? stack.makeSellHouse(pick(mine)) : stack.makeEndTurn();
+        case 3: return mine.length ? stack.makeMortgage(pick(mine)) : stack.makeEndTurn();
+        case 4: return mine.length ? stack.makeUnmortgage(pick(mine)) : stack.makeEndTurn();
+        case 5: {
+            const other = pick(state.getActivePlayers().filter(p => p.id !== player.id));
+            if (!other) return stack.makeEndTurn();
+            const theirs = [...other.properties];
+            return stack.makeTrade({
+                from: player,
+                to: other,
+                fromProperties: new Set(mine.length ? [pick(mine)] : []),
+                toProperties: new Set(theirs.length ? [pick(theirs)] : []),
+                fromCash: Math.floor(random() * 200) - 100
+            });
+        }
+        default: return stack.makeEndTurn();
+    }
+}
+
+function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const check = createCheck();
+
+    header('TESTING MAKE/UNMAKE MOVE STACK');
+
+    // Test 1: Random walks with debug checks on every unmake
+    console.log('\n--- TEST 1: Random walks (debug) ---');
+    {
+        let nodes = 0;
+        let error = null;
+        let trackersOk = true;
+        for (let seed = 1; seed <= 5 && !error; seed++) {
+            const engine = withSeed(seed, () => quietly(() => {
+                const e = new GameEngine({ maxTurns: 300 });
+                e.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+                for (let i = 0; i < 60 + 20 * seed && !e.state.isGameOver(); i++) e.executeTurn();
+                return e;
+            }));
+            const tracker = engine.getEPTTracker(engine.state.players[1].ai.probs);
+            const stack = new MoveStack(engine, { debug: true });
+            const random = createRandom(seed);
+            const before = fingerprint(engine);
+
+            try {
+                for (let walk = 0; walk < 300; walk++) {
+                    const depth = 1 + Math.floor(random() * 8);
+                    for (let d = 0; d < depth; d++) {
+                        randomAction(stack, random);
+                        nodes++;
+                    }
+                    stack.unmakeTo(0);
+                }
+            } catch (e) {
+                error = e;
+            }
+
+            if (!error && fingerprint(engine) !== before) error = new Error('state changed after walks');
+            const fresh = new tracker.constructor(engine.state, tracker.probs);
+            trackersOk = trackersOk && engine.state.players.every(p =>
+                tracker.incomeSum[p.id] === fresh.incomeSum[p.id]);
+        }
+        check(!error, `${nodes} actions made and unmade exactly`, `Walk failed: ${error && error.message}`);
+        check(trackersOk, 'EPT tracker back in step after every walk', 'EPT tracker drifted');
+    }
+
+    // Test 2: A roll pays the rent the engine would charge
+    console.log('\n--- TEST 2: Roll and rent ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        for (const sq of COLOR_GROUPS.orange.squares) {
+            engine.state.propertyStates[sq].owner = 1;
+            engine.state.propertyStates[sq].houses = 3;
+            engine.state.players[1].properties.add(sq);
+            engine.state.housesAvailable -= 3;
+        }
+        engine.state.players[0].position = 10;
+        const stack = new MoveStack(engine, { debug: true });
+        const landing = stack.makeRoll(4, 4);    // 10 -> 18 Tennessee
+        const paid = 1500 - engine.state.players[0].money;
+        check(landing.position === 18 && landing.doubles && paid === BOARD[18].rent[3] &&
+            engine.state.players[1].money === 1500 + paid,
+            `Landed on Tennessee and paid $${paid}`,
+            `Landing ${JSON.stringify(landing)}, paid ${paid}`);
+        stack.unmake();
+        check(engine.state.players[0].position === 10 && engine.state.players[0].money === 1500,
+            'Unmake puts the player back on Just Visiting with $1500',
+            'Roll not undone');
+
+        // Fractional balances (interest, split payments) must survive undo
+        const player = engine.state.players[0];
+        player.money = 1317.5;
+        player.position = 0;
+        stack.makeRoll(1, 3);                   // Income Tax
+        const taxed = player.money;
+        stack.unmake();
+        check(taxed === 1317.5 - BOARD[4].amount && player.money === 1317.5,
+            'Income Tax from $1317.50 undone to the cent',
+            `After undo: $${player.money}`);
+    }
+
+    // Test 3: Set order survives a trade and its undo
+    console.log('\n--- TEST 3: Property order restored ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        const [a, b] = engine.state.players;
+        for (const sq of [39, 5, 21, 12]) {
+            engine.state.propertyStates[sq].owner = 0;
+            a.properties.add(sq);
+        }
+        engine.state.propertyStates[1].owner = 1;
+        b.properties.add(1);
+
+        const stack = new MoveStack(engine, { debug: true });
+        stack.makeTrade({ from: a, to: b, fromProperties: new Set([5, 21]), toProperties: new Set([1]), fromCash: 40 });
+        const traded = [...a.properties].join(',') === '39,12,1' && [...b.properties].join(',') === '5,21';
+        stack.unmake();
+        check(traded && [...a.properties].join(',') === '39,5,21,12' && [...b.properties].join(',') === '1',
+            'Trade applied, then undone with the original Set order',
+            `After undo: [${[...a.properties]}] / [${[...b.properties]}]`);
+    }
+
+    // Test 4: Debug mode catches writes that bypass the stack
+    console.log('\n--- TEST 4: Debug detects untracked writes ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2, []);
+        const stack = new MoveStack(engine, { debug: true });
+        stack.makeRoll(2, 3);
+        engine.state.players[1].money += 1;
+        let caught = false;
+        try {
+            stack.unmake();
+        } catch (e) {
+            caught = /differs after unmake/.test(e.message);
+        }
+        check(caught, 'Mismatch reported on unmake', 'Untracked write went unnoticed');
+    }
+
+    summary(check, 'ALL MOVE STACK TESTS PASSED');
+}
+
+main();
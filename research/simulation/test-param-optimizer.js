@@ -0,0 +1,100 @@
+/**
+ * Test the CMA-ES + successive-halving optimizer
+ */
+
+'use strict';
+
+const { CMAES, eigenSymmetric, race, decode, encode, playBlocks, EvaluationPool } = require('./param-optimizer.js');
+const { PARAMETERS, GeneticAlgorithm } = require('./genetic-algorithm.js');
+const { createRandom } = require('./seeded-random.js');
+const { quietly, createCheck, header, summary } = require('./harness.js');
+
+async function main() {
+    const check = createCheck();
+
+    header('TESTING CMA-ES PARAMETER OPTIMIZER');
+
+    // Test 1: Jacobi eigendecomposition reconstructs the matrix
+    console.log('\n--- TEST 1: Eigendecomposition ---');
+    {
+        const random = createRandom(3);
+        const n = 8;
+        const M = [];
+        for (let i = 0; i < n; i++) M.push(Array.from({ length: n }, () => random() - 0.5));
+        const A = M.map((row, i) => row.map((_, j) => M.reduce((s, r) => s + r[i] * r[j], 0)));
+        const { values, vectors: V } = eigenSymmetric(A);
+        let err = 0;
+        for (let i = 0; i < n; i++) {
+            for (let j = 0; j < n; j++) {
+                let x = 0;
+                for (let k = 0; k < n; k++) x += V[i][k] * values[k] * V[j][k];
+                err = Math.max(err, Math.abs(x - A[i][j]));
+            }
+        }
+        check(err < 1e-10 && values.every(v => v > -1e-12),
+            `V diag(D) V^T = A to ${err.toExponential(1)}`, `Reconstruction error ${err}`);
+    }
+
+    // Test 2: CMA-ES finds the optimum of a noisy, skewed quadratic in the box
+    console.log('\n--- TEST 2: Noisy quadratic ---');
+    {
+        const random = createRandom(11);
+        const target = [0.2, 0.9, 0.5, 0.35, 0.7, 0.1, 0.6, 0.45];
+        const fitness = (x) => -x.reduce((s, v, i) => s + (i + 1) * (v - target[i]) ** 2, 0) + 0.002 * (random() - 0.5);
+        const es = new CMAES(new Array(8).fill(0.5), 0.3, { lower: 0, upper: 1, random });
+        let evaluations = 0;
+        for (let g = 0; g < 150; g++) {
+            const points = es.ask();
+            const scored = points.map(x => ({ x, f: fitness(x) }));
+            evaluations += points.length;
+            scored.sort((a, b) => b.f - a.f);
+            es.tell(scored.map(s => s.x));
+        }
+        const dist = Math.sqrt(es.mean.reduce((s, v, i) => s + (v - target[i]) ** 2, 0));
+        check(dist < 0.05, `Mean within ${dist.toFixed(3)} of the optimum after ${evaluations} evaluations`,
+            `Mean ${dist.toFixed(3)} away`);
+    }
+
+    // Test 3: Successive halving keeps the best arm and spends less
+    console.log('\n--- TEST 3: Successive halving ---');
+    {
+        const random = createRandom(5);
+        const rates = [0.20, 0.22, 0.25, 0.18, 0.35, 0.24, 0.21, 0.23, 0.19, 0.26];
+        let games = 0;
+        const evaluate = (i, firstBlock, blocks) => {
+            let wins = 0;
+            for (let g = 0; g < blocks * 20; g++) if (random() < rates[i]) wins++;
+            games += blocks * 20;
+            return Promise.resolve({ wins, games: blocks * 20 });
+        };
+        const ranking = await race(rates.length, evaluate, { rungs: [5, 10, 20, 40], eta: 2 });
+        const uniform = rates.length * 40 * 20;
+        check(ranking[0].index === 4 && ranking[0].games === 800 && games < uniform / 2,
+            `Best arm won with ${games} games (uniform: ${uniform})`,
+            `Winner ${ranking[0].index}, ${games} games`);
+        check(ranking.every((e, i) => i === 0 || e.rung <= ranking[i - 1].rung),
+            'Ranked by rung reached, then win rate', 'Ranking out of order');
+    }
+
+    // Test 4: Pool plays the same games as in-process evaluation
+    console.log('\n--- TEST 4: Evaluation pool ---');
+    {
+        const genome = decode(encode(Object.fromEntries(PARAMETERS.map(p => [p.name, p.default]))));
+        const ga = quietly(() => new GeneticAlgorithm({ verbose: false }));
+        const inline = quietly(() => playBlocks(ga, genome, 99, 3, 1, 500));
+        const pool = new EvaluationPool({ workers: 2 });
+        await pool.start();
+        const pooled = await pool.evaluate(genome, 99, 3, 1);
+        await pool.stop();
+        check(pooled.wins === inline.wins && pooled.games === 20,
+            `Block 3: ${pooled.wins}/${pooled.games} wins both ways`,
+            `Pool ${pooled.wins}/${pooled.games}, inline ${inline.wins}/${inline.games}`);
+    }
+
+    summary(check, 'ALL OPTIMIZER TESTS PASSED');
+}
+
+main().catch(err => {
+    console.error(err);
+    process.exitCode = 1;
+});
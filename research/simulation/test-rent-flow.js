@@ -0,0 +1,110 @@
+/**
+ * Test the incremental rent-flow matrix against direct recomputation
+ */
+
+'use strict';
+
+const { GameEngine } = require('./game-engine.js');
+const { withSeed } = require('./seeded-random.js');
+const { createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+const TOLERANCE = 1e-6;
+
+/** F[i][j] straight from calculateRent, for rows with the given landing vectors */
+function directFlow(engine, landing) {
+    const players = engine.state.players;
+    return players.map((payer, i) => players.map((payee, j) => {
+        if (i === j || payer.bankrupt || payee.bankrupt) return 0;
+        let total = 0;
+        for (const sq of payee.properties) {
+            total += landing[i][sq] * engine.calculateRent(sq, 7);
+        }
+        return total;
+    }));
+}
+
+function maxError(flow, expected) {
+    let worst = 0;
+    const actual = flow.matrix();
+    for (let i = 0; i < actual.length; i++) {
+        for (let j = 0; j < actual.length; j++) {
+            worst = Math.max(worst, Math.abs(actual[i][j] - expected[i][j]));
+        }
+    }
+    return worst;
+}
+
+function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const probs = runner.markovEngine.getAllProbabilities('stay');
+    const transitions = runner.markovEngine.getTransitionMatrix();
+    const check = createCheck();
+
+    header('TESTING RENT-FLOW MATRIX');
+
+    // Test 1: Incremental F matches direct recomputation after every turn
+    console.log('\n--- TEST 1: Incremental vs direct ---');
+    {
+        let checks = 0;
+        let worst = 0;
+        let worstZeroSum = 0;
+        for (let seed = 1; seed <= 20; seed++) {
+            withSeed(seed, () => {
+                const engine = new GameEngine({ maxTurns: 300 });
+                engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+                const flow = engine.getRentFlow(probs);
+                const landing = engine.state.players.map(() => probs);
+
+                while (!engine.state.isGameOver() && engine.state.turn < engine.options.maxTurns) {
+                    engine.executeTurn();
+                    worst = Math.max(worst, maxError(flow, directFlow(engine, landing)));
+
+                    const drift = engine.state.players.reduce((sum, p) => sum + flow.netDrift(p.id), 0);
+                    worstZeroSum = Math.max(worstZeroSum, Math.abs(drift));
+                    checks++;
+                }
+            });
+        }
+
+        check(worst < TOLERANCE,
+            `${checks} positions, max error ${worst.toExponential(2)}`,
+            `Max error ${worst} over ${checks} positions`);
+        check(worstZeroSum < TOLERANCE,
+            `Net drift sums to zero (max residual ${worstZeroSum.toExponential(2)})`,
+            `Net drift residual ${worstZeroSum}`);
+    }
+
+    // Test 2: Position-conditioned rows, then back to steady state
+    console.log('\n--- TEST 2: Conditioned landing vectors ---');
+    {
+        const engine = withSeed(3, () => {
+            const e = new GameEngine({ maxTurns: 300 });
+            e.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+            for (let i = 0; i < 25 && !e.state.isGameOver(); i++) e.executeTurn();
+            return e;
+        });
+        const flow = engine.getRentFlow(probs);
+
+        flow.conditionOnPositions(transitions);
+        const landing = engine.state.players.map(p =>
+            transitions[p.inJail ? 10 : p.position].slice(0, 40));
+        const conditioned = maxError(flow, directFlow(engine, landing));
+
+        flow.useSteadyState();
+        const steady = maxError(flow, directFlow(engine, engine.state.players.map(() => probs)));
+
+        // Another copy of the same probabilities (each AI holds its own) keeps the matrix
+        flow.conditionOnPositions(transitions);
+        const kept = engine.getRentFlow([...probs]) === flow && engine.getRentFlow() === flow &&
+            maxError(flow, directFlow(engine, landing)) < TOLERANCE;
+
+        check(conditioned < TOLERANCE && steady < TOLERANCE && kept,
+            'Conditioned and steady-state rows match direct recomputation; copies reuse the matrix',
+            `Errors: conditioned ${conditioned}, steady ${steady}, reused ${kept}`);
+    }
+
+    summary(check, 'ALL RENT-FLOW TESTS PASSED');
+}
+
+main();
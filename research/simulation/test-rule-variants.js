@@ -0,0 +1,198 @@
+/**
+ * Test rule-variant engines and the variant registry
+ */
+
+'use strict';
+
+const { GameEngine, COLOR_GROUPS } = require('./game-engine.js');
+const { AuctionGameEngine } = require('./auction-game-engine.js');
+const { AsyncGameEngine } = require('./async-game-engine.js');
+const { variantClass, createEngine, listVariants, parseVariant } = require('./rule-variants.js');
+const { withSeed, withSeedAsync } = require('./seeded-random.js');
+const { createCheck, header, summary } = require('./harness.js');
+
+const check = createCheck();
+
+/** Replace Math.random with a fixed sequence of die faces (1-6) */
+function withDice(faces, fn) {
+    const random = Math.random;
+    let i = 0;
+    Math.random = () => (faces[i++ % faces.length] - 1) / 6 + 0.01;
+    try {
+        return fn();
+    } finally {
+        Math.random = random;
+    }
+}
+
+header('TESTING RULE VARIANTS');
+
+// Test 1: Registry
+console.log('\n--- TEST 1: Registry ---');
+{
+    const a = variantClass('speedDie+freeParking');
+    const b = variantClass('freeParking+speedDie');
+    const onAuction = variantClass('speedDie', AuctionGameEngine);
+    let unknown = false;
+    try { parseVariant('speedDie+lottery'); } catch (e) { unknown = true; }
+    // The auction engine never offers a purchase, so there is nothing for noAuction to skip
+    let contradictory = false;
+    try { variantClass('noAuction+doubleGo', AuctionGameEngine); } catch (e) { contradictory = true; }
+    check(variantClass('standard') === GameEngine && a === b && new a() instanceof GameEngine &&
+        new onAuction() instanceof AuctionGameEngine && onAuction !== variantClass('speedDie') &&
+        unknown && contradictory && listVariants().length === 6,
+        `${a.name}: one cached class per rule set and base; unknown rules and noAuction over auctions rejected`,
+        `standard ${variantClass('standard').name}, cached ${a === b}, unknown rejected ${unknown}, ` +
+        `noAuction over AuctionGameEngine rejected ${contradictory}`);
+}
+
+// Test 2: Money rules - free parking jackpot and double GO
+console.log('\n--- TEST 2: Free parking and double GO ---');
+{
+    const engine = createEngine('freeParking+doubleGo');
+    engine.newGame(2);
+    const [p0, p1] = engine.state.players;
+    engine.handleLanding(p0, 4, 7);            // Income tax $200
+    engine.handleLanding(p0, 38, 7);           // Luxury tax $100
+    const pot = engine.state.freeParkingPot;
+    engine.handleLanding(p1, 20, 7);
+    engine.handleLanding(p1, 0, 7);
+    engine.advanceToGo(p0);
+
+    const standard = new GameEngine();
+    standard.newGame(2);
+    standard.handleLanding(standard.state.players[0], 4, 7);
+    standard.handleLanding(standard.state.players[1], 20, 7);
+    check(pot === 300 && p1.money === 1500 + 300 + 200 && engine.state.freeParkingPot === 0 &&
+        p0.money === 1500 - 300 + 400 && standard.state.players[1].money === 1500 &&
+        standard.state.freeParkingPot === undefined,
+        'Taxes fund a $300 pot collected on Free Parking; GO pays $200 extra; standard engine unchanged',
+        `Pot ${pot}, p0 $${p0.money}, p1 $${p1.money}`);
+}
+
+// Test 3: Property rules - no auction and uneven building
+console.log('\n--- TEST 3: No auction and uneven building ---');
+{
+    const engine = createEngine('noAuction+unevenBuild');
+    engine.newGame(2);
+    const [p0] = engine.state.players;
+    p0.ai = { decideBuy: () => false };
+    engine.handleLanding(p0, 39, 7);
+    const declined = engine.state.propertyStates[39].owner;
+
+    for (const sq of COLOR_GROUPS.orange.squares) {
+        engine.state.propertyStates[sq].owner = 0;
+        p0.properties.add(sq);
+    }
+    const stacked = [1, 2, 3].every(() => engine.buildHouse(p0, 16));
+    const standard = new GameEngine();
+    standard.newGame(2);
+    const q0 = standard.state.players[0];
+    for (const sq of COLOR_GROUPS.orange.squares) {
+        standard.state.propertyStates[sq].owner = 0;
+        q0.properties.add(sq);
+    }
+    const even = standard.buildHouse(q0, 16) && !standard.buildHouse(q0, 16);
+    check(declined === null && stacked && engine.state.propertyStates[16].houses === 3 &&
+        engine.sellHouse(p0, 16) === 50 && even,
+        'Declined Boardwalk stays unowned; 3 houses on St. James Place alone; standard still builds evenly',
+        `Owner ${declined}, stacked ${stacked}, even ${even}`);
+}
+
+// Test 4: Speed die
+console.log('\n--- TEST 4: Speed die ---');
+{
+    const engine = createEngine('speedDie');
+    engine.newGame(2);
+    const [p0, p1] = engine.state.players;
+    // Buy nothing, so landings stay quiet
+    p0.ai = { decideBuy: () => false };
+    for (const sq of [1, 3, 5, 6]) engine.state.propertyStates[sq].owner = 1;
+    engine.runAuction = () => {};
+
+    // 2 + 1, Mr. Monopoly: Baltic (owned) -> Oriental (owned) -> Vermont, the first unowned
+    withDice([2, 1, 4], () => engine.handleNormalTurn(p0));
+    const monopoly = p0.position;
+    // 3 + 3 + 3: triples go to the next unowned square (Connecticut) and end the turn
+    withDice([3, 3, 3], () => engine.handleNormalTurn(p0));
+    const triples = p0.position;
+    // 1 + 2 + 2 = 5 spaces
+    p1.position = 0;
+    withDice([1, 2, 2], () => engine.handleNormalTurn(p1));
+    const plain = p1.position;
+
+    // Whole games under the combined variant
+    let turns = 0, ok = true;
+    for (let g = 0; g < 10; g++) {
+        const result = withSeed(40 + g, () => {
+            const game = createEngine('speedDie+freeParking+doubleGo', { maxTurns: 300 });
+            game.newGame(4);
+            return game.runGame();
+        });
+        turns += result.turns;
+        ok = ok && result.turns > 0;
+    }
+    check(monopoly === 8 && triples === 9 && plain === 5 && ok,
+        `Mr. Monopoly skips owned squares, triples end on Connecticut, 1-2-2 moves 5; 10 games, ${turns} turns`,
+        `Mr. Monopoly ${monopoly}, triples ${triples}, plain ${plain}, games ok ${ok}`);
+}
+
+// Test 5: The async engine's jail fees go through payBank
+console.log('\n--- TEST 5: Async engine jail fees ---');
+(async () => {
+    const engine = createEngine('freeParking', {}, AsyncGameEngine);
+    engine.newGame(2, [{ decideJail: () => true }, { decideJail: () => false }]);
+    const [p0, p1] = engine.state.players;
+    engine.sendToJail(p0);
+    engine.sendToJail(p1);
+    p1.jailTurns = 2;
+
+    // 1 + 2 from jail reaches States Avenue for both: no tax, no card
+    // withDice restores Math.random before the awaited turns roll, so stub it here
+    const random = Math.random;
+    let i = 0;
+    Math.random = () => ([1, 2][i++ % 2] - 1) / 6 + 0.01;
+    try {
+        await engine.handleJailTurnAsync(p0);   // posts bail
+        await engine.handleJailTurnAsync(p1);   // pays on the third turn
+    } finally {
+        Math.random = random;
+    }
+    check(engine.state.freeParkingPot === 100 && !p0.inJail && !p1.inJail,
+        'Bail and the third-turn fee both reach the Free Parking pot',
+        `Pot ${engine.state.freeParkingPot}, in jail ${p0.inJail}/${p1.inJail}`);
+
+    // Test 6: noAuction and speedDie change the async turn, not just the sync one
+    console.log('\n--- TEST 6: Async engine as the base ---');
+    const decliner = { decideBuy: () => false, decideBid: () => 500 };
+    let owned = 0, declines = 0;
+    for (let g = 0; g < 5; g++) {
+        const game = createEngine('noAuction', { maxTurns: 100 }, AsyncGameEngine);
+        game.newGame(2, [decliner, decliner]);
+        const runAuction = game.runAuction;
+        game.runAuction = (position) => { declines++; runAuction.call(game, position); };
+        await withSeedAsync(70 + g, () => game.runGameAsync());
+        owned += Object.values(game.state.propertyStates).filter(ps => ps.owner !== null).length;
+    }
+
+    const speed = createEngine('speedDie', {}, AsyncGameEngine);
+    speed.newGame(2, [{ decideBuy: () => false }, null]);
+    const [s0] = speed.state.players;
+    for (const sq of [1, 3, 5, 6]) speed.state.propertyStates[sq].owner = 1;
+    let speedRolls = 0;
+    const rollSpeedDie = speed.rollSpeedDie;
+    speed.rollSpeedDie = () => { speedRolls++; return rollSpeedDie.call(speed); };
+    // 2 + 1, Mr. Monopoly: Baltic (owned) -> Oriental (owned) -> Vermont, the first unowned
+    i = 0;
+    Math.random = () => ([2, 1, 4][i++ % 3] - 1) / 6 + 0.01;
+    try {
+        await speed.handleNormalTurnAsync(s0);
+    } finally {
+        Math.random = random;
+    }
+    check(owned === 0 && declines > 0 && speedRolls === 1 && s0.position === 8,
+        `${declines} declined squares stay with the bank in async games; Mr. Monopoly moves an async turn to Vermont`,
+        `${owned} squares owned after ${declines} declines, ${speedRolls} speed rolls, position ${s0.position}`);
+
+    summary(check, 'ALL RULE VARIANT TESTS PASSED');
+})();
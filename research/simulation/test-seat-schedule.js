@@ -0,0 +1,84 @@
+/**
+ * Test seat-balanced schedules
+ */
+
+'use strict';
+
+const { SeatSchedule, williamsSquare } = require('./seat-schedule.js');
+const { quietly, createRunner, createCheck, header, summary } = require('./harness.js');
+
+const check = createCheck();
+
+header('TESTING SEAT-BALANCED SCHEDULES');
+
+// Test 1: Williams squares are Latin and balance who follows whom
+console.log('\n--- TEST 1: Williams squares ---');
+for (const n of [4, 5]) {
+    const rows = williamsSquare(n);
+    const latin = Array.from({ length: n }, (_, col) => rows.map(r => r[col]))
+        .every(col => [...Array(n).keys()].every(v => col.filter(x => x === v).length === rows.length / n));
+    const follows = {};
+    for (const r of rows) {
+        for (let k = 1; k < n; k++) follows[`${r[k - 1]}>${r[k]}`] = (follows[`${r[k - 1]}>${r[k]}`] || 0) + 1;
+    }
+    const counts = new Set(Object.values(follows));
+    check(latin && Object.keys(follows).length === n * (n - 1) && counts.size === 1,
+        `n=${n}: ${rows.length} rows, every entry in every seat, each ordered pair adjacent ${[...counts][0]}x`,
+        `n=${n}: latin ${latin}, pairs ${JSON.stringify(follows)}`);
+}
+
+// Test 2: Blocks share a seed and give each entry every seat once
+console.log('\n--- TEST 2: Schedule blocks ---');
+{
+    const schedule = new SeatSchedule(4, { mode: 'cyclic', seed: 9 });
+    const block = [4, 5, 6, 7].map(i => schedule.game(i));
+    const seatsOfEntry0 = block.map(g => g.order.indexOf(0)).sort().join();
+    const seeds = new Set(block.map(g => g.seed));
+    check(seatsOfEntry0 === '0,1,2,3' && seeds.size === 1 && schedule.game(8).seed !== block[0].seed &&
+        block.every(g => g.block === 1),
+        'Games 4-7 form block 1: one shared seed, entry 0 in seats 0-3',
+        `Seats ${seatsOfEntry0}, ${seeds.size} seeds`);
+}
+
+// Test 3: With identical AIs and common seeds, seat bias cancels exactly
+console.log('\n--- TEST 3: Exact cancellation in SimulationRunner ---');
+{
+    const runner = createRunner({ seating: 'latin', seed: 5 });
+    const results = quietly(() => runner.runSimulation(['growth', 'growth', 'growth', 'growth'], 12));
+    const perBlock = results.seating.entries.map(e => e.rate);
+    const equal = results.wins.every(w => w === results.wins[0]);
+    check(equal && results.wins[0] > 0 && results.seating.entries.every(e => e.se === 0) &&
+        results.seating.entries[0].blocks === 3,
+        `3 Latin blocks: every player won ${results.wins[0]}, block SE 0; seat wins [${results.seating.seatWins}]`,
+        `Wins [${results.wins}], block rates [${perBlock}]`);
+}
+
+// Test 4: Auction runner maps winners back to lineup entries
+console.log('\n--- TEST 4: AuctionSimulationRunner seating ---');
+{
+    const { AuctionSimulationRunner } = quietly(() => require('./auction-game-engine.js'));
+    const runner = quietly(() => new AuctionSimulationRunner({ seating: 'cyclic', seed: 3 }));
+    const results = quietly(() => runner.runSimulation(['growth', 'growth', 'growth', 'growth'], 8));
+    const decided = results.games - results.timeouts;
+    check(results.wins.every(w => w === results.wins[0]) && results.wins[0] > 0 && results.wins[0] * 4 === decided,
+        `2 cyclic blocks: wins [${results.wins}] split evenly`,
+        `Wins [${results.wins}], ${results.timeouts} timeouts`);
+}
+
+// Test 5: Per-game records name the same winners as the win table
+console.log('\n--- TEST 5: Per-game winners under Latin seating ---');
+{
+    const runner = createRunner({ maxTurns: 300, seating: 'latin', seed: 3 });
+    const results = quietly(() => runner.runSimulation(['strategic', 'relative', 'growth', 'optimal'], 8));
+    const tally = results.aiTypes.map(() => 0);
+    let consistent = true;
+    for (const game of results.gameResults) {
+        if (game.winner !== null) tally[game.winner]++;
+        if (game.winner !== (game.seatWinner === null ? null : game.order[game.seatWinner])) consistent = false;
+    }
+    check(consistent && tally.every((w, i) => w === results.wins[i]),
+        `gameResults winners tally to the win table [${results.wins}]`,
+        `gameResults tally [${tally}] vs wins [${results.wins}], seat mapping ok ${consistent}`);
+}
+
+summary(check, 'ALL SEAT SCHEDULE TESTS PASSED');
@@ -0,0 +1,111 @@
+/**
+ * Test the packed state view's rent against GameEngine.calculateRent
+ */
+
+'use strict';
+
+const { GameEngine, BOARD, COLOR_GROUPS, SQUARE_TYPES } = require('./game-engine.js');
+const { withSeed } = require('./seeded-random.js');
+const { createRunner, createCheck, header, summary } = require('./harness.js');
+
+const LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+const OWNABLE = BOARD.map((sq, i) => i).filter(i => BOARD[i].price);
+
+/** Which rent rule a square is under right now */
+function rentCase(engine, sq) {
+    const ps = engine.state.propertyStates[sq];
+    if (ps.owner === null) return 'unowned';
+    if (ps.mortgaged) return 'mortgaged';
+    const square = BOARD[sq];
+    const owner = engine.state.players[ps.owner];
+    if (square.type === SQUARE_TYPES.RAILROAD) return `railroad x${owner.getRailroadCount()}`;
+    if (square.type === SQUARE_TYPES.UTILITY) return `utility x${owner.getUtilityCount()}`;
+    if (ps.houses > 0) return ps.houses === 5 ? 'hotel' : 'houses';
+    return owner.hasMonopoly(square.group, engine.state) ? 'monopoly' : 'street';
+}
+
+/** Compare every ownable square at every dice total; returns mismatch count */
+function compareRents(engine, seen) {
+    const view = engine.getStateView();
+    let mismatches = 0;
+    for (const sq of OWNABLE) {
+        const kind = rentCase(engine, sq);
+        seen[kind] = (seen[kind] || 0) + 1;
+        for (let roll = 2; roll <= 12; roll++) {
+            if (view.rent(sq, roll) !== engine.calculateRent(sq, roll)) mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+function main() {
+    const runner = createRunner({ maxTurns: 300 });
+    const check = createCheck();
+
+    header('TESTING PACKED STATE VIEW');
+
+    // Test 1: Rent agrees with the engine after every turn of seeded games
+    console.log('\n--- TEST 1: view.rent() vs calculateRent over seeded games ---');
+    {
+        const seen = {};
+        let mismatches = 0;
+        let states = 0;
+        for (let seed = 1; seed <= 20; seed++) {
+            withSeed(seed, () => {
+                const engine = new GameEngine({ maxTurns: 300 });
+                engine.newGame(4, LINEUP.map(t => runner.createAIFactory(t)));
+                while (!engine.state.isGameOver() && engine.state.turn < engine.options.maxTurns) {
+                    engine.executeTurn();
+                    mismatches += compareRents(engine, seen);
+                    states++;
+                }
+            });
+        }
+
+        const required = ['houses', 'hotel', 'monopoly', 'street', 'mortgaged',
+            'railroad x1', 'railroad x2', 'railroad x3', 'railroad x4', 'utility x1', 'utility x2'];
+        const missing = required.filter(kind => !seen[kind]);
+        console.log(`  ${Object.keys(seen).sort().map(k => `${k}: ${seen[k]}`).join(', ')}`);
+        check(mismatches === 0 && missing.length === 0,
+            `${states} states, every square and dice total identical`,
+            `${mismatches} mismatches; never saw ${missing.join(', ') || '-'}`);
+    }
+
+    // Test 2: Hand-built states for the rules seeded games rarely reach
+    console.log('\n--- TEST 2: Constructed ownership patterns ---');
+    {
+        const engine = new GameEngine();
+        engine.newGame(2);
+        const [p0, p1] = engine.state.players;
+        const give = (player, sq) => {
+            engine.state.propertyStates[sq].owner = player.id;
+            player.properties.add(sq);
+        };
+
+        // All four railroads, both utilities, dark blue with one square mortgaged
+        for (const sq of [5, 15, 25, 35, 12, 28]) give(p0, sq);
+        for (const sq of COLOR_GROUPS.darkBlue.squares) give(p1, sq);
+        engine.state.propertyStates[37].mortgaged = true;
+        const seen = {};
+        const patterns = [compareRents(engine, seen)];
+
+        // Railroads and utilities split between players; a hotel on Boardwalk
+        engine.state.propertyStates[37].mortgaged = false;
+        engine.state.propertyStates[39].houses = 5;
+        for (const sq of [15, 28]) {
+            p0.properties.delete(sq);
+            give(p1, sq);
+        }
+        patterns.push(compareRents(engine, seen));
+
+        const view = engine.getStateView();
+        check(patterns.every(n => n === 0) && view.rent(5) === 100 && view.rent(12, 9) === 36 &&
+            view.rent(39) === 2000 && view.rent(37) === 70,
+            `Four railroads, split utilities, hotels and mortgaged monopolies match (${Object.keys(seen).length} cases)`,
+            `Mismatches ${patterns}, RR ${view.rent(5)}, utility ${view.rent(12, 9)}, Boardwalk ${view.rent(39)}`);
+    }
+
+    summary(check, 'ALL STATE VIEW TESTS PASSED');
+}
+
+main();
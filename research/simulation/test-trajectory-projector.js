@@ -0,0 +1,472 @@
+/**
+ * Test the batched trajectory projector against the turn-by-turn loops
+ */
+
+'use strict';
+
+const { BOARD, COLOR_GROUPS, RAILROAD_RENT, UTILITY_MULTIPLIER } = require('./game-engine.js');
+const { DICE_EPT } = require('./relative-growth-ai.js');
+const { withSeed } = require('./seeded-random.js');
+const { createRunner, createCheck, header, summary } = require('./harness.js');
+
+const GROUPS = Object.keys(COLOR_GROUPS);
+const OWNABLE = [1, 3, 5, 6, 8, 9, 11, 12, 13, 14, 15, 16, 18, 19, 21, 23, 24, 25,
+    26, 27, 28, 29, 31, 32, 34, 35, 37, 39];
+
+/** A random two-player board: monopolies, houses, railroads, mortgages */
+function randomScenario() {
+    const propertyStates = {};
+    for (const sq of OWNABLE) {
+        propertyStates[sq] = { owner: null, houses: 0, mortgaged: false };
+    }
+
+    const groups = [[], []];
+    for (const group of GROUPS) {
+        const r = Math.random();
+        if (r > 0.5) continue;
+        const owner = r < 0.25 ? 0 : 1;
+        groups[owner].push(group);
+        const level = Math.floor(Math.random() * 6);
+        COLOR_GROUPS[group].squares.forEach((sq, i) => {
+            propertyStates[sq].owner = owner;
+            propertyStates[sq].houses = Math.max(0, level - (i === 0 && Math.random() < 0.3 ? 1 : 0));
+        });
+    }
+    for (const sq of [5, 15, 25, 35, 12, 28]) {
+        const r = Math.random();
+        if (r < 0.6) {
+            propertyStates[sq].owner = r < 0.3 ? 0 : 1;
+            propertyStates[sq].mortgaged = Math.random() < 0.2;
+        }
+    }
+
+    return {
+        propertyStates,
+        me: { groups: groups[0], id: 0, cash: Math.floor(Math.random() * 2000) - 100 },
+        them: { groups: groups[1], id: 1, cash: Math.floor(Math.random() * 2000) - 100 },
+        others: Math.floor(Math.random() * 3)
+    };
+}
+
+// =============================================================================
+// TURN-BY-TURN REFERENCES
+// =============================================================================
+
+/**
+ * Turn-by-turn reference for RelativeGrowthAI.simulateGrowthCurve
+ */
+function simulateGrowthCurveScalar(ai, group, startingCash, opponents, propertyStates, playerId) {
+    const squares = COLOR_GROUPS[group].squares;
+    const houseCost = BOARD[squares[0]].housePrice;
+    const costPerLevel = houseCost * squares.length;
+
+    // Clone property states for simulation
+    const simStates = {};
+    for (const sq of squares) {
+        simStates[sq] = {
+            owner: playerId,
+            houses: propertyStates[sq]?.houses || 0
+        };
+    }
+
+    let cash = startingCash;
+    let totalNPV = 0;
+
+    for (let t = 1; t <= ai.projectionHorizon; t++) {
+        // Calculate current EPT at current development level
+        const currentHouses = simStates[squares[0]].houses;
+        let ept = 0;
+        for (const sq of squares) {
+            const prob = ai.probs ? ai.probs[sq] : 0.025;
+            const rent = currentHouses === 0
+                ? BOARD[sq].rent[0] * 2  // Monopoly bonus
+                : BOARD[sq].rent[currentHouses];
+            ept += prob * rent * opponents;
+        }
+
+        // Add discounted EPT to NPV
+        const discountFactor = 1 / Math.pow(1 + ai.discountRate, t);
+        totalNPV += ept * discountFactor;
+
+        // Accumulate cash
+        cash += ept + DICE_EPT;  // Property income + dice income
+
+        // Build houses if possible
+        while (currentHouses < 5 && cash >= costPerLevel) {
+            cash -= costPerLevel;
+            for (const sq of squares) {
+                simStates[sq].houses++;
+            }
+        }
+    }
+
+    return totalNPV;
+}
+
+/**
+ * Turn-by-turn reference for RelativeGrowthAI.simulateBilateralGrowth
+ */
+function simulateBilateralGrowthScalar(ai, myState, theirState, propertyStates, numOtherOpponents) {
+    const horizon = ai.projectionHorizon;  // 62 turns
+    const getProb = (idx) => (ai.probs && ai.probs[idx]) || 0.025;
+
+    // Build initial development state for both players
+    const initPlayer = (pState) => {
+        const groups = [];
+        for (const groupName of pState.groups) {
+            if (!COLOR_GROUPS[groupName]) continue;
+            const squares = COLOR_GROUPS[groupName].squares;
+            const houseCost = BOARD[squares[0]].housePrice;
+            const houses = squares.map(sq =>
+                propertyStates[sq]?.houses || 0
+            );
+            groups.push({ name: groupName, squares, houseCost, houses });
+        }
+        // Count owned, unmortgaged railroads and utilities
+        let rrCount = 0, utilCount = 0;
+        for (const rrPos of [5, 15, 25, 35]) {
+            if (propertyStates[rrPos]?.owner === pState.id &&
+                !propertyStates[rrPos]?.mortgaged) rrCount++;
+        }
+        for (const utilPos of [12, 28]) {
+            if (propertyStates[utilPos]?.owner === pState.id &&
+                !propertyStates[utilPos]?.mortgaged) utilCount++;
+        }
+        return { cash: pState.cash, groups, id: pState.id, rrCount, utilCount };
+    };
+
+    const me = initPlayer(myState);
+    const them = initPlayer(theirState);
+
+    // Opponent count for EPT: each player faces the other + non-modeled players
+    const myOpponents = 1 + numOtherOpponents;
+    const theirOpponents = 1 + numOtherOpponents;
+
+    // Helper: compute total EPT for a player at current development
+    const computeEPT = (player, opponents) => {
+        let totalEPT = 0;
+        for (const g of player.groups) {
+            for (let i = 0; i < g.squares.length; i++) {
+                const sq = g.squares[i];
+                const h = g.houses[i];
+                const prob = getProb(sq);
+                const rent = h === 0
+                    ? BOARD[sq].rent[0] * 2  // monopoly, no houses
+                    : BOARD[sq].rent[h];
+                totalEPT += prob * rent * opponents;
+            }
+        }
+        // Railroad EPT (steady income, no development)
+        if (player.rrCount > 0) {
+            const rrRent = RAILROAD_RENT[player.rrCount];
+            for (const rrPos of [5, 15, 25, 35]) {
+                if (propertyStates[rrPos]?.owner === player.id &&
+                    !propertyStates[rrPos]?.mortgaged) {
+                    totalEPT += getProb(rrPos) * rrRent * opponents;
+                }
+            }
+        }
+        // Utility EPT (average dice roll = 7)
+        if (player.utilCount > 0) {
+            const utilRent = UTILITY_MULTIPLIER[player.utilCount] * 7;
+            for (const utilPos of [12, 28]) {
+                if (propertyStates[utilPos]?.owner === player.id &&
+                    !propertyStates[utilPos]?.mortgaged) {
+                    totalEPT += getProb(utilPos) * utilRent * opponents;
+                }
+            }
+        }
+        return totalEPT;
+    };
+
+    // Helper: build best available house (highest marginal ROI, even building)
+    const tryBuild = (player) => {
+        let bestROI = 0;
+        let bestGroup = null;
+        let bestSqIdx = -1;
+
+        for (const g of player.groups) {
+            const minH = Math.min(...g.houses);
+            for (let i = 0; i < g.squares.length; i++) {
+                if (g.houses[i] >= 5) continue;
+                if (g.houses[i] > minH) continue;  // even building
+                if (player.cash < g.houseCost) continue;
+
+                const sq = g.squares[i];
+                const prob = getProb(sq);
+                const curRent = g.houses[i] === 0
+                    ? BOARD[sq].rent[0] * 2
+                    : BOARD[sq].rent[g.houses[i]];
+                const newRent = BOARD[sq].rent[g.houses[i] + 1];
+                const marginalEPT = prob * (newRent - curRent);
+                const roi = marginalEPT / g.houseCost;
+
+                if (roi > bestROI) {
+                    bestROI = roi;
+                    bestGroup = g;
+                    bestSqIdx = i;
+                }
+            }
+        }
+
+        if (bestGroup && player.cash >= bestGroup.houseCost) {
+            player.cash -= bestGroup.houseCost;
+            bestGroup.houses[bestSqIdx]++;
+            return true;
+        }
+        return false;
+    };
+
+    // Helper: sell worst house (lowest marginal ROI, even-selling)
+    const trySellHouse = (player) => {
+        let worstROI = Infinity;
+        let worstGroup = null;
+        let worstSqIdx = -1;
+
+        for (const g of player.groups) {
+            const maxH = Math.max(...g.houses);
+            for (let i = 0; i < g.squares.length; i++) {
+                if (g.houses[i] <= 0) continue;
+                if (g.houses[i] < maxH) continue;  // even-selling
+
+                const sq = g.squares[i];
+                const prob = getProb(sq);
+                const curRent = BOARD[sq].rent[g.houses[i]];
+                const prevRent = g.houses[i] === 1
+                    ? BOARD[sq].rent[0] * 2
+                    : BOARD[sq].rent[g.houses[i] - 1];
+                const marginalEPT = prob * (curRent - prevRent);
+                const roi = marginalEPT / g.houseCost;
+
+                if (roi < worstROI) {
+                    worstROI = roi;
+                    worstGroup = g;
+                    worstSqIdx = i;
+                }
+            }
+        }
+
+        if (worstGroup) {
+            player.cash += Math.floor(worstGroup.houseCost / 2);  // 50% sale
+            worstGroup.houses[worstSqIdx]--;
+            return true;
+        }
+        return false;
+    };
+
+    // Helper: compute position (tangible value, not NPV)
+    const computePosition = (player) => {
+        let pos = player.cash;
+        for (const g of player.groups) {
+            for (let i = 0; i < g.squares.length; i++) {
+                pos += BOARD[g.squares[i]].price;
+                pos += g.houses[i] * g.houseCost;
+            }
+        }
+        // Railroad and utility property values
+        for (const rrPos of [5, 15, 25, 35]) {
+            if (propertyStates[rrPos]?.owner === player.id) pos += 200;
+        }
+        for (const utilPos of [12, 28]) {
+            if (propertyStates[utilPos]?.owner === player.id) pos += 150;
+        }
+        return pos;
+    };
+
+    const myTrajectory = [computePosition(me)];
+    const theirTrajectory = [computePosition(them)];
+
+    for (let t = 1; t <= horizon; t++) {
+        // Income phase: both players earn and pay rent simultaneously
+        const myEPT = computeEPT(me, myOpponents);
+        const theirEPT = computeEPT(them, theirOpponents);
+
+        me.cash += DICE_EPT + myEPT - theirEPT / myOpponents;
+        them.cash += DICE_EPT + theirEPT - myEPT / theirOpponents;
+
+        // Liquidation: sell houses at 50% when cash negative
+        if (me.cash < 0) {
+            while (me.cash < 0 && trySellHouse(me)) {}
+            me.cash = Math.max(0, me.cash);  // mortgage buffer
+        }
+        if (them.cash < 0) {
+            while (them.cash < 0 && trySellHouse(them)) {}
+            them.cash = Math.max(0, them.cash);  // mortgage buffer
+        }
+
+        // Build phase: each player builds greedily
+        while (tryBuild(me)) {}
+        while (tryBuild(them)) {}
+
+        myTrajectory.push(computePosition(me));
+        theirTrajectory.push(computePosition(them));
+    }
+
+    return { myTrajectory, theirTrajectory };
+}
+
+/**
+ * Turn-by-turn reference for GrowthTradingAI.calculateGrowthNPV
+ */
+function calculateGrowthNPVScalar(ai, group, startingCash, opponents) {
+    const houseCost = BOARD[COLOR_GROUPS[group].squares[0]].housePrice;
+    const groupSize = COLOR_GROUPS[group].squares.length;
+    const costPerLevel = houseCost * groupSize;
+
+    let cash = startingCash;
+    let houses = 0;
+    let npv = 0;
+
+    for (let t = 1; t <= ai.projectionHorizon; t++) {
+        const ept = ai.calculateGroupEPT(group, houses, opponents);
+
+        // Add discounted EPT to NPV
+        const discountFactor = 1 / Math.pow(1 + ai.discountRate, t);
+        npv += ept * discountFactor;
+
+        // Earn EPT
+        cash += ept;
+
+        // Buy houses if possible (build evenly)
+        while (houses < 5 && cash >= costPerLevel) {
+            cash -= costPerLevel;
+            houses++;
+        }
+    }
+
+    return npv;
+}
+
+// =============================================================================
+// TESTS
+// =============================================================================
+
+function main() {
+    const { GameEngine } = require('./game-engine.js');
+    const runner = createRunner({ maxTurns: 300 });
+    const engine = new GameEngine();
+    engine.newGame(2, []);
+    const ai = runner.createAIFactory('relative')(engine.state.players[0], engine);
+    const check = createCheck();
+
+    header('TESTING TRAJECTORY PROJECTOR');
+
+    // Test 1: Bilateral trajectories are bit-identical
+    console.log('\n--- TEST 1: Bilateral growth vs turn-by-turn ---');
+    {
+        let mismatches = 0;
+        const scenarios = 2000;
+        withSeed(58, () => {
+            for (let i = 0; i < scenarios; i++) {
+                const s = randomScenario();
+                const fast = ai.simulateBilateralGrowth(s.me, s.them, s.propertyStates, s.others);
+                const slow = simulateBilateralGrowthScalar(ai, s.me, s.them, s.propertyStates, s.others);
+                const same = fast.myTrajectory.every((v, t) => Object.is(v, slow.myTrajectory[t])) &&
+                    fast.theirTrajectory.every((v, t) => Object.is(v, slow.theirTrajectory[t])) &&
+                    fast.myTrajectory.length === slow.myTrajectory.length;
+                if (!same) mismatches++;
+            }
+        });
+        check(mismatches === 0,
+            `${scenarios}/${scenarios} scenarios identical`,
+            `${mismatches}/${scenarios} scenarios differ`);
+    }
+
+    // Test 2: A batch equals the same scenarios run one at a time
+    console.log('\n--- TEST 2: Batch vs single calls ---');
+    {
+        const s = withSeed(3, randomScenario);
+        const myCashes = [];
+        const theirCashes = [];
+        for (let cash = -500; cash <= 1000; cash += 50) {
+            myCashes.push(800 - cash);
+            theirCashes.push(600 + cash);
+        }
+        const batch = ai.simulateBilateralGrowthBatch(
+            s.me, s.them, s.propertyStates, s.others, myCashes, theirCashes);
+
+        let mismatches = 0;
+        myCashes.forEach((cash, k) => {
+            const single = simulateBilateralGrowthScalar(ai,
+                { ...s.me, cash }, { ...s.them, cash: theirCashes[k] }, s.propertyStates, s.others);
+            const row = batch.my.subarray(k * batch.stride, (k + 1) * batch.stride);
+            if (!single.myTrajectory.every((v, t) => Object.is(v, row[t]))) mismatches++;
+        });
+        check(mismatches === 0,
+            `${myCashes.length} batched scenarios match single runs`,
+            `${mismatches}/${myCashes.length} batched scenarios differ`);
+    }
+
+    // Test 3: Monopoly growth NPV is bit-identical
+    console.log('\n--- TEST 3: Growth curve NPV vs turn-by-turn ---');
+    {
+        let checks = 0;
+        let mismatches = 0;
+        withSeed(59, () => {
+            for (const group of GROUPS) {
+                for (let houses = 0; houses <= 5; houses++) {
+                    const propertyStates = {};
+                    for (const sq of COLOR_GROUPS[group].squares) {
+                        propertyStates[sq] = { owner: 0, houses };
+                    }
+                    const cashes = Array.from({ length: 20 }, () => Math.floor(Math.random() * 3000) - 200);
+                    const opponents = 1 + Math.floor(Math.random() * 3);
+                    const fast = ai.simulateGrowthCurves(group, cashes, opponents, propertyStates);
+                    cashes.forEach((cash, k) => {
+                        const slow = simulateGrowthCurveScalar(ai, group, cash, opponents, propertyStates, 0);
+                        if (!Object.is(fast[k], slow)) mismatches++;
+                        checks++;
+                    });
+                }
+            }
+        });
+        check(mismatches === 0,
+            `${checks}/${checks} NPVs identical`,
+            `${mismatches}/${checks} NPVs differ`);
+    }
+
+    // Test 4: GrowthTradingAI's variant (no dice income, capped per level)
+    console.log('\n--- TEST 4: GrowthTradingAI growth NPV ---');
+    {
+        const growth = runner.createAIFactory('growth')(engine.state.players[0], engine);
+        let checks = 0;
+        let mismatches = 0;
+        withSeed(60, () => {
+            for (const group of GROUPS) {
+                for (let i = 0; i < 40; i++) {
+                    const cash = Math.floor(Math.random() * 4000) - 200;
+                    const opponents = 1 + Math.floor(Math.random() * 3);
+                    const fast = growth.calculateGrowthNPV(group, cash, opponents);
+                    const slow = calculateGrowthNPVScalar(growth, group, cash, opponents);
+                    if (!Object.is(fast, slow)) mismatches++;
+                    checks++;
+                }
+            }
+        });
+        check(mismatches === 0,
+            `${checks}/${checks} NPVs identical`,
+            `${mismatches}/${checks} NPVs differ`);
+    }
+
+    // Test 5: Speed
+    console.log('\n--- TEST 5: Throughput ---');
+    {
+        const scenarios = withSeed(4, () => Array.from({ length: 300 }, randomScenario));
+        const time = (fn) => {
+            const start = process.hrtime.bigint();
+            for (const s of scenarios) fn(s);
+            return Number(process.hrtime.bigint() - start) / 1e6;
+        };
+        time(s => simulateBilateralGrowthScalar(ai, s.me, s.them, s.propertyStates, s.others));
+        const slow = time(s => simulateBilateralGrowthScalar(ai, s.me, s.them, s.propertyStates, s.others));
+        time(s => ai.simulateBilateralGrowth(s.me, s.them, s.propertyStates, s.others));
+        const fast = time(s => ai.simulateBilateralGrowth(s.me, s.them, s.propertyStates, s.others));
+        console.log(`  turn-by-turn ${slow.toFixed(1)}ms, projector ${fast.toFixed(1)}ms ` +
+            `(${(slow / fast).toFixed(1)}x)`);
+        console.log('✓ Timing reported');
+    }
+
+    summary(check, 'ALL PROJECTOR TESTS PASSED');
+}
+
+main();
@@ -0,0 +1,73 @@
+/**
+ * Test the shared worker pool: job order, persistent use and failure cleanup
+ */
+
+'use strict';
+
+const { isMainThread } = require('worker_threads');
+const { WorkerPool, runPool, serveJobs } = require('./worker-pool.js');
+const { createCheck, header, summary } = require('./harness.js');
+
+if (!isMainThread) {
+    serveJobs('square', (msg) => {
+        if (msg.value < 0) throw new Error(`negative input ${msg.value}`);
+        return { square: msg.value * msg.value };
+    });
+} else {
+    main();
+}
+
+async function main() {
+    const check = createCheck();
+
+    header('TESTING WORKER POOL');
+
+    // Test 1: One-shot pool returns results in job order
+    console.log('\n--- TEST 1: runPool ---');
+    {
+        const jobs = Array.from({ length: 25 }, (_, i) => ({ type: 'square', value: i }));
+        let progress = 0;
+        const results = await runPool(__filename, jobs, { workers: 3, onProgress: done => { progress = done; } });
+        const empty = await runPool(__filename, [], { workers: 3 });
+        check(results.every((r, i) => r.square === i * i) && progress === 25 && empty.length === 0,
+            '25 jobs on 3 workers come back in job order; no jobs spawns nothing',
+            `Results ${results.map(r => r.square).slice(0, 5)}, progress ${progress}`);
+    }
+
+    // Test 2: Persistent pool serves several batches
+    console.log('\n--- TEST 2: Persistent pool ---');
+    {
+        const pool = new WorkerPool(__filename, { workers: 2 });
+        await pool.start();
+        const first = await Promise.all([2, 3].map(value => pool.run({ type: 'square', value })));
+        const second = await pool.run({ type: 'square', value: 7 });
+        await pool.close();
+        check(first[0].square === 4 && first[1].square === 9 && second.square === 49,
+            'Batches after start() reuse the same workers',
+            `Got ${first.map(r => r.square)}, ${second.square}`);
+    }
+
+    // Test 3: A failing worker rejects the run and terminates every worker
+    console.log('\n--- TEST 3: Worker failure ---');
+    {
+        const pool = new WorkerPool(__filename, { workers: 3 });
+        await pool.start();
+        const exits = pool.workers.map(w => new Promise(resolve => w.once('exit', resolve)));
+        const jobs = [1, 2, -1, 4, 5, 6].map(value => pool.run({ type: 'square', value }));
+        let error = null;
+        try {
+            await Promise.all(jobs);
+        } catch (err) {
+            error = err;
+        }
+        await Promise.allSettled(jobs);
+        await Promise.all(exits);
+        let later = null;
+        await pool.run({ type: 'square', value: 2 }).catch(err => { later = err; });
+        check(error && /negative input -1/.test(error.message) && later === error,
+            'The worker error rejects the run, all 3 workers exit, and later runs fail fast',
+            `Error ${error && error.message}, later ${later && later.message}`);
+    }
+
+    summary(check, 'ALL WORKER POOL TESTS PASSED');
+}
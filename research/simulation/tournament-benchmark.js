@@ -0,0 +1,258 @@
+/**
+ * Tournament Throughput Benchmark
+ *
+ * Reproducible macro benchmark: fixed-seed tournaments run across a pool
+ * of worker threads. Game i always uses seed deriveSeed(baseSeed, i), so
+ * the same games are played whatever the worker count, and the outcome
+ * checksum must match between runs. A mismatch means the engine's
+ * behaviour changed, not just its speed.
+ *
+ * Configurations (lineups mirror the README runSimulation() example):
+ *   strategic4  - 4 x strategic
+ *   mixed       - strategic, optimal, relative, growth
+ *   auction     - all properties auctioned (AuctionGameEngine's default lineup)
+ *   long        - mixed lineup with maxTurns 1000
+ *
+ * Reported per configuration and worker count: games/sec, turns/sec,
+ * peak RSS and scaling efficiency relative to one worker.
+ *
+ * Usage:
+ *   node tournament-benchmark.js                      # 200 games, 1/4/16/all workers
+ *   node tournament-benchmark.js --games 1000
+ *   node tournament-benchmark.js --config mixed --workers 1,8
+ *   node tournament-benchmark.js --json benchmark-results/tournament.json
+ */
+
+'use strict';
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { isMainThread, workerData } = require('worker_threads');
+
+const { withSeed, deriveSeed } = require('./seeded-random.js');
+const { WorkerPool, serveJobs } = require('./worker-pool.js');
+const { quietly } = require('./harness.js');
+
+const README_LINEUP = ['strategic', 'optimal', 'relative', 'growth'];
+
+const CONFIGS = {
+    strategic4: {
+        description: '4 x strategic',
+        runner: 'standard',
+        lineup: ['strategic', 'strategic', 'strategic', 'strategic'],
+        maxTurns: 500
+    },
+    mixed: {
+        description: 'README mixed trading lineup',
+        runner: 'standard',
+        lineup: README_LINEUP,
+        maxTurns: 500
+    },
+    auction: {
+        description: 'Auction-only rules',
+        runner: 'auction',
+        lineup: ['relative', 'growth', 'leader', 'trading'],
+        maxTurns: 500
+    },
+    long: {
+        description: 'Mixed lineup, maxTurns 1000',
+        runner: 'standard',
+        lineup: README_LINEUP,
+        maxTurns: 1000
+    }
+};
+
+// =============================================================================
+// WORKER
+// =============================================================================
+
+/**
+ * Worker side: build one runner for the configuration, then play whatever
+ * game indices the main thread hands out.
+ */
+function workerMain() {
+    const config = CONFIGS[workerData.config];
+
+    // Runner constructors log Markov initialization; keep worker output quiet
+    const runner = quietly(() => {
+        if (config.runner === 'auction') {
+            const { AuctionSimulationRunner } = require('./auction-game-engine.js');
+            return new AuctionSimulationRunner({ maxTurns: config.maxTurns });
+        }
+        const { SimulationRunner } = require('./simulation-runner.js');
+        return new SimulationRunner({ maxTurns: config.maxTurns });
+    });
+
+    serveJobs('game', (msg) => {
+        const result = withSeed(deriveSeed(workerData.seed, msg.index),
+            () => runner.runSingleGame(config.lineup));
+
+        return {
+            turns: result.turns,
+            winner: result.winner !== null && result.winner !== undefined ? result.winner : -1
+        };
+    });
+}
+
+// =============================================================================
+// MAIN THREAD
+// =============================================================================
+
+class TournamentBenchmark {
+    constructor(options = {}) {
+        this.options = {
+            games: options.games || 200,
+            seed: options.seed || 20240601,
+            workerCounts: options.workerCounts || [1, 4, 16, os.cpus().length],
+            configs: options.configs || Object.keys(CONFIGS),
+            ...options
+        };
+    }
+
+    /**
+     * Play `games` games of one configuration on `numWorkers` threads.
+     * Games are handed out one at a time so slow games don't strand a worker.
+     * Worker startup (Markov init) is excluded from the timed region.
+     */
+    async runConfig(configName, numWorkers) {
+        const games = this.options.games;
+        const pool = new WorkerPool(__filename, {
+            workers: numWorkers,
+            workerData: { config: configName, seed: this.options.seed }
+        });
+        let peakRss = process.memoryUsage().rss;
+        const sampler = setInterval(() => {
+            peakRss = Math.max(peakRss, process.memoryUsage().rss);
+        }, 25);
+
+        try {
+            await pool.start();
+            const start = process.hrtime.bigint();
+            const jobs = [];
+            for (let i = 0; i < games; i++) jobs.push(pool.run({ type: 'game', index: i }));
+            const results = await Promise.all(jobs);
+            const elapsed = Number(process.hrtime.bigint() - start) / 1e9;
+            peakRss = Math.max(peakRss, process.memoryUsage().rss);
+            return { results, elapsed, peakRss };
+        } finally {
+            clearInterval(sampler);
+            await pool.close();
+        }
+    }
+
+    /**
+     * Order-independent fingerprint of the game outcomes
+     */
+    checksum(results) {
+        let h = 0;
+        for (let i = 0; i < results.length; i++) {
+            h = (Math.imul(h, 31) + results[i].turns * 8 + (results[i].winner + 1)) >>> 0;
+        }
+        return h.toString(16).padStart(8, '0');
+    }
+
+    async run() {
+        const workerCounts = [...new Set(this.options.workerCounts)].sort((a, b) => a - b);
+        const report = {
+            context: {
+                date: new Date().toISOString(),
+                host_name: os.hostname(),
+                executable: `node ${process.version}`,
+                num_cpus: os.cpus().length,
+                games: this.options.games,
+                seed: this.options.seed
+            },
+            configs: []
+        };
+
+        console.log('Tournament Throughput Benchmark');
+        console.log('='.repeat(78));
+        console.log(`Games per run: ${this.options.games}   Seed: ${this.options.seed}   CPUs: ${os.cpus().length}`);
+
+        for (const name of this.options.configs) {
+            const config = CONFIGS[name];
+            if (!config) throw new Error(`Unknown config: ${name}`);
+
+            console.log(`\n${name}: ${config.description} [${config.lineup.join(', ')}]`);
+            console.log(`  ${'Workers'.padStart(7)} ${'Games/s'.padStart(10)} ${'Turns/s'.padStart(12)} ` +
+                `${'Peak RSS'.padStart(10)} ${'Scaling'.padStart(8)}  Checksum`);
+
+            const entry = { name, ...config, runs: [] };
+            let baseRate = null;
+
+            for (const n of workerCounts) {
+                const { results, elapsed, peakRss } = await this.runConfig(name, n);
+                const totalTurns = results.reduce((s, r) => s + r.turns, 0);
+                const gamesPerSec = results.length / elapsed;
+                if (baseRate === null) baseRate = gamesPerSec / n;
+                const efficiency = gamesPerSec / (baseRate * n);
+
+                const run = {
+                    workers: n,
+                    elapsed,
+                    games_per_sec: gamesPerSec,
+                    turns_per_sec: totalTurns / elapsed,
+                    avg_turns: totalTurns / results.length,
+                    peak_rss_mb: peakRss / (1024 * 1024),
+                    scaling_efficiency: efficiency,
+                    checksum: this.checksum(results)
+                };
+                entry.runs.push(run);
+
+                console.log(`  ${String(n).padStart(7)} ${run.games_per_sec.toFixed(1).padStart(10)} ` +
+                    `${run.turns_per_sec.toFixed(0).padStart(12)} ${(run.peak_rss_mb.toFixed(0) + ' MB').padStart(10)} ` +
+                    `${(efficiency * 100).toFixed(0).padStart(7)}%  ${run.checksum}`);
+            }
+
+            const checksums = new Set(entry.runs.map(r => r.checksum));
+            if (checksums.size > 1) {
+                console.log('  WARNING: outcomes differ between worker counts (non-deterministic game)');
+            }
+            report.configs.push(entry);
+        }
+
+        return report;
+    }
+}
+
+// =============================================================================
+// COMMAND LINE INTERFACE
+// =============================================================================
+
+function parseArgs(argv) {
+    const args = {};
+    for (let i = 0; i < argv.length; i++) {
+        switch (argv[i]) {
+            case '--games': args.games = parseInt(argv[++i], 10); break;
+            case '--seed': args.seed = parseInt(argv[++i], 10); break;
+            case '--workers': args.workerCounts = argv[++i].split(',').map(Number); break;
+            case '--config': args.configs = argv[++i].split(','); break;
+            case '--json': args.json = argv[++i]; break;
+        }
+    }
+    return args;
+}
+
+async function main() {
+    const args = parseArgs(process.argv.slice(2));
+    const bench = new TournamentBenchmark(args);
+    const report = await bench.run();
+
+    if (args.json) {
+        fs.mkdirSync(path.dirname(path.resolve(args.json)), { recursive: true });
+        fs.writeFileSync(args.json, JSON.stringify(report, null, 2));
+        console.log(`\nResults written to ${args.json}`);
+    }
+}
+
+module.exports = { TournamentBenchmark, CONFIGS };
+
+if (!isMainThread) {
+    workerMain();
+} else if (require.main === module) {
+    main().catch(err => {
+        console.error(err);
+        process.exit(1);
+    });
+}
@@ -10,6 +10,7 @@
 
 const { BOARD, COLOR_GROUPS, PROPERTIES, RAILROAD_RENT, UTILITY_MULTIPLIER, SQUARE_TYPES } = require('./game-engine.js');
 const { StrategicAI } = require('./base-ai.js');
+const { TrajectoryProjector } = require('./trajectory-projector.js');
 
 // =============================================================================
 // TRADING AI
@@ -29,6 +30,16 @@ class TradingAI extends StrategicAI {
         this.tradeCooldown = 5;  // Turns before we can trade back the same property
     }
 
+    /**
+     * Batched projector for growth-curve valuation (see trajectory-projector.js)
+     */
+    getProjector() {
+        if (!this.projector || this.projector.probs !== this.probs) {
+            this.projector = new TrajectoryProjector(this.probs);
+        }
+        return this.projector;
+    }
+
     /**
      * Called before rolling - opportunity to propose trades
      */
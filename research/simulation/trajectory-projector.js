@@ -0,0 +1,367 @@
+/**
+ * Cash-Trajectory Projector
+ *
+ * Batched replacement for the turn-by-turn growth loops in RelativeGrowthAI
+ * (simulateBilateralGrowth, simulateGrowthCurve). Trade and bid pricing run
+ * those loops dozens of times per decision with only the starting cash
+ * changing, re-deriving rents, probabilities and ROIs from BOARD and
+ * propertyStates on every simulated turn.
+ *
+ * The projector compiles each side once into flat typed arrays - EPT and
+ * build/sell ROI per square per house level, fixed railroad/utility income,
+ * fixed position terms - and then evolves cash, development and position
+ * for a whole batch of starting-cash scenarios against the compiled tables.
+ *
+ * Results are bit-for-bit identical to the original loops: every table
+ * entry is computed with the same expression, and sums are accumulated in
+ * the same order.
+ *
+ * Usage:
+ *   const projector = new TrajectoryProjector(probs);
+ *   const me = projector.compileSide({ groups, id }, propertyStates, opponents);
+ *   const them = projector.compileSide(...);
+ *   const out = projector.projectBilateral(me, them, myCashes, theirCashes, 62);
+ *   out.my.subarray(k * out.stride, (k + 1) * out.stride)   // scenario k
+ */
+
+'use strict';
+
+const { BOARD, COLOR_GROUPS, RAILROAD_RENT, UTILITY_MULTIPLIER } = require('./game-engine.js');
+
+const DICE_EPT = 38;  // ~$35 from Go + ~$3 from cards per turn
+const LEVELS = 6;     // 0-4 houses, 5 = hotel
+const RAILROADS = [5, 15, 25, 35];
+const UTILITIES = [12, 28];
+
+class TrajectoryProjector {
+    /**
+     * @param {number[]} probs - landing probability per square (null = 2.5% each)
+     */
+    constructor(probs) {
+        this.probs = probs || null;
+        this.discountCache = new Map();
+    }
+
+    /** Probability as simulateBilateralGrowth reads it */
+    bilateralProb(sq) {
+        return (this.probs && this.probs[sq]) || 0.025;
+    }
+
+    // =========================================================================
+    // BILATERAL GROWTH
+    // =========================================================================
+
+    /**
+     * Compile one player's side of a bilateral projection.
+     *
+     * @param {Object} pState - { groups: [groupName, ...], id }
+     * @param {Object} propertyStates - houses, owners and mortgages to start from
+     * @param {number} opponents - players this side collects rent from
+     */
+    compileSide(pState, propertyStates, opponents) {
+        const squares = [];
+        const groupStart = [0];
+        for (const groupName of pState.groups) {
+            if (!COLOR_GROUPS[groupName]) continue;
+            squares.push(...COLOR_GROUPS[groupName].squares);
+            groupStart.push(squares.length);
+        }
+
+        const count = squares.length;
+        const side = {
+            count,
+            groupStart: Int32Array.from(groupStart),
+            houses: new Int8Array(count),
+            houseCost: new Float64Array(count),
+            sale: new Float64Array(count),
+            price: new Float64Array(count),
+            ept: new Float64Array(count * LEVELS),
+            buildROI: new Float64Array(count * LEVELS),
+            sellROI: new Float64Array(count * LEVELS),
+            fixedEPT: [],
+            fixedPosition: []
+        };
+
+        for (let g = 0; g + 1 < side.groupStart.length; g++) {
+            const start = side.groupStart[g];
+            const end = side.groupStart[g + 1];
+            const houseCost = BOARD[squares[start]].housePrice;
+
+            for (let s = start; s < end; s++) {
+                const sq = squares[s];
+                const rent = BOARD[sq].rent;
+                const prob = this.bilateralProb(sq);
+                const levelRent = (h) => h === 0 ? rent[0] * 2 : rent[h];
+
+                side.houses[s] = propertyStates[sq]?.houses || 0;
+                side.houseCost[s] = houseCost;
+                side.sale[s] = Math.floor(houseCost / 2);
+                side.price[s] = BOARD[sq].price;
+
+                for (let h = 0; h < LEVELS; h++) {
+                    side.ept[s * LEVELS + h] = prob * levelRent(h) * opponents;
+                    if (h < 5) {
+                        side.buildROI[s * LEVELS + h] = prob * (rent[h + 1] - levelRent(h)) / houseCost;
+                    }
+                    if (h > 0) {
+                        side.sellROI[s * LEVELS + h] = prob * (rent[h] - levelRent(h - 1)) / houseCost;
+                    }
+                }
+            }
+        }
+
+        // Railroads and utilities: income and value that never change
+        let rrCount = 0;
+        let utilCount = 0;
+        const unmortgaged = (sq) =>
+            propertyStates[sq]?.owner === pState.id && !propertyStates[sq]?.mortgaged;
+        for (const sq of RAILROADS) if (unmortgaged(sq)) rrCount++;
+        for (const sq of UTILITIES) if (unmortgaged(sq)) utilCount++;
+
+        if (rrCount > 0) {
+            const rrRent = RAILROAD_RENT[rrCount];
+            for (const sq of RAILROADS) {
+                if (unmortgaged(sq)) side.fixedEPT.push(this.bilateralProb(sq) * rrRent * opponents);
+            }
+        }
+        if (utilCount > 0) {
+            const utilRent = UTILITY_MULTIPLIER[utilCount] * 7;
+            for (const sq of UTILITIES) {
+                if (unmortgaged(sq)) side.fixedEPT.push(this.bilateralProb(sq) * utilRent * opponents);
+            }
+        }
+        for (const sq of RAILROADS) {
+            if (propertyStates[sq]?.owner === pState.id) side.fixedPosition.push(200);
+        }
+        for (const sq of UTILITIES) {
+            if (propertyStates[sq]?.owner === pState.id) side.fixedPosition.push(150);
+        }
+
+        return side;
+    }
+
+    /**
+     * Project both sides jointly for a batch of starting-cash pairs.
+     * Same model as RelativeGrowthAI.simulateBilateralGrowth: each turn both
+     * earn dice income and rent, pay the other's rent share, liquidate
+     * houses at 50% when negative, then build greedily by marginal ROI.
+     *
+     * @returns {{my: Float64Array, their: Float64Array, stride: number}}
+     *   positions for turns 0..horizon, scenario k at [k * stride, (k + 1) * stride)
+     */
+    projectBilateral(mySide, theirSide, myCashes, theirCashes, horizon, opponents) {
+        const stride = horizon + 1;
+        const batch = myCashes.length;
+        const my = new Float64Array(batch * stride);
+        const their = new Float64Array(batch * stride);
+
+        const myHouses = new Int8Array(mySide.count);
+        const theirHouses = new Int8Array(theirSide.count);
+
+        for (let k = 0; k < batch; k++) {
+            myHouses.set(mySide.houses);
+            theirHouses.set(theirSide.houses);
+            let myCash = myCashes[k];
+            let theirCash = theirCashes[k];
+            const base = k * stride;
+
+            my[base] = position(mySide, myHouses, myCash);
+            their[base] = position(theirSide, theirHouses, theirCash);
+
+            for (let t = 1; t <= horizon; t++) {
+                const myEPT = sideEPT(mySide, myHouses);
+                const theirEPT = sideEPT(theirSide, theirHouses);
+
+                myCash += DICE_EPT + myEPT - theirEPT / opponents;
+                theirCash += DICE_EPT + theirEPT - myEPT / opponents;
+
+                if (myCash < 0) {
+                    myCash = liquidate(mySide, myHouses, myCash);
+                }
+                if (theirCash < 0) {
+                    theirCash = liquidate(theirSide, theirHouses, theirCash);
+                }
+
+                myCash = buildAll(mySide, myHouses, myCash);
+                theirCash = buildAll(theirSide, theirHouses, theirCash);
+
+                my[base + t] = position(mySide, myHouses, myCash);
+                their[base + t] = position(theirSide, theirHouses, theirCash);
+            }
+        }
+
+        return { my, their, stride };
+    }
+
+    // =========================================================================
+    // SINGLE-MONOPOLY GROWTH NPV
+    // =========================================================================
+
+    /**
+     * NPV of one monopoly's rent stream for a batch of starting cash values.
+     * Same model as RelativeGrowthAI.simulateGrowthCurve (the defaults) and
+     * GrowthTradingAI.calculateGrowthNPV (diceIncome 0, capEachBuild).
+     *
+     * RelativeGrowthAI checks the hotel cap once per turn rather than per
+     * level built, so with enough cash its curve runs past a hotel and the
+     * NPV becomes NaN; capEachBuild: false reproduces that exactly.
+     *
+     * @param {Object} options - { diceIncome = DICE_EPT, capEachBuild = false }
+     * @returns {Float64Array} NPV per starting cash
+     */
+    growthNPV(group, startHouses, opponents, cashes, horizon, discountRate, options = {}) {
+        const diceIncome = options.diceIncome ?? DICE_EPT;
+        const capEachBuild = options.capEachBuild ?? false;
+        const squares = COLOR_GROUPS[group].squares;
+        const costPerLevel = BOARD[squares[0]].housePrice * squares.length;
+        const discount = this.discountFactors(discountRate, horizon);
+
+        // EPT by development level; levels past a hotel have no rent (NaN),
+        // exactly as the turn-by-turn loop reads them
+        const levelEPT = [];
+        const levelOf = (h) => {
+            while (levelEPT.length <= h) {
+                const level = levelEPT.length;
+                let ept = 0;
+                for (const sq of squares) {
+                    const prob = this.probs ? this.probs[sq] : 0.025;
+                    const rent = level === 0 ? BOARD[sq].rent[0] * 2 : BOARD[sq].rent[level];
+                    ept += prob * rent * opponents;
+                }
+                levelEPT.push(ept);
+            }
+            return levelEPT[h];
+        };
+
+        const out = new Float64Array(cashes.length);
+        for (let k = 0; k < cashes.length; k++) {
+            let cash = cashes[k];
+            let houses = startHouses;
+            let npv = 0;
+
+            for (let t = 1; t <= horizon; t++) {
+                const ept = levelOf(houses);
+                npv += ept * discount[t];
+                cash += diceIncome ? ept + diceIncome : ept;
+
+                if (capEachBuild) {
+                    while (houses < 5 && cash >= costPerLevel) {
+                        cash -= costPerLevel;
+                        houses++;
+                    }
+                } else if (houses < 5) {
+                    while (cash >= costPerLevel) {
+                        cash -= costPerLevel;
+                        houses++;
+                    }
+                }
+            }
+            out[k] = npv;
+        }
+        return out;
+    }
+
+    /** 1 / (1 + r)^t for t = 0..horizon, cached per rate */
+    discountFactors(rate, horizon) {
+        let factors = this.discountCache.get(rate);
+        if (!factors || factors.length <= horizon) {
+            factors = new Float64Array(horizon + 1);
+            for (let t = 0; t <= horizon; t++) {
+                factors[t] = 1 / Math.pow(1 + rate, t);
+            }
+            this.discountCache.set(rate, factors);
+        }
+        return factors;
+    }
+}
+
+// =============================================================================
+// KERNELS
+// =============================================================================
+
+function sideEPT(side, houses) {
+    let total = 0;
+    for (let s = 0; s < side.count; s++) {
+        total += side.ept[s * LEVELS + houses[s]];
+    }
+    for (let i = 0; i < side.fixedEPT.length; i++) {
+        total += side.fixedEPT[i];
+    }
+    return total;
+}
+
+function position(side, houses, cash) {
+    let pos = cash;
+    for (let s = 0; s < side.count; s++) {
+        pos += side.price[s];
+        pos += houses[s] * side.houseCost[s];
+    }
+    for (let i = 0; i < side.fixedPosition.length; i++) {
+        pos += side.fixedPosition[i];
+    }
+    return pos;
+}
+
+/** Greedy even building: best marginal ROI first, until nothing is affordable */
+function buildAll(side, houses, cash) {
+    const starts = side.groupStart;
+    for (;;) {
+        let bestROI = 0;
+        let best = -1;
+
+        for (let g = 0; g + 1 < starts.length; g++) {
+            let minH = 5;
+            for (let s = starts[g]; s < starts[g + 1]; s++) {
+                if (houses[s] < minH) minH = houses[s];
+            }
+            for (let s = starts[g]; s < starts[g + 1]; s++) {
+                const h = houses[s];
+                if (h >= 5 || h > minH) continue;
+                if (cash < side.houseCost[s]) continue;
+
+                const roi = side.buildROI[s * LEVELS + h];
+                if (roi > bestROI) {
+                    bestROI = roi;
+                    best = s;
+                }
+            }
+        }
+
+        if (best < 0) return cash;
+        cash -= side.houseCost[best];
+        houses[best]++;
+    }
+}
+
+/** Sell the lowest-ROI house (even selling) until cash is non-negative */
+function liquidate(side, houses, cash) {
+    const starts = side.groupStart;
+    while (cash < 0) {
+        let worstROI = Infinity;
+        let worst = -1;
+
+        for (let g = 0; g + 1 < starts.length; g++) {
+            let maxH = 0;
+            for (let s = starts[g]; s < starts[g + 1]; s++) {
+                if (houses[s] > maxH) maxH = houses[s];
+            }
+            for (let s = starts[g]; s < starts[g + 1]; s++) {
+                const h = houses[s];
+                if (h <= 0 || h < maxH) continue;
+
+                const roi = side.sellROI[s * LEVELS + h];
+                if (roi < worstROI) {
+                    worstROI = roi;
+                    worst = s;
+                }
+            }
+        }
+
+        if (worst < 0) break;
+        cash += side.sale[worst];
+        houses[worst]--;
+    }
+    return Math.max(0, cash);  // mortgage buffer
+}
+
+module.exports = { TrajectoryProjector, DICE_EPT };
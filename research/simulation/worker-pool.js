@@ -0,0 +1,155 @@
+/**
+ * Worker Thread Pool
+ *
+ * The ready/dispatch/result loop shared by the parallel runners. Each
+ * worker runs the calling module's own file, builds whatever it needs
+ * once, then answers jobs one at a time:
+ *
+ *   worker -> main   { type: 'ready' }                  once, after setup
+ *   main -> worker   { ...job, id }                     one job per idle worker
+ *   worker -> main   { type: 'result', id, ...fields }  worker is idle again
+ *
+ * Jobs are handed out one at a time so a slow job doesn't strand a
+ * worker. If any worker fails, every queued and running job is rejected
+ * with that error and all workers are terminated.
+ *
+ * Usage:
+ *   // main thread, one-shot: results in job order
+ *   const results = await runPool(__filename, jobs, { workers: 8, workerData, onProgress });
+ *
+ *   // main thread, persistent
+ *   const pool = new WorkerPool(__filename, { workers: 8, workerData });
+ *   await pool.start();
+ *   const result = await pool.run({ type: 'game', index: 3 });
+ *   await pool.close();
+ *
+ *   // worker side
+ *   serveJobs('game', msg => ({ turns: play(msg.index) }));
+ */
+
+'use strict';
+
+const { Worker, parentPort } = require('worker_threads');
+
+class WorkerPool {
+    /**
+     * @param {string} file - Worker script, usually the caller's __filename
+     * @param {Object} options - { workers, workerData }
+     */
+    constructor(file, options = {}) {
+        this.file = file;
+        this.size = Math.max(1, options.workers || 1);
+        this.workerData = options.workerData;
+        this.workers = [];
+        this.idle = [];
+        this.queue = [];
+        this.pending = new Map();
+        this.nextId = 0;
+        this.error = null;
+        this.started = null;
+    }
+
+    /** Spawn the workers; resolves once every worker has reported ready */
+    start() {
+        if (this.started) return this.started;
+        this.started = new Promise((resolve, reject) => {
+            let ready = 0;
+            this.rejectStart = reject;
+            for (let w = 0; w < this.size; w++) {
+                const worker = new Worker(this.file, { workerData: this.workerData });
+                this.workers.push(worker);
+                worker.on('message', (msg) => {
+                    if (msg.type === 'ready') {
+                        this.idle.push(worker);
+                        if (++ready === this.size) resolve();
+                        this.pump();
+                    } else if (msg.type === 'result') {
+                        // Results still in flight when the pool failed have no job
+                        if (this.error) return;
+                        const job = this.pending.get(msg.id);
+                        this.pending.delete(msg.id);
+                        this.idle.push(worker);
+                        job.resolve(msg);
+                        this.pump();
+                    }
+                });
+                worker.on('error', err => this.fail(err));
+            }
+        });
+        return this.started;
+    }
+
+    /** Queue one job; resolves with the worker's result message */
+    run(job) {
+        if (this.error) return Promise.reject(this.error);
+        return new Promise((resolve, reject) => {
+            this.queue.push({ id: this.nextId++, job, resolve, reject });
+            this.pump();
+        });
+    }
+
+    pump() {
+        while (this.idle.length > 0 && this.queue.length > 0) {
+            const entry = this.queue.shift();
+            const worker = this.idle.pop();
+            this.pending.set(entry.id, entry);
+            worker.postMessage({ ...entry.job, id: entry.id });
+        }
+    }
+
+    fail(err) {
+        if (this.error) return;
+        this.error = err;
+        this.rejectStart(err);
+        for (const entry of [...this.pending.values(), ...this.queue]) entry.reject(err);
+        this.pending.clear();
+        this.queue = [];
+        this.close();
+    }
+
+    close() {
+        return Promise.all(this.workers.map(w => w.terminate()));
+    }
+}
+
+/**
+ * Run every job on a fresh pool and shut it down, on success or failure.
+ * @param {Object} options - { workers, workerData, onProgress(completed, total) }
+ * @returns {Promise<Object[]>} result messages in job order
+ */
+async function runPool(file, jobs, options = {}) {
+    if (jobs.length === 0) return [];
+    const pool = new WorkerPool(file, {
+        workers: Math.min(options.workers || 1, jobs.length),
+        workerData: options.workerData
+    });
+    let completed = 0;
+    try {
+        await pool.start();
+        return await Promise.all(jobs.map(job => pool.run(job).then(result => {
+            completed++;
+            if (options.onProgress) options.onProgress(completed, jobs.length);
+            return result;
+        })));
+    } finally {
+        await pool.close();
+    }
+}
+
+/**
+ * Worker side: answer every `type` job with handler(msg)'s fields, then
+ * report ready. Call after the worker's one-time setup.
+ */
+function serveJobs(type, handler) {
+    parentPort.on('message', (msg) => {
+        if (msg.type !== type) return;
+        parentPort.postMessage({ type: 'result', id: msg.id, ...handler(msg) });
+    });
+    parentPort.postMessage({ type: 'ready' });
+}
+
+module.exports = {
+    WorkerPool,
+    runPool,
+    serveJobs
+};